@@ -4,6 +4,7 @@
 from __future__ import annotations
 
 import os
+import json
 from typing import TYPE_CHECKING, override
 from dataclasses import dataclass
 import logging
@@ -134,6 +135,97 @@ class DevConsoleTabTest(DevConsoleTab):
         )
 
 
+class DevConsoleTabLatency(DevConsoleTab):
+    """Dev-console tab for measuring input-to-screen latency."""
+
+    @override
+    def refresh(self) -> None:
+        stats = json.loads(_babase.get_input_latency_stats())
+        enabled = stats['enabled']
+        self.button(
+            'Stop Tracing' if enabled else 'Start Tracing',
+            pos=(10, 10),
+            size=(140, 30),
+            h_anchor='left',
+            label_scale=0.6,
+            call=self._toggle,
+        )
+        self.button(
+            'Reset',
+            pos=(160, 10),
+            size=(100, 30),
+            h_anchor='left',
+            label_scale=0.6,
+            call=self._reset,
+        )
+        self.button(
+            'Refresh',
+            pos=(270, 10),
+            size=(100, 30),
+            h_anchor='left',
+            label_scale=0.6,
+            call=self.request_refresh,
+        )
+        self.button(
+            'Export',
+            pos=(380, 10),
+            size=(100, 30),
+            h_anchor='left',
+            label_scale=0.6,
+            call=self._export,
+        )
+        limits = stats['bucket_limits_ms']
+        labels = [f'<={lim:g}' for lim in limits] + [f'>{limits[-1]:g}']
+        lines = [f'abandoned samples: {stats["abandoned"]}']
+        for name, stage in stats['stages'].items():
+            lines.append(
+                f'{name}: n={stage["count"]} avg={stage["avg_ms"]:.1f}ms'
+                f' p50<={stage["p50_ms"]:.1f}ms p95<={stage["p95_ms"]:.1f}ms'
+                f' max={stage["max_ms"]:.1f}ms'
+            )
+            lines.append(
+                '    '
+                + ' '.join(
+                    f'{label}:{count}'
+                    for label, count in zip(labels, stage['histogram'])
+                    if count
+                )
+            )
+        if not stats['stages']:
+            lines.append('No samples yet.' if enabled else 'Tracing is off.')
+        for i, line in enumerate(reversed(lines)):
+            self.text(
+                line,
+                scale=0.6,
+                pos=(15, 50 + 18 * i),
+                h_anchor='left',
+                h_align='left',
+                v_align='none',
+            )
+
+    def _toggle(self) -> None:
+        stats = json.loads(_babase.get_input_latency_stats())
+        _babase.set_input_latency_tracing(not stats['enabled'])
+        self.request_refresh()
+
+    def _reset(self) -> None:
+        _babase.reset_input_latency_stats()
+        self.request_refresh()
+
+    def _export(self) -> None:
+        path = os.path.join(
+            os.path.dirname(_babase.app.env.config_file_path),
+            'input_latency.json',
+        )
+        with open(path, 'w', encoding='utf-8') as outfile:
+            outfile.write(_babase.get_input_latency_stats())
+        logging.info('Input latency stats written to %s.', path)
+
+
+def _input_latency_tracing_enabled() -> bool:
+    return bool(json.loads(_babase.get_input_latency_stats())['enabled'])
+
+
 @dataclass
 class DevConsoleTabEntry:
     """Represents a distinct tab in the dev-console."""
@@ -141,6 +233,9 @@ class DevConsoleTabEntry:
     name: str
     factory: Callable[[], DevConsoleTab]
 
+    # If provided, the tab is only shown while this returns True.
+    available: Callable[[], bool] | None = None
+
 
 class DevConsoleSubsystem:
     """Subsystem for wrangling the dev console.
@@ -157,7 +252,12 @@ class DevConsoleSubsystem:
         # All tabs in the dev-console. Add your own stuff here via
         # plugins or whatnot.
         self.tabs: list[DevConsoleTabEntry] = [
-            DevConsoleTabEntry('Python', DevConsoleTabPython)
+            DevConsoleTabEntry('Python', DevConsoleTabPython),
+            DevConsoleTabEntry(
+                'Latency',
+                DevConsoleTabLatency,
+                available=_input_latency_tracing_enabled,
+            ),
         ]
         if os.environ.get('BA_DEV_CONSOLE_TEST_TAB', '0') == '1':
             self.tabs.append(DevConsoleTabEntry('Test', DevConsoleTabTest))
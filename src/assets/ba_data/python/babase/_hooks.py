@@ -415,7 +415,11 @@ def string_edit_adapter_can_be_replaced(adapter: StringEditAdapter) -> bool:
 
 def get_dev_console_tab_names() -> list[str]:
     """Return the current set of dev-console tab names."""
-    return [t.name for t in _babase.app.devconsole.tabs]
+    return [
+        t.name
+        for t in _babase.app.devconsole.tabs
+        if t.available is None or t.available()
+    ]
 
 
 def unsupported_controller_message(name: str) -> None:
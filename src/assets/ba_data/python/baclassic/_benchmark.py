@@ -12,7 +12,7 @@ import bascenev1
 import _baclassic
 
 if TYPE_CHECKING:
-    from typing import Any, Sequence
+    from typing import Any, Callable, Sequence
 
 
 def run_cpu_benchmark() -> None:
@@ -50,6 +50,60 @@ def run_cpu_benchmark() -> None:
     bascenev1.new_host_session(BenchmarkSession, benchmark_type='cpu')
 
 
+def run_vec3_benchmark(iterations: int = 100000) -> dict[str, float]:
+    """Time common Vec3 patterns used in per-tick game code.
+
+    Returns microseconds per iteration for each pattern, comparing the
+    plain operators with their fused equivalents.
+    """
+    import time
+
+    vec = babase.Vec3
+    results: dict[str, float] = {}
+
+    def _timed(name: str, call: Callable[[], None]) -> None:
+        start = time.perf_counter()
+        call()
+        results[name] = (time.perf_counter() - start) * 1e6 / iterations
+
+    def _binary_ops() -> None:
+        pos = vec(1.0, 2.0, 3.0)
+        vel = vec(0.1, 0.2, 0.3)
+        for _i in range(iterations):
+            pos = pos + vel * 0.5 - vel
+
+    def _manual_lerp() -> None:
+        start = vec(1.0, 2.0, 3.0)
+        end = vec(4.0, 5.0, 6.0)
+        for _i in range(iterations):
+            _ = start + (end - start) * 0.25
+
+    def _fused_lerp() -> None:
+        start = vec(1.0, 2.0, 3.0)
+        end = vec(4.0, 5.0, 6.0)
+        for _i in range(iterations):
+            _ = start.lerp(end, 0.25)
+
+    def _manual_distance() -> None:
+        start = vec(1.0, 2.0, 3.0)
+        end = vec(4.0, 5.0, 6.0)
+        for _i in range(iterations):
+            _ = (end - start).length()
+
+    def _fused_distance() -> None:
+        start = vec(1.0, 2.0, 3.0)
+        end = vec(4.0, 5.0, 6.0)
+        for _i in range(iterations):
+            _ = start.distance(end)
+
+    _timed('binary_ops', _binary_ops)
+    _timed('manual_lerp', _manual_lerp)
+    _timed('fused_lerp', _fused_lerp)
+    _timed('manual_distance', _manual_distance)
+    _timed('fused_distance', _fused_distance)
+    return results
+
+
 @dataclass
 class _StressTestArgs:
     playlist_type: str
@@ -57,6 +111,7 @@ class _StressTestArgs:
     player_count: int
     round_duration: int
     attract_mode: bool
+    rand: random.Random
 
 
 def run_stress_test(
@@ -65,8 +120,20 @@ def run_stress_test(
     player_count: int = 8,
     round_duration: int = 30,
     attract_mode: bool = False,
+    seed: int | None = None,
+    duration: float | None = None,
+    report_path: str | None = None,
+    report_interval: float = 60.0,
 ) -> None:
-    """Run a stress test."""
+    """Run a stress test.
+
+    For long-running soak tests, pass a seed to make player churn and
+    playlist selection reproducible, a duration (in seconds) after which
+    to end the test (and quit the app if headless), and a report path to
+    periodically append JSON summaries of engine stats to.
+    """
+
+    assert babase.app.classic is not None
 
     with babase.ContextRef.empty():
         if not attract_mode:
@@ -74,6 +141,13 @@ def run_stress_test(
                 "Beginning stress test.. use 'End Test' to stop testing.",
                 color=(1, 1, 0),
             )
+        _baclassic.set_stress_test_soak(
+            seed=seed, report_path=report_path, report_interval=report_interval
+        )
+        if duration is not None:
+            babase.app.classic.stress_test_end_timer = babase.AppTimer(
+                duration, _end_soak_test
+            )
         _start_stress_test(
             _StressTestArgs(
                 playlist_type=playlist_type,
@@ -81,6 +155,7 @@ def run_stress_test(
                 player_count=player_count,
                 round_duration=round_duration,
                 attract_mode=attract_mode,
+                rand=random.Random(seed),
             )
         )
 
@@ -91,8 +166,16 @@ def stop_stress_test() -> None:
     assert babase.app.classic is not None
 
     _baclassic.set_stress_testing(False, 0, False)
+    _baclassic.set_stress_test_soak(report_path=None)
     babase.app.classic.stress_test_update_timer = None
     babase.app.classic.stress_test_update_timer_2 = None
+    babase.app.classic.stress_test_end_timer = None
+
+
+def _end_soak_test() -> None:
+    stop_stress_test()
+    if babase.app.env.headless:
+        babase.quit()
 
 
 def _start_stress_test(args: _StressTestArgs) -> None:
@@ -104,7 +187,7 @@ def _start_stress_test(args: _StressTestArgs) -> None:
     appconfig = babase.app.config
     playlist_type = args.playlist_type
     if playlist_type == 'Random':
-        if random.random() < 0.5:
+        if args.rand.random() < 0.5:
             playlist_type = 'Teams'
         else:
             playlist_type = 'Free-For-All'
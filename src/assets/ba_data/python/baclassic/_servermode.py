@@ -450,7 +450,11 @@ class ServerController:
                 playlist_type='Random',
                 playlist_name='__default__',
                 player_count=self._config.stress_test_players,
-                round_duration=30,
+                round_duration=self._config.stress_test_round_duration,
+                seed=self._config.stress_test_seed,
+                duration=self._config.stress_test_duration,
+                report_path=self._config.stress_test_report_path,
+                report_interval=self._config.stress_test_report_interval,
             )
         else:
             bascenev1.new_host_session(sessiontype)
@@ -71,6 +71,7 @@ class ClassicSubsystem(babase.AppSubsystem):
         self.tips: list[str] = []
         self.stress_test_update_timer: babase.AppTimer | None = None
         self.stress_test_update_timer_2: babase.AppTimer | None = None
+        self.stress_test_end_timer: babase.AppTimer | None = None
         self.value_test_defaults: dict = {}
         self.special_offer: dict | None = None
         self.ping_thread_count = 0
@@ -548,6 +549,12 @@ class ClassicSubsystem(babase.AppSubsystem):
 
         run()
 
+    def run_vec3_benchmark(self, iterations: int = 100000) -> dict[str, float]:
+        """Time Vec3 math; returns microseconds per iteration by pattern."""
+        from baclassic._benchmark import run_vec3_benchmark as run
+
+        return run(iterations)
+
     def run_media_reload_benchmark(self) -> None:
         """Kick off a benchmark to test media reloading speeds."""
         from baclassic._benchmark import run_media_reload_benchmark as run
@@ -561,6 +568,10 @@ class ClassicSubsystem(babase.AppSubsystem):
         player_count: int = 8,
         round_duration: int = 30,
         attract_mode: bool = False,
+        seed: int | None = None,
+        duration: float | None = None,
+        report_path: str | None = None,
+        report_interval: float = 60.0,
     ) -> None:
         """Run a stress test."""
         from baclassic._benchmark import run_stress_test as run
@@ -571,6 +582,10 @@ class ClassicSubsystem(babase.AppSubsystem):
             player_count=player_count,
             round_duration=round_duration,
             attract_mode=attract_mode,
+            seed=seed,
+            duration=duration,
+            report_path=report_path,
+            report_interval=report_interval,
         )
 
     def get_input_device_mapped_value(
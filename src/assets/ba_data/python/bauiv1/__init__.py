@@ -102,6 +102,7 @@ from _bauiv1 import (
     checkboxwidget,
     columnwidget,
     containerwidget,
+    editwidgets,
     get_qrcode_texture,
     get_special_widget,
     getmesh,
@@ -159,6 +160,7 @@ __all__ = [
     'displaytimer',
     'DisplayTimer',
     'do_once',
+    'editwidgets',
     'fade_screen',
     'get_display_resolution',
     'get_input_idle_time',
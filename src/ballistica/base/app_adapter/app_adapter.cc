@@ -15,6 +15,8 @@ AppAdapter::~AppAdapter() = default;
 
 auto AppAdapter::ManagesMainThreadEventLoop() const -> bool { return true; }
 
+auto AppAdapter::ReportsFramePresents() const -> bool { return false; }
+
 void AppAdapter::OnMainThreadStartApp() {
   assert(g_core);
   assert(g_core->InMainThread());
@@ -46,6 +46,11 @@ class AppAdapter {
   /// and receive events via callbacks/etc.
   virtual auto ManagesMainThreadEventLoop() const -> bool;
 
+  /// Return whether this adapter informs the input latency tracer when
+  /// rendered frames are actually presented. Default is false, in which
+  /// case frames are considered presented once rendered.
+  virtual auto ReportsFramePresents() const -> bool;
+
   /// When called, the main thread event loop should be run until
   /// ExitMainThreadEventLoop() is called. This will only be called if
   /// ManagesMainThreadEventLoop() returns true.
@@ -223,6 +223,7 @@ void AppAdapterSDL::RunMainThreadEventLoopToCompletion() {
     // Draw.
     if (!hidden_ && TryRender()) {
       SDL_GL_SwapWindow(sdl_window_);
+      g_base->input->latency_tracer()->MarkPresented();
     }
 
     // Sleep.
@@ -804,6 +805,8 @@ void AppAdapterSDL::CursorPositionForDraw(float* x, float* y) {
   *y = immediate_y;
 }
 
+auto AppAdapterSDL::ReportsFramePresents() const -> bool { return true; }
+
 auto AppAdapterSDL::FullscreenControlAvailable() const -> bool { return true; }
 auto AppAdapterSDL::FullscreenControlKeyShortcut() const
     -> std::optional<std::string> {
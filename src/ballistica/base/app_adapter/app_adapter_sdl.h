@@ -33,6 +33,7 @@ class AppAdapterSDL : public AppAdapter {
 
   auto TryRender() -> bool;
 
+  auto ReportsFramePresents() const -> bool override;
   auto FullscreenControlAvailable() const -> bool override;
   auto FullscreenControlKeyShortcut() const
       -> std::optional<std::string> override;
@@ -2,11 +2,20 @@
 
 #include "ballistica/base/assets/collision_mesh_asset.h"
 
+#include <cstdio>
+#include <string>
+#include <vector>
+
 #include "ballistica/base/assets/assets.h"
 #include "ballistica/core/core.h"
+#include "ballistica/core/platform/core_platform.h"
 
 namespace ballistica::base {
 
+// Header id and format version for cached collision trees.
+const uint32_t kCollisionTreeCacheID = 0x45455254;  // 'TREE'
+const uint32_t kCollisionTreeCacheVersion = 1;
+
 CollisionMeshAsset::CollisionMeshAsset(const std::string& file_name_in)
     : file_name_(file_name_in) {
   assert(g_base && g_base->assets);
@@ -78,39 +87,123 @@ void CollisionMeshAsset::DoPreload() {
 
   fclose(f);
 
+  // Quantized trees are roughly half the size but slightly less precise
+  // in culling; they are opt-in for now. Writing tree caches is also
+  // opt-in since asset dirs are generally read-only at runtime; it is
+  // meant to be done once when preparing a server or build.
+  bool quantize =
+      g_core->platform->GetEnv("BA_COLLISION_TREE_QUANTIZE") == "1";
+  bool write_cache =
+      g_core->platform->GetEnv("BA_COLLISION_TREE_CACHE_WRITE") == "1";
+  std::vector<uint8_t> tree_data = ReadTreeCache(quantize);
+  const void* tree_data_ptr = tree_data.empty() ? nullptr : tree_data.data();
+  auto tree_data_size = static_cast<int>(tree_data.size());
+
   tri_mesh_data_ = dGeomTriMeshDataCreate();
   BA_PRECONDITION(tri_mesh_data_);
 
-  if (!g_core->HeadlessMode()) {
-    tri_mesh_data_bg_ = dGeomTriMeshDataCreate();
-    BA_PRECONDITION(tri_mesh_data_bg_);
-  }
-
 #ifdef dSINGLE
-  dGeomTriMeshDataBuildSingle1(
+  int loaded_tree = dGeomTriMeshDataBuildSingle2(
       tri_mesh_data_, &(vertices_[0]), 3 * sizeof(dReal),
       static_cast_check_fit<int>(vertex_count), &(indices_[0]),
-      static_cast<int>(indices_.size()), 3 * sizeof(uint32_t), &(normals_[0]));
-  if (!g_core->HeadlessMode()) {
-    dGeomTriMeshDataBuildSingle1(tri_mesh_data_bg_, &(vertices_[0]),
-                                 3 * sizeof(dReal), i_vals[0], &(indices_[0]),
-                                 static_cast<int>(indices_.size()),
-                                 3 * sizeof(uint32_t), &(normals_[0]));
-  }
+      static_cast<int>(indices_.size()), 3 * sizeof(uint32_t), &(normals_[0]),
+      quantize, tree_data_ptr, tree_data_size);
 #else
 #ifndef dDOUBLE
 #error single or double precition not defined
 #endif
-  dGeomTriMeshDataBuildDouble1(
-      tri_mesh_data_, &(vertices_[0]), 3 * sizeof(dReal), vertex_count,
-      &(indices_[0]), indices_.size(), 3 * sizeof(uint32_t), &(normals_[0]));
-  if (!HeadlessMode()) {
-    dGeomTriMeshDataBuildDouble1(
-        tri_mesh_data_bg_, &(vertices_[0]), 3 * sizeof(dReal), i_vals[0],
-        &(indices_[0]), indices_.size(), 3 * sizeof(uint32_t), &(normals_[0]));
-  }
+  int loaded_tree = dGeomTriMeshDataBuildDouble2(
+      tri_mesh_data_, &(vertices_[0]), 3 * sizeof(dReal),
+      static_cast_check_fit<int>(vertex_count), &(indices_[0]),
+      static_cast<int>(indices_.size()), 3 * sizeof(uint32_t), &(normals_[0]),
+      quantize, tree_data_ptr, tree_data_size);
 #endif  // dSINGLE
-}  // namespace ballistica
+
+  if (!loaded_tree && write_cache) {
+    WriteTreeCache(quantize);
+  }
+
+  // The bg-dynamics world gets its own mesh data (so it can be used from
+  // the bg-dynamics thread) but shares our tree instead of building one.
+  if (!g_core->HeadlessMode()) {
+    tri_mesh_data_bg_ = dGeomTriMeshDataCreate();
+    BA_PRECONDITION(tri_mesh_data_bg_);
+    dGeomTriMeshDataBuildShared(tri_mesh_data_bg_, tri_mesh_data_);
+  }
+}
+
+auto CollisionMeshAsset::GetTreeCachePath() const -> std::string {
+  return file_name_full_ + ".tree";
+}
+
+auto CollisionMeshAsset::GetTreeCacheHash() const -> uint32_t {
+  // FNV-1a over our raw geometry; any change to the .cob invalidates
+  // the cache.
+  uint32_t hash{2166136261u};
+  auto add = [&hash](const void* data, size_t size) {
+    auto* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+      hash = (hash ^ bytes[i]) * 16777619u;
+    }
+  };
+  add(vertices_.data(), vertices_.size() * sizeof(dReal));
+  add(indices_.data(), indices_.size() * sizeof(uint32_t));
+  return hash;
+}
+
+auto CollisionMeshAsset::ReadTreeCache(bool quantized) const
+    -> std::vector<uint8_t> {
+  std::vector<uint8_t> data;
+  FILE* f = g_core->platform->FOpen(GetTreeCachePath().c_str(), "rb");
+  if (!f) {
+    return data;
+  }
+  uint32_t header[5];
+  if (fread(header, sizeof(header), 1, f) == 1
+      && header[0] == kCollisionTreeCacheID
+      && header[1] == kCollisionTreeCacheVersion
+      && header[2] == static_cast<uint32_t>(quantized)
+      && header[3] == GetTreeCacheHash() && header[4] > 0) {
+    data.resize(header[4]);
+    if (fread(data.data(), data.size(), 1, f) != 1) {
+      data.clear();
+    }
+  }
+  fclose(f);
+  return data;
+}
+
+void CollisionMeshAsset::WriteTreeCache(bool quantized) const {
+  int size = dGeomTriMeshDataGetTreeData(tri_mesh_data_, nullptr);
+  if (size <= 0) {
+    return;
+  }
+  std::vector<uint8_t> data(static_cast<size_t>(size));
+  dGeomTriMeshDataGetTreeData(tri_mesh_data_, data.data());
+
+  // Write to a temp file and move it into place so concurrent loaders
+  // never see a partial cache.
+  auto path = GetTreeCachePath();
+  auto tmp_path = path + ".tmp";
+  FILE* f = g_core->platform->FOpen(tmp_path.c_str(), "wb");
+  if (!f) {
+    Log(LogLevel::kWarning,
+        "Unable to write collision tree cache '" + path + "'.");
+    return;
+  }
+  uint32_t header[5] = {kCollisionTreeCacheID, kCollisionTreeCacheVersion,
+                        static_cast<uint32_t>(quantized), GetTreeCacheHash(),
+                        static_cast<uint32_t>(size)};
+  bool success = fwrite(header, sizeof(header), 1, f) == 1
+                 && fwrite(data.data(), data.size(), 1, f) == 1;
+  fclose(f);
+  if (!success
+      || g_core->platform->Rename(tmp_path.c_str(), path.c_str()) != 0) {
+    g_core->platform->Unlink(tmp_path.c_str());
+    Log(LogLevel::kWarning,
+        "Unable to write collision tree cache '" + path + "'.");
+  }
+}
 
 void CollisionMeshAsset::DoLoad() { assert(g_base->InLogicThread()); }
 
@@ -127,10 +220,11 @@ void CollisionMeshAsset::DoUnload() {
     return;
   }
 
-  dGeomTriMeshDataDestroy(tri_mesh_data_);
+  // Our bg data shares our main data's tree so must go first.
   if (tri_mesh_data_bg_) {
     dGeomTriMeshDataDestroy(tri_mesh_data_bg_);
   }
+  dGeomTriMeshDataDestroy(tri_mesh_data_);
 }
 
 auto CollisionMeshAsset::GetMeshData() -> dTriMeshDataID {
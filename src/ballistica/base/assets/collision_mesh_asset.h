@@ -24,9 +24,20 @@ class CollisionMeshAsset : public Asset {
   auto GetName() const -> std::string override;
 
   auto GetMeshData() -> dTriMeshDataID;
+
+  /// Mesh data for the bg-dynamics world. This shares its collision tree
+  /// with GetMeshData() but can safely be used from the bg-dynamics
+  /// thread.
   auto GetBGMeshData() -> dTriMeshDataID;
 
  private:
+  // Built collision trees can be cached in a file alongside the .cob
+  // file so subsequent loads can skip building them.
+  auto GetTreeCachePath() const -> std::string;
+  auto GetTreeCacheHash() const -> uint32_t;
+  auto ReadTreeCache(bool quantized) const -> std::vector<uint8_t>;
+  void WriteTreeCache(bool quantized) const;
+
   std::string file_name_;
   std::string file_name_full_;
   std::vector<dReal> vertices_;
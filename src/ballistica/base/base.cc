@@ -17,10 +17,12 @@
 #include "ballistica/base/networking/network_writer.h"
 #include "ballistica/base/networking/networking.h"
 #include "ballistica/base/python/base_python.h"
+#include "ballistica/base/python/class/python_class_env.h"
 #include "ballistica/base/python/class/python_class_feature_set_data.h"
 #include "ballistica/base/python/support/python_context_call.h"
 #include "ballistica/base/support/app_config.h"
 #include "ballistica/base/support/base_build_switches.h"
+#include "ballistica/base/support/context_accounting.h"
 #include "ballistica/base/support/huffman.h"
 #include "ballistica/base/support/plus_soft.h"
 #include "ballistica/base/support/stdio_console.h"
@@ -49,6 +51,7 @@ BaseFeatureSet::BaseFeatureSet()
       bg_dynamics{g_core->HeadlessMode() ? nullptr : new BGDynamics},
       bg_dynamics_server{g_core->HeadlessMode() ? nullptr
                                                 : new BGDynamicsServer},
+      context_accounting{new ContextAccounting()},
       context_ref{new ContextRef(nullptr)},
       graphics{BaseBuildSwitches::CreateGraphics()},
       graphics_server{new GraphicsServer()},
@@ -213,6 +216,12 @@ void BaseFeatureSet::StartApp() {
 
   LogVersionInfo_();
 
+  // Preforked server workers switch config dirs after our env values get
+  // set up; make sure those are current before anyone reads the config.
+  if (g_core->prefork_worker_index()) {
+    PythonClassEnv::UpdateConfigFilePath();
+  }
+
   // The logic thread (or maybe other things) need to run Python as
   // we're bringing them up, so let it go for the duration of this call.
   // We'll explicitly grab it if/when we need it.
@@ -766,6 +775,9 @@ PyObject* BaseFeatureSet::GetPyExceptionType(PyExcType exctype) {
 void BaseFeatureSet::SetCurrentContext(const ContextRef& context) {
   assert(InLogicThread());  // Up to caller to ensure this.
   context_ref->SetTarget(context.Get());
+  if (context_accounting->enabled()) {
+    context_accounting->Switch(context.Get());
+  }
 }
 
 auto BaseFeatureSet::PrintPythonStackTrace() -> bool {
@@ -56,6 +56,7 @@ class CollisionCache;
 class DevConsole;
 class DisplayTimer;
 class Context;
+class ContextAccounting;
 class ContextRef;
 class DataAsset;
 class FrameDef;
@@ -115,11 +116,13 @@ class TestInput;
 class TextGroup;
 class TextGraphics;
 class TextMesh;
+class TextMeshGeometry;
 class TextPacker;
 class TextureAsset;
 class TextureAssetPreloadData;
 class TextureAssetRendererData;
 class TouchInput;
+class UDPRecordingWriter;
 class UI;
 class UIDelegateInterface;
 class AppAdapterVR;
@@ -792,6 +795,7 @@ class BaseFeatureSet : public FeatureSetNativeComponent,
   BasePython* const python;
   BGDynamics* const bg_dynamics;
   BGDynamicsServer* const bg_dynamics_server;
+  ContextAccounting* const context_accounting;
   ContextRef* const context_ref;
   Graphics* const graphics;
   GraphicsServer* const graphics_server;
@@ -2,6 +2,8 @@
 
 #include "ballistica/base/dynamics/bg/bg_dynamics_server.h"
 
+#include <algorithm>
+
 #include "ballistica/base/assets/collision_mesh_asset.h"
 #include "ballistica/base/dynamics/bg/bg_dynamics_draw_snapshot.h"
 #include "ballistica/base/dynamics/bg/bg_dynamics_fuse_data.h"
@@ -11,6 +13,8 @@
 #include "ballistica/base/dynamics/collision_cache.h"
 #include "ballistica/base/graphics/graphics_server.h"
 #include "ballistica/base/logic/logic.h"
+#include "ballistica/core/core.h"
+#include "ballistica/core/platform/core_platform.h"
 #include "ballistica/shared/foundation/event_loop.h"
 #include "ballistica/shared/generic/utils.h"
 
@@ -30,6 +34,16 @@ const float kShadowOccludeDistance = 0.5f;
 // How big the shadow gets at its max dist.
 const float kMaxShadowScale = 3.0f;
 
+// Fraction of each step's duration our own step work should fit into;
+// past this our load governor starts scaling things back.
+const float kBGDynamicsStepBudgetFraction = 0.5f;
+
+// The governor never scales emission/shadows below this.
+const float kBGDynamicsMinLoadScale = 0.25f;
+
+// How fast load scale creeps back up per step once we're under budget.
+const float kBGDynamicsLoadScaleRecoveryRate = 0.002f;
+
 const float kSmokeBaseGlow = 0.0f;
 const float kSmokeGlow = 400.0f;
 
@@ -689,6 +703,11 @@ BGDynamicsServer::BGDynamicsServer()
 }
 
 void BGDynamicsServer::OnMainThreadStartApp() {
+  auto val = g_core->platform->GetEnv("BA_BG_DYNAMICS_NO_GOVERNOR");
+  if (val && *val == "1") {
+    governor_enabled_ = false;
+  }
+
   // Spin up our thread.
   event_loop_ = new EventLoop(EventLoopID::kBGDynamics);
   g_core->suspendable_event_loops.push_back(event_loop_);
@@ -1069,6 +1088,21 @@ void BGDynamicsServer::Emit(const BGDynamicsEmission& def) {
 #endif
   }
 
+  // If our steps have been running over budget, scale things back now
+  // instead of waiting for the logic thread to tell us we're too slow.
+  float load_scale = load_scale_.load(std::memory_order_relaxed);
+  if (load_scale < 1.0f) {
+    int unscaled_count = emit_count;
+    emit_count = static_cast<int>(static_cast<float>(emit_count) * load_scale);
+    tendril_thick_max =
+        static_cast<int>(static_cast<float>(tendril_thick_max) * load_scale);
+    tendril_thin_max =
+        static_cast<int>(static_cast<float>(tendril_thin_max) * load_scale);
+    chunk_max = static_cast<int>(static_cast<float>(chunk_max) * load_scale);
+    throttled_emit_count_.fetch_add(unscaled_count - emit_count,
+                                    std::memory_order_relaxed);
+  }
+
   if (def.emit_type == BGDynamicsEmitType::kTendrils) {
     if (def.tendril_type == BGDynamicsTendrilType::kThinSmoke) {
       // For thin tendrils, start scaling back once we pass 8 tendrils.
@@ -1512,6 +1546,7 @@ auto BGDynamicsServer::CreateDrawSnapshot() -> BGDynamicsDrawSnapshot* {
   uint32_t light_max_count = 0;
   uint32_t shadow_drawn_count = 0;
   uint32_t light_drawn_count = 0;
+  uint32_t shadow_skipped_count = 0;
 
   for (auto&& i : chunks_) {
     BGDynamicsChunkType t = i->type();
@@ -1598,6 +1633,11 @@ auto BGDynamicsServer::CreateDrawSnapshot() -> BGDynamicsDrawSnapshot* {
     c_flag_stand = ss->flag_stands.data();
   }
 
+  // Our load governor may limit how many chunk shadows we draw.
+  auto shadow_draw_limit = static_cast<uint32_t>(
+      static_cast<float>(shadow_max_count)
+      * load_scale_.load(std::memory_order_relaxed));
+
   // Allocate buffers as if we're drawing *all* lights/shadows for chunks.
   // We may prune this down.
   uint16_t *s_index = nullptr, *l_index = nullptr;
@@ -1758,6 +1798,13 @@ auto BGDynamicsServer::CreateDrawSnapshot() -> BGDynamicsDrawSnapshot* {
       }
     }
 
+    if (draw_shadow && shadow_drawn_count >= shadow_draw_limit
+        && shadow_dist > -kShadowOccludeDistance
+        && shadow_dist < max_shadow_dist) {
+      draw_shadow = false;
+      shadow_skipped_count++;
+    }
+
     if (draw_shadow || draw_light) {
       // Only draw light/shadow if we're within our max/min distances
       // from the ground.
@@ -1919,6 +1966,11 @@ auto BGDynamicsServer::CreateDrawSnapshot() -> BGDynamicsDrawSnapshot* {
         break;
     }
   }
+  if (shadow_skipped_count > 0) {
+    skipped_shadow_count_.fetch_add(shadow_skipped_count,
+                                    std::memory_order_relaxed);
+  }
+
   if (shadow_max_count > 0) {
     if (shadow_drawn_count == 0) {
       // If we didn't actually draw *any*, completely kill our buffers.
@@ -2235,6 +2287,16 @@ auto BGDynamicsServer::CreateDrawSnapshot() -> BGDynamicsDrawSnapshot* {
 
 void BGDynamicsServer::PushTooSlowCall() {
   event_loop()->PushCall([this] {
+    too_slow_count_.fetch_add(1, std::memory_order_relaxed);
+
+    // Our governor didn't catch this in time; have it back off sharply
+    // so we don't land right back here.
+    if (governor_enabled_) {
+      load_scale_.store(
+          std::max(kBGDynamicsMinLoadScale,
+                   load_scale_.load(std::memory_order_relaxed) * 0.75f),
+          std::memory_order_relaxed);
+    }
     if (chunk_count_ > 0 || tendril_count_thick_ > 0
         || tendril_count_thin_ > 0) {
       // Ok lets kill a small percentage of our oldest chunks.
@@ -2281,6 +2343,8 @@ void BGDynamicsServer::Step(StepData* step_data) {
   // data.
   auto ref(Object::CompleteDeferred(step_data));
 
+  microsecs_t start_time = g_core->GetAppTimeMicrosecs();
+
   // Keep our quality in sync with the graphics thread's.
   graphics_quality_ = step_data->graphics_quality;
   assert(graphics_quality_ != GraphicsQuality::kUnset);
@@ -2343,6 +2407,8 @@ void BGDynamicsServer::Step(StepData* step_data) {
 
   time_ms_ += step_milliseconds_;  // milliseconds per step
 
+  UpdateGovernor(g_core->GetAppTimeMicrosecs() - start_time);
+
   // Give our collision cache a bit of processing time here and
   // there to fill itself in slowly.
   collision_cache_->Precalc();
@@ -2362,6 +2428,33 @@ void BGDynamicsServer::Step(StepData* step_data) {
   }
 }
 
+void BGDynamicsServer::UpdateGovernor(microsecs_t step_cost) {
+  auto budget = static_cast<microsecs_t>(step_milliseconds_ * 1000.0f
+                                         * kBGDynamicsStepBudgetFraction);
+  step_budget_.store(budget, std::memory_order_relaxed);
+
+  // Smooth our cost a bit so a single hitch doesn't send us reeling.
+  auto average = average_step_cost_.load(std::memory_order_relaxed);
+  average += (step_cost - average) / 8;
+  average_step_cost_.store(average, std::memory_order_relaxed);
+
+  if (!governor_enabled_ || budget <= 0) {
+    return;
+  }
+  float scale = load_scale_.load(std::memory_order_relaxed);
+  if (average > budget) {
+    // Back off harder the further over budget we are.
+    float over = static_cast<float>(average) / static_cast<float>(budget);
+    scale *= std::max(0.9f, 1.0f - 0.02f * over);
+  } else if (average < budget * 6 / 10) {
+    // Creep back up only once we've got some headroom; otherwise we'd
+    // just bounce off the budget.
+    scale += kBGDynamicsLoadScaleRecoveryRate;
+  }
+  load_scale_.store(std::clamp(scale, kBGDynamicsMinLoadScale, 1.0f),
+                    std::memory_order_relaxed);
+}
+
 void BGDynamicsServer::PushStep(StepData* data) {
   // Increase our step count and ship it.
   {
@@ -3,6 +3,7 @@
 #ifndef BALLISTICA_BASE_DYNAMICS_BG_BG_DYNAMICS_SERVER_H_
 #define BALLISTICA_BASE_DYNAMICS_BG_BG_DYNAMICS_SERVER_H_
 
+#include <atomic>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -124,6 +125,43 @@ class BGDynamicsServer {
   auto step_seconds() const { return step_seconds_; }
   auto step_milliseconds() const { return step_milliseconds_; }
 
+  // Load governor state; these can be read from any thread.
+
+  /// Whether the load governor is active (it can be disabled by setting
+  /// BA_BG_DYNAMICS_NO_GOVERNOR=1).
+  auto governor_enabled() const { return governor_enabled_; }
+
+  /// Current load scale (0-1). Emission counts, debris/tendril caps, and
+  /// drawn debris shadows are all scaled by this.
+  auto load_scale() const {
+    return load_scale_.load(std::memory_order_relaxed);
+  }
+
+  /// Smoothed cost of recent steps on our thread.
+  auto average_step_cost() const -> microsecs_t {
+    return average_step_cost_.load(std::memory_order_relaxed);
+  }
+
+  /// How much time per step we try to keep our cost under.
+  auto step_budget() const -> microsecs_t {
+    return step_budget_.load(std::memory_order_relaxed);
+  }
+
+  /// Number of chunks/tendrils the governor declined to emit.
+  auto throttled_emit_count() const {
+    return throttled_emit_count_.load(std::memory_order_relaxed);
+  }
+
+  /// Number of debris shadows the governor declined to draw.
+  auto skipped_shadow_count() const {
+    return skipped_shadow_count_.load(std::memory_order_relaxed);
+  }
+
+  /// Number of times the logic thread told us we were too slow.
+  auto too_slow_count() const {
+    return too_slow_count_.load(std::memory_order_relaxed);
+  }
+
  private:
   class Terrain;
   class Chunk;
@@ -141,6 +179,7 @@ class BGDynamicsServer {
   void UpdateTendrils();
   void UpdateFuses();
   void UpdateShadows();
+  void UpdateGovernor(microsecs_t step_cost);
   auto CreateDrawSnapshot() -> BGDynamicsDrawSnapshot*;
   void CalcERPCFM(dReal stiffness, dReal damping, dReal* erp, dReal* cfm);
 
@@ -188,6 +227,13 @@ class BGDynamicsServer {
   float step_seconds_{};
   float step_milliseconds_{};
   GraphicsQuality graphics_quality_{GraphicsQuality::kLow};
+  bool governor_enabled_{true};
+  std::atomic<float> load_scale_{1.0f};
+  std::atomic<microsecs_t> average_step_cost_{};
+  std::atomic<microsecs_t> step_budget_{};
+  std::atomic<uint64_t> throttled_emit_count_{};
+  std::atomic<uint64_t> skipped_shadow_count_{};
+  std::atomic<uint64_t> too_slow_count_{};
 };
 
 }  // namespace ballistica::base
@@ -33,6 +33,7 @@ PFNGLUSEPROGRAMOBJECTARBPROC glUseProgram{};
 PFNGLGENERATEMIPMAPPROC glGenerateMipmap{};
 PFNGLBINDFRAMEBUFFERPROC glBindFramebuffer{};
 PFNGLBLITFRAMEBUFFERPROC glBlitFramebuffer{};
+PFNGLDRAWELEMENTSINSTANCEDPROC glDrawElementsInstanced{};
 PFNGLBINDVERTEXARRAYPROC glBindVertexArray{};
 PFNGLGETUNIFORMLOCATIONPROC glGetUniformLocation{};
 PFNGLUNIFORM1IPROC glUniform1i{};
@@ -165,6 +166,7 @@ void SysGLInit(RendererGL* renderer) {
   GET(PFNGLGENVERTEXARRAYSPROC, glGenVertexArrays, true);
   GET(PFNGLDELETEVERTEXARRAYSPROC, glDeleteVertexArrays, true);
   GET(PFNGLBLITFRAMEBUFFERPROC, glBlitFramebuffer, true);
+  GET(PFNGLDRAWELEMENTSINSTANCEDPROC, glDrawElementsInstanced, true);
   GET(PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, glRenderbufferStorageMultisample,
       true);
 }
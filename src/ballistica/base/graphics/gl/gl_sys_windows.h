@@ -51,6 +51,7 @@ extern PFNGLUSEPROGRAMOBJECTARBPROC glUseProgram;
 extern PFNGLGENERATEMIPMAPPROC glGenerateMipmap;
 extern PFNGLBINDFRAMEBUFFERPROC glBindFramebuffer;
 extern PFNGLBLITFRAMEBUFFERPROC glBlitFramebuffer;
+extern PFNGLDRAWELEMENTSINSTANCEDPROC glDrawElementsInstanced;
 extern PFNGLBINDVERTEXARRAYPROC glBindVertexArray;
 extern PFNGLGETUNIFORMLOCATIONPROC glGetUniformLocation;
 extern PFNGLUNIFORM1IPROC glUniform1i;
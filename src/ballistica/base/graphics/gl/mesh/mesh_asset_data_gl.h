@@ -136,6 +136,19 @@ class RendererGL::MeshAssetDataGL : public MeshAssetRendererData {
     BA_DEBUG_CHECK_GL_ERROR;
   }
 
+  // Only usable when the renderer has instancing support.
+  void DrawInstanced(int count) {
+    assert(renderer_->instancing_support());
+    BA_DEBUG_CHECK_GL_ERROR;
+    if (elem_count_ > 0 && count > 0) {
+#if !BA_OPENGL_IS_ES
+      glDrawElementsInstanced(GL_TRIANGLES, elem_count_, index_type_, nullptr,
+                              count);
+#endif
+    }
+    BA_DEBUG_CHECK_GL_ERROR;
+  }
+
 #if BA_DEBUG_BUILD
   auto name() const -> const std::string& { return name_; }
 #endif
@@ -207,6 +207,13 @@ class RendererGL::ProgramGL {
           glGetUniformLocation(program_, "lightShadowProjectionMatrix");
       assert(light_shadow_projection_matrix_uniform_ != -1);
     }
+    if (pflags_ & PFLAG_USES_INSTANCE_MATRICES) {
+      instance_matrices_uniform_ =
+          glGetUniformLocation(program_, "instanceMatrices");
+      assert(instance_matrices_uniform_ != -1);
+      instanced_uniform_ = glGetUniformLocation(program_, "instanced");
+      assert(instanced_uniform_ != -1);
+    }
   }
 
   virtual ~ProgramGL() {
@@ -229,6 +236,28 @@ class RendererGL::ProgramGL {
 
   auto name() const -> const std::string& { return name_; }
 
+  auto uses_instance_matrices() const -> bool {
+    return (pflags_ & PFLAG_USES_INSTANCE_MATRICES) != 0;
+  }
+
+  // Set per-instance model matrices for following instanced draws, which
+  // are applied on top of the current model-view matrix. Pass a count of
+  // 0 to go back to regular drawing.
+  void SetInstanceMatrices(const Matrix44f* matrices, int count) {
+    assert(IsBound());
+    assert(uses_instance_matrices());
+    assert(count >= 0 && count <= kMaxGLDrawInstances);
+    bool instanced = count > 0;
+    if (instanced != instanced_) {
+      instanced_ = instanced;
+      glUniform1i(instanced_uniform_, instanced ? 1 : 0);
+    }
+    if (count > 0) {
+      glUniformMatrix4fv(instance_matrices_uniform_, count, 0, matrices[0].m);
+    }
+    BA_DEBUG_CHECK_GL_ERROR;
+  }
+
   // Should grab matrices from the renderer or whatever else it needs in
   // prep for drawing.
   void PrepareToDraw() {
@@ -341,6 +370,9 @@ class RendererGL::ProgramGL {
   GLint light_shadow_projection_matrix_uniform_{};
   GLint cam_pos_uniform_{};
   GLint cam_orient_matrix_uniform_{};
+  GLint instance_matrices_uniform_{};
+  GLint instanced_uniform_{};
+  bool instanced_{};
   int cam_orient_matrix_state_{};
   int light_shadow_projection_matrix_state_{};
   int pflags_{};
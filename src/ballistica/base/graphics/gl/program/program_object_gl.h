@@ -188,6 +188,9 @@ class RendererGL::ProgramObjectGL : public RendererGL::ProgramGL {
       pflags |= PFLAG_USES_MODEL_WORLD_MATRIX;
     if (flags & SHD_LIGHT_SHADOW) pflags |= PFLAG_USES_SHADOW_PROJECTION_MATRIX;
     if (flags & SHD_WORLD_SPACE_PTS) pflags |= PFLAG_WORLD_SPACE_PTS;
+#if !BA_OPENGL_IS_ES
+    pflags |= PFLAG_USES_INSTANCE_MATRICES;
+#endif
     return pflags;
   }
 
@@ -208,29 +211,51 @@ class RendererGL::ProgramObjectGL : public RendererGL::ProgramGL {
     if (flags & SHD_LIGHT_SHADOW)
       s += "uniform mat4 lightShadowProjectionMatrix;\n" BA_GLSL_VERTEX_OUT
            " " BA_GLSL_MEDIUMP "vec4 vLightShadowUV;\n";
+#if !BA_OPENGL_IS_ES
+    s += "uniform mat4 instanceMatrices["
+         + std::to_string(kMaxGLDrawInstances)
+         + "];\n"
+           "uniform bool instanced;\n";
+#endif
+    s += "void main() {\n";
+
+    // Instanced draws apply a per-instance model matrix first.
+#if !BA_OPENGL_IS_ES
+    s += "   vec4 pos = instanced ? instanceMatrices[gl_InstanceID]*position "
+         ": position;\n";
+    if (flags & SHD_REFLECTION) {
+      s += "   vec4 norm = instanced ? "
+           "instanceMatrices[gl_InstanceID]*vec4(normal,0.0) "
+           ": vec4(normal,0.0);\n";
+    }
+#else
+    s += "   vec4 pos = position;\n";
+    if (flags & SHD_REFLECTION) {
+      s += "   vec4 norm = vec4(normal,0.0);\n";
+    }
+#endif
     s +=
-        "void main() {\n"
         "   vUV = uv;\n"
-        "   gl_Position = modelViewProjectionMatrix*position;\n"
+        "   gl_Position = modelViewProjectionMatrix*pos;\n"
         "   vScreenCoord = vec4(gl_Position.xy/gl_Position.w,gl_Position.zw);\n"
         "   vScreenCoord.xy += vec2(1.0);\n"
         "   vScreenCoord.xy *= vec2(0.5*vScreenCoord.w);\n";
     if (((flags & SHD_LIGHT_SHADOW) || (flags & SHD_REFLECTION))
         && !(flags & SHD_WORLD_SPACE_PTS)) {
-      s += "   vec4 worldPos = modelWorldMatrix*position;\n";
+      s += "   vec4 worldPos = modelWorldMatrix*pos;\n";
     }
     if (flags & SHD_LIGHT_SHADOW) {
       if (flags & SHD_WORLD_SPACE_PTS)
-        s += "   vLightShadowUV = (lightShadowProjectionMatrix*position);\n";
+        s += "   vLightShadowUV = (lightShadowProjectionMatrix*pos);\n";
       else
         s += "   vLightShadowUV = (lightShadowProjectionMatrix*worldPos);\n";
     }
     if (flags & SHD_REFLECTION) {
       if (flags & SHD_WORLD_SPACE_PTS)
-        s += "   vReflect = reflect(vec3(position - camPos),normal);\n";
+        s += "   vReflect = reflect(vec3(pos - camPos),vec3(norm));\n";
       else
         s += "   vReflect = reflect(vec3(worldPos - "
-             "camPos),normalize(vec3(modelWorldMatrix * vec4(normal,0.0))));\n";
+             "camPos),normalize(vec3(modelWorldMatrix * norm)));\n";
     }
     s += "}";
     if (flags & SHD_DEBUG_PRINT)
@@ -433,6 +433,14 @@ void RendererGL::CheckGLCapabilities_() {
     invalidate_framebuffer_support_ = false;
   }
 
+  // Instanced drawing relies on gl_InstanceID, which our ES shaders (GLSL
+  // ES 1.00) don't have; there we draw instances one by one.
+  instancing_support_ = !gl_is_es();
+  if (auto val = g_core->platform->GetEnv("BA_GL_NO_INSTANCING");
+      val && *val == "1") {
+    instancing_support_ = false;
+  }
+
   combined_texture_image_unit_count_ =
       GLGetInt(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS);
 
@@ -658,6 +666,15 @@ void RendererGL::BindArrayBuffer(GLuint b) {
 void RendererGL::BindTexture_(GLuint type, const TextureAsset* t,
                               GLuint tex_unit) {
   if (t) {
+    // Stand in for textures that aren't uploaded yet with flat grey.
+    if (!t->loaded()) {
+      NotePlaceholderDraw();
+      BindTexture_(type,
+                   type == GL_TEXTURE_CUBE_MAP ? placeholder_cube_tex_
+                                               : placeholder_tex_,
+                   tex_unit);
+      return;
+    }
     auto data = static_cast_check_type<TextureDataGL*>(t->renderer_data());
     BindTexture_(type, data->GetTexture(), tex_unit);
   } else {
@@ -1997,6 +2014,12 @@ void RendererGL::ProcessRenderCommandBuffer(RenderCommandBuffer* buffer,
         int flags = buffer->GetInt();
         const MeshAsset* m = buffer->GetMesh();
         assert(m);
+
+        // Meshes that aren't uploaded yet simply don't draw.
+        if (!m->loaded()) {
+          NotePlaceholderDraw();
+          break;
+        }
         auto mesh =
             static_cast_check_type<MeshAssetDataGL*>(m->renderer_data());
         assert(mesh);
@@ -2014,23 +2037,43 @@ void RendererGL::ProcessRenderCommandBuffer(RenderCommandBuffer* buffer,
         int flags = buffer->GetInt();
         const MeshAsset* m = buffer->GetMesh();
         assert(m);
-        auto mesh =
-            static_cast_check_type<MeshAssetDataGL*>(m->renderer_data());
-        assert(mesh);
         Matrix44f* mats;
         int count;
         mats = buffer->GetMatrices(&count);
+
+        // Meshes that aren't uploaded yet simply don't draw.
+        if (!m->loaded()) {
+          NotePlaceholderDraw();
+          break;
+        }
+        auto mesh =
+            static_cast_check_type<MeshAssetDataGL*>(m->renderer_data());
+        assert(mesh);
         // if they don't wanna draw in reflections...
         if ((flags & kMeshDrawFlagNoReflection) && drawing_reflection()) {
           break;
         }
         mesh->Bind();
-        for (int i = 0; i < count; i++) {
-          g_base->graphics_server->PushTransform();
-          g_base->graphics_server->MultMatrix(mats[i]);
-          GetActiveProgram_()->PrepareToDraw();
-          mesh->Draw();
-          g_base->graphics_server->PopTransform();
+        ProgramGL* p = GetActiveProgram_();
+        if (instancing_support_ && p->uses_instance_matrices()) {
+          // Upload transforms for a batch at a time and draw each batch
+          // with a single call.
+          static_assert(sizeof(Matrix44f) == sizeof(float) * 16);
+          p->PrepareToDraw();
+          for (int i = 0; i < count; i += kMaxGLDrawInstances) {
+            int batch_count = std::min(count - i, kMaxGLDrawInstances);
+            p->SetInstanceMatrices(mats + i, batch_count);
+            mesh->DrawInstanced(batch_count);
+          }
+          p->SetInstanceMatrices(nullptr, 0);
+        } else {
+          for (int i = 0; i < count; i++) {
+            g_base->graphics_server->PushTransform();
+            g_base->graphics_server->MultMatrix(mats[i]);
+            p->PrepareToDraw();
+            mesh->Draw();
+            g_base->graphics_server->PopTransform();
+          }
         }
         break;
       }
@@ -2793,6 +2836,29 @@ void RendererGL::Load() {
     BA_GL_LABEL_OBJECT(GL_TEXTURE, random_tex_, "randomTex");
   }
 
+  // Generate our placeholders for textures that aren't loaded yet.
+  {
+    const unsigned char grey[3] = {128, 128, 128};
+    glGenTextures(1, &placeholder_tex_);
+    BindTexture_(GL_TEXTURE_2D, placeholder_tex_);
+    glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, 1, 1, 0, GL_RGB, GL_UNSIGNED_BYTE,
+                 grey);
+    BA_GL_LABEL_OBJECT(GL_TEXTURE, placeholder_tex_, "placeholderTex");
+
+    glGenTextures(1, &placeholder_cube_tex_);
+    BindTexture_(GL_TEXTURE_CUBE_MAP, placeholder_cube_tex_);
+    glTexParameterf(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameterf(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    for (int i = 0; i < 6; ++i) {
+      glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB, 1, 1, 0,
+                   GL_RGB, GL_UNSIGNED_BYTE, grey);
+    }
+    BA_GL_LABEL_OBJECT(GL_TEXTURE, placeholder_cube_tex_,
+                       "placeholderCubeTex");
+  }
+
   // Generate our vignette tex.
   // TODO(ericf): move this to assets.
   {
@@ -2884,6 +2950,8 @@ void RendererGL::Unload() {
   screen_mesh_.reset();
   if (!g_base->graphics_server->renderer_context_lost()) {
     glDeleteTextures(1, &random_tex_);
+    glDeleteTextures(1, &placeholder_tex_);
+    glDeleteTextures(1, &placeholder_cube_tex_);
     glDeleteTextures(1, &vignette_tex_);
   }
   blur_buffers_.clear();
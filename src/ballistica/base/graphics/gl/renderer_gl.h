@@ -38,6 +38,10 @@ namespace ballistica::base {
 // perhaps can reconsider that since the 3gs was 15 years ago.
 constexpr int kMaxGLTexUnitsUsed = 5;
 
+// Max instances drawn per instanced draw call; their matrices go in a
+// uniform array so we keep this well under minimum uniform limits.
+constexpr int kMaxGLDrawInstances = 32;
+
 class RendererGL : public Renderer {
   class TextureDataGL;
   class MeshAssetDataGL;
@@ -89,7 +93,8 @@ class RendererGL : public Renderer {
     PFLAG_USES_DIFFUSE_ATTR = 1 << 10,
     PFLAG_USES_CAM_ORIENT_MATRIX = 1 << 11,
     PFLAG_USES_MODEL_VIEW_MATRIX = 1 << 12,
-    PFLAG_USES_UV2_ATTR = 1 << 13
+    PFLAG_USES_UV2_ATTR = 1 << 13,
+    PFLAG_USES_INSTANCE_MATRICES = 1 << 14
   };
 
   // Flags affecting shader creation.
@@ -197,6 +202,7 @@ class RendererGL : public Renderer {
   auto invalidate_framebuffer_support() const {
     return invalidate_framebuffer_support_;
   }
+  auto instancing_support() const { return instancing_support_; }
 
   auto msaa_max_samples_rgb565() const {
     assert(msaa_max_samples_rgb565_ != -1);
@@ -275,6 +281,7 @@ class RendererGL : public Renderer {
   bool got_screen_framebuffer_{};
   bool double_sided_{};
   bool invalidate_framebuffer_support_{};
+  bool instancing_support_{};
   bool checked_gl_version_{};
   GLint gl_version_major_{};
   GLint gl_version_minor_{};
@@ -291,6 +298,8 @@ class RendererGL : public Renderer {
   float depth_range_max_{};
   GLint screen_framebuffer_{};
   GLuint random_tex_{};
+  GLuint placeholder_tex_{};
+  GLuint placeholder_cube_tex_{};
   GLuint vignette_tex_{};
   GLint viewport_x_{};
   GLint viewport_y_{};
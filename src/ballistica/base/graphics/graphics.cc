@@ -873,6 +873,11 @@ void Graphics::BuildAndPushFrameDef() {
   frame_def->set_mesh_data_destroys(mesh_data_destroys_);
   mesh_data_destroys_.clear();
 
+  // If an input event being traced has been handled, this is the first
+  // frame that can show its results.
+  frame_def->set_input_latency_sample(
+      g_base->input->latency_tracer()->MarkFramed());
+
   g_base->graphics_server->EnqueueFrameDef(frame_def);
 
   // Clean up frame_defs awaiting deletion.
@@ -4,6 +4,7 @@
 
 #include "ballistica/base/app_adapter/app_adapter.h"
 #include "ballistica/base/graphics/renderer/renderer.h"
+#include "ballistica/base/input/input.h"
 #include "ballistica/base/logic/logic.h"
 #include "ballistica/shared/foundation/event_loop.h"
 
@@ -47,8 +48,11 @@ void GraphicsServer::ApplySettings(const GraphicsSettings* settings) {
 
   // Pull a few things out ourself such as screen resolution.
   tv_border_ = settings->tv_border;
+  dynamic_resolution_.Configure(
+      settings->dynamic_resolution, settings->dynamic_resolution_min_scale,
+      settings->pixel_scale, settings->dynamic_resolution_target_fps);
   if (renderer_) {
-    renderer_->set_pixel_scale(settings->pixel_scale);
+    renderer_->set_pixel_scale(dynamic_resolution_.scale());
   }
   // Note: not checking virtual res here; assuming it only changes when
   // actual res changes.
@@ -123,10 +127,26 @@ auto GraphicsServer::TryRender() -> bool {
     // Only actually render if we have a screen and aren't in a hold.
     auto target = renderer()->screen_render_target();
     if (target != nullptr && render_hold_ == 0) {
+      microsecs_t render_start_time = g_core->GetAppTimeMicrosecs();
       PreprocessRenderFrameDef(frame_def);
       DrawRenderFrameDef(frame_def);
       FinishRenderFrameDef(frame_def);
       success = true;
+
+      // Let dynamic-resolution react to how long this frame took to
+      // render (not counting any vsync or max-fps waits, which happen
+      // outside of here); any new scale applies from the next frame on.
+      microsecs_t render_end_time = g_core->GetAppTimeMicrosecs();
+      if (dynamic_resolution_.OnFrame(render_end_time,
+                                      render_end_time - render_start_time)) {
+        renderer()->set_pixel_scale(dynamic_resolution_.scale());
+      }
+      g_base->input->latency_tracer()->MarkRendered(
+          frame_def->input_latency_sample(),
+          g_base->app_adapter->ReportsFramePresents());
+    } else {
+      g_base->input->latency_tracer()->AbandonSample(
+          frame_def->input_latency_sample());
     }
 
     // Send this frame_def back to the logic thread for deletion or recycling.
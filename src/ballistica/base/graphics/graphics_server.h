@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "ballistica/base/base.h"
+#include "ballistica/base/graphics/support/dynamic_resolution.h"
 #include "ballistica/shared/foundation/object.h"
 #include "ballistica/shared/generic/snapshot.h"
 #include "ballistica/shared/math/matrix44f.h"
@@ -54,6 +55,11 @@ class GraphicsServer {
 
   void ApplySettings(const GraphicsSettings* settings);
 
+  /// Controller for frame-time-driven pixel-scale adjustment.
+  auto dynamic_resolution() const -> const DynamicResolution& {
+    return dynamic_resolution_;
+  }
+
   void PushReloadMediaCall();
   void PushRemoveRenderHoldCall();
   void PushComponentUnloadCall(
@@ -355,6 +361,7 @@ class GraphicsServer {
   std::list<MeshData*> mesh_datas_;
   Renderer* renderer_{};
   FrameDef* frame_def_{};
+  DynamicResolution dynamic_resolution_;
   std::mutex frame_def_mutex_{};
 };
 
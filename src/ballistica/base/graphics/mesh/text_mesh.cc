@@ -2,6 +2,8 @@
 
 #include "ballistica/base/graphics/mesh/text_mesh.h"
 
+#include <algorithm>
+
 #include "ballistica/base/graphics/text/text_graphics.h"
 #include "ballistica/base/graphics/text/text_packer.h"
 #include "ballistica/shared/generic/utils.h"
@@ -10,18 +12,51 @@ namespace ballistica::base {
 
 TextMesh::TextMesh() : MeshIndexedDualTextureFull(MeshDrawType::kStatic) {}
 
+// Texts longer than this don't get stored in the shared geometry cache.
+const size_t kTextMeshCacheMaxTextSize = 512;
+
 void TextMesh::SetText(const std::string& text_in, HAlign alignment_h,
                        VAlign alignment_v, bool big, uint32_t min_val,
                        uint32_t max_val, TextMeshEntryType entry_type,
                        TextPacker* packer) {
-  if (text_in == text_) {
-    // Covers corner case where we assign a new string to empty.
-    if (text_in.empty()) {
-      SetEmpty();
-    }
+  bool same_layout = built_ && alignment_h == alignment_h_
+                     && alignment_v == alignment_v_ && big == big_
+                     && min_val == min_val_ && max_val == max_val_
+                     && entry_type == entry_type_;
+
+  // If we're already showing exactly this, we're done. (OS-rendered text
+  // always needs to be rebuilt since the packer needs filling).
+  if (same_layout && packer == nullptr && text_in == text_) {
     return;
   }
+
+  // If we're left/top aligned, nothing already laid out can move when
+  // later chars change. So if our new text starts the same as our old
+  // (appends, edits, or truncations) we can keep the geometry for that
+  // part and lay out only the rest.
+  Object::Ref<TextMeshGeometry> prev_geometry;
+  const TextMeshGeometry::Checkpoint* resume{};
+  if (same_layout && packer == nullptr && geometry_.Exists()
+      && alignment_h == HAlign::kLeft
+      && (alignment_v == VAlign::kNone || alignment_v == VAlign::kTop)) {
+    auto common = std::mismatch(text_.begin(), text_.end(), text_in.begin(),
+                                text_in.end());
+    resume = geometry_->GetCheckpoint(
+        static_cast<size_t>(common.first - text_.begin()));
+    if (resume) {
+      prev_geometry = geometry_;
+    }
+  }
+
   text_ = text_in;
+  alignment_h_ = alignment_h;
+  alignment_v_ = alignment_v;
+  big_ = big;
+  min_val_ = min_val;
+  max_val_ = max_val;
+  entry_type_ = entry_type;
+  built_ = true;
+  geometry_.Clear();
 
   assert(Utils::IsValidUTF8(text_));
 
@@ -33,6 +68,29 @@ void TextMesh::SetText(const std::string& text_in, HAlign alignment_h,
     return;
   }
 
+  // Identical text with identical layout comes up constantly across
+  // widgets and nodes; reuse geometry we've already generated for it.
+  std::string cache_key;
+  if (packer == nullptr && text_in.size() <= kTextMeshCacheMaxTextSize) {
+    cache_key = std::to_string(static_cast<int>(alignment_h)) + ":"
+                + std::to_string(static_cast<int>(alignment_v)) + ":"
+                + std::to_string(static_cast<int>(big)) + ":"
+                + std::to_string(min_val) + ":" + std::to_string(max_val)
+                + ":" + std::to_string(static_cast<int>(entry_type)) + ":"
+                + text_in;
+    if (TextMeshGeometry* geometry =
+            g_base->text_graphics->GetCachedTextMeshGeometry(cache_key)) {
+      geometry_ = geometry;
+      SetGeometry_(*geometry);
+      return;
+    }
+  }
+  if (prev_geometry.Exists()) {
+    g_base->text_graphics->IncrementTextMeshIncrementalBuildCount();
+  } else {
+    g_base->text_graphics->IncrementTextMeshFullBuildCount();
+  }
+
   if (entry_type == TextMeshEntryType::kOSRendered) {
     assert(packer != nullptr);
   }
@@ -128,6 +186,38 @@ void TextMesh::SetText(const std::string& text_in, HAlign alignment_h,
 
   std::vector<uint32_t> os_span;
 
+  // Record layout state as we go so we can be partially rebuilt later.
+  Object::Ref<TextMeshGeometry> geometry;
+  if (packer == nullptr && index16) {
+    geometry = Object::New<TextMeshGeometry>();
+  }
+  const uint16_t* index16_start = index16;
+  const VertexDualTextureFull* v_start = v;
+
+  // When resuming, start with our previous geometry and layout state for
+  // the part of our text that hasn't changed.
+  if (resume) {
+    assert(geometry.Exists());
+    std::copy(prev_geometry->indices.begin(),
+              prev_geometry->indices.begin() + resume->index_count, index16);
+    index16 += resume->index_count;
+    std::copy(prev_geometry->vertices.begin(),
+              prev_geometry->vertices.begin() + resume->vertex_count, v);
+    v += resume->vertex_count;
+    index_offset = resume->vertex_count;
+    x_offset = resume->x_offset;
+    y_offset = resume->y_offset;
+    tc = txt + resume->text_pos;
+    first_char = false;
+    auto end = std::upper_bound(
+        prev_geometry->checkpoints.begin(), prev_geometry->checkpoints.end(),
+        resume->text_pos,
+        [](uint32_t pos, const TextMeshGeometry::Checkpoint& checkpoint) {
+          return pos < checkpoint.text_pos;
+        });
+    geometry->checkpoints.assign(prev_geometry->checkpoints.begin(), end);
+  }
+
   while (*tc != 0) {
     const char* tc_prev = tc;
 
@@ -343,6 +433,16 @@ void TextMesh::SetText(const std::string& text_in, HAlign alignment_h,
         break;
       }
     }
+
+    // We can resume from here as long as we're not partway through an
+    // OS-text span.
+    if (geometry.Exists() && os_span.empty()) {
+      geometry->checkpoints.push_back(
+          {static_cast<uint32_t>(tc - txt),
+           static_cast<uint32_t>(v - v_start),
+           static_cast<uint32_t>(index16 - index16_start), x_offset,
+           y_offset});
+    }
   }
 
   // Commit any final OS-text span (can skip this if we're not
@@ -534,6 +634,15 @@ void TextMesh::SetText(const std::string& text_in, HAlign alignment_h,
   }
   vertices->elements.resize(v - (&(vertices->elements[0])));
 
+  if (geometry.Exists()) {
+    geometry->indices = indices16->elements;
+    geometry->vertices = vertices->elements;
+    geometry_ = geometry;
+    if (!cache_key.empty()) {
+      g_base->text_graphics->CacheTextMeshGeometry(cache_key, geometry);
+    }
+  }
+
   // Either set data or abort if empty.
   if (index16 && !indices16->elements.empty()) {
     SetIndexData(indices16);
@@ -566,4 +675,24 @@ void TextMesh::SetText(const std::string& text_in, HAlign alignment_h,
   }
 }
 
+auto TextMeshGeometry::GetCheckpoint(size_t text_pos) const
+    -> const Checkpoint* {
+  auto i = std::upper_bound(checkpoints.begin(), checkpoints.end(), text_pos,
+                            [](size_t pos, const Checkpoint& checkpoint) {
+                              return pos < checkpoint.text_pos;
+                            });
+  return i == checkpoints.begin() ? nullptr : &*(i - 1);
+}
+
+void TextMesh::SetGeometry_(const TextMeshGeometry& geometry) {
+  if (geometry.indices.empty()) {
+    SetEmpty();
+    return;
+  }
+  SetIndexData(Object::New<MeshIndexBuffer16>(geometry.indices.size(),
+                                              geometry.indices.data()));
+  SetData(Object::New<MeshBuffer<VertexDualTextureFull>>(
+      geometry.vertices.size(), geometry.vertices.data()));
+}
+
 }  // namespace ballistica::base
@@ -4,11 +4,33 @@
 #define BALLISTICA_BASE_GRAPHICS_MESH_TEXT_MESH_H_
 
 #include <string>
+#include <vector>
 
 #include "ballistica/base/graphics/mesh/mesh_indexed_dual_texture_full.h"
 
 namespace ballistica::base {
 
+// Geometry generated by a TextMesh. Along with the final vertex data this
+// stores the layout state after each char, so text with an unchanged
+// beginning can be rebuilt from the first changed char onward.
+class TextMeshGeometry : public Object {
+ public:
+  struct Checkpoint {
+    uint32_t text_pos;  // Byte offset just past the char.
+    uint32_t vertex_count;
+    uint32_t index_count;
+    float x_offset;
+    float y_offset;
+  };
+
+  // Return the last checkpoint at or before a byte offset, or nullptr.
+  auto GetCheckpoint(size_t text_pos) const -> const Checkpoint*;
+
+  std::vector<VertexDualTextureFull> vertices;
+  std::vector<uint16_t> indices;
+  std::vector<Checkpoint> checkpoints;
+};
+
 // A mesh set up to draw text. In general you should not use this directly;
 // use TextGroup, which will automatically handle switching meshes/textures
 // in order to support the full unicode range.
@@ -23,7 +45,19 @@ class TextMesh : public MeshIndexedDualTextureFull {
   auto text() const -> const std::string& { return text_; }
 
  private:
+  void SetGeometry_(const TextMeshGeometry& geometry);
   std::string text_;
+  HAlign alignment_h_{};
+  VAlign alignment_v_{};
+  bool big_{};
+  bool built_{};
+  uint32_t min_val_{};
+  uint32_t max_val_{};
+  TextMeshEntryType entry_type_{};
+
+  // Geometry we most recently built (if any); used to rebuild only the
+  // changed part of our text when possible.
+  Object::Ref<TextMeshGeometry> geometry_;
 };
 
 }  // namespace ballistica::base
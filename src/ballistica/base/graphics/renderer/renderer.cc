@@ -23,6 +23,11 @@ static bool have_renderer = false;
 Renderer::Renderer() {
   assert(!have_renderer);
   have_renderer = true;
+
+  // Allow going back to stalling until everything is loaded (useful for
+  // screenshots and whatnot where pop-in is unwanted).
+  auto val = g_core->platform->GetEnv("BA_RENDERER_BLOCKING_MEDIA_LOADS");
+  blocking_media_loads_ = val && *val == "1";
 }
 
 Renderer::~Renderer() {
@@ -646,13 +651,41 @@ void Renderer::UpdatePixelScaleAndBackingBuffer(FrameDef* frame_def) {
 
 void Renderer::LoadMedia(FrameDef* frame_def) {
   millisecs_t t = g_core->GetAppTimeMillisecs();
+  microsecs_t start_time = g_core->GetAppTimeMicrosecs();
+  int uploads{};
   for (auto&& i : frame_def->media_components()) {
     Asset* mc = i.Get();
     assert(mc);
-    mc->Load();
 
-    // Also mark them as used so they get kept around for a bit.
+    // Mark them as used so they get kept around for a bit.
     mc->set_last_used_time(t);
+
+    // Only the graphics thread loads/unloads renderer media, so this
+    // can't change out from under us.
+    if (mc->loaded()) {
+      continue;
+    }
+    if (blocking_media_loads_) {
+      mc->Load();
+      continue;
+    }
+
+    // Rather than stalling the frame, anything still preloading (it will
+    // already be queued for that), or beyond our upload budget gets drawn
+    // as a placeholder this time around. RunPendingGraphicsLoads() and
+    // subsequent frames will get it uploaded.
+    if (!mc->preloaded()
+        || (uploads > 0
+            && g_core->GetAppTimeMicrosecs() - start_time
+                   > kMediaUploadBudgetMicrosecs)
+        || !mc->TryLock()) {
+      media_deferred_count_++;
+      continue;
+    }
+    Asset::LockGuard lock(mc, Asset::LockGuard::kInheritLock);
+    mc->Load(true);
+    uploads++;
+    media_upload_count_++;
   }
 }
 
@@ -3,6 +3,7 @@
 #ifndef BALLISTICA_BASE_GRAPHICS_RENDERER_RENDERER_H_
 #define BALLISTICA_BASE_GRAPHICS_RENDERER_RENDERER_H_
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
@@ -43,6 +44,11 @@
 
 namespace ballistica::base {
 
+/// Roughly how much time per frame we'll spend uploading media that a
+/// frame needs but which isn't resident yet. At least one upload always
+/// happens per frame so we keep making progress.
+const microsecs_t kMediaUploadBudgetMicrosecs{4000};
+
 // The renderer is responsible for converting a frame_def to onscreen pixels
 class Renderer {
  public:
@@ -85,6 +91,21 @@ class Renderer {
   void set_debug_draw_mode(bool debugModeIn) { debug_draw_mode_ = debugModeIn; }
   auto debug_draw_mode() -> bool { return debug_draw_mode_; }
 
+  /// Media uploads done by LoadMedia(), media it put off (because it was
+  /// still preloading or we were out of upload budget), and draws that
+  /// used a placeholder as a result. Can be read from any thread.
+  auto media_upload_count() const -> int64_t { return media_upload_count_; }
+  auto media_deferred_count() const -> int64_t {
+    return media_deferred_count_;
+  }
+  auto placeholder_draw_count() const -> int64_t {
+    return placeholder_draw_count_;
+  }
+
+  /// Renderer implementations call this when substituting a placeholder
+  /// for a texture or mesh that isn't loaded.
+  void NotePlaceholderDraw() { placeholder_draw_count_++; }
+
   // Used when recreating contexts.
   virtual void Unload();
   virtual void Load();
@@ -257,6 +278,10 @@ class Renderer {
   bool dof_delay_{true};
   bool drawing_reflection_{};
   bool shadow_ortho_{};
+  bool blocking_media_loads_{};
+  std::atomic<int64_t> media_upload_count_{};
+  std::atomic<int64_t> media_deferred_count_{};
+  std::atomic<int64_t> placeholder_draw_count_{};
 
   int last_commands_buffer_size_{};
   int last_f_vals_buffer_size_{};
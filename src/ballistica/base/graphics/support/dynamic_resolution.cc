@@ -0,0 +1,117 @@
+// Released under the MIT License. See LICENSE for details.
+
+#include "ballistica/base/graphics/support/dynamic_resolution.h"
+
+#include <algorithm>
+
+namespace ballistica::base {
+
+// Frames taking longer than the target frame time to render by this
+// factor count as over budget and frames within this factor of it as
+// having headroom. The gap between
+// the two is our hysteresis band.
+const float kDynResOverBudgetFactor{1.15f};
+const float kDynResHeadroomFactor{1.05f};
+
+// We drop fast and climb back slowly.
+const float kDynResLowerStep{0.1f};
+const float kDynResRaiseStep{0.05f};
+
+// Minimum time between changes, giving our average time to settle at
+// the new scale.
+const microsecs_t kDynResChangeInterval{500000};
+
+// How long we need steady headroom before raising the scale; this
+// doubles each time a raise has to be backed out again.
+const microsecs_t kDynResRaiseDelayMin{3000000};
+const microsecs_t kDynResRaiseDelayMax{60000000};
+
+// Having to lower within this long after a raise means the raise
+// was a mistake.
+const microsecs_t kDynResRaiseProbeTime{3000000};
+
+// Gaps longer than this are pauses/hitches (app suspended, loading,
+// etc.) and not something resolution can help with.
+const microsecs_t kDynResMaxFrameInterval{250000};
+
+void DynamicResolution::Configure(bool enabled, float min_scale,
+                                  float max_scale, int target_fps) {
+  max_scale_ = std::clamp(max_scale, 0.1f, 1.0f);
+  min_scale_ = std::clamp(min_scale, 0.1f, max_scale_);
+  target_fps_ = std::max(1, target_fps);
+  enabled_ = enabled;
+  if (!enabled) {
+    scale_ = max_scale_;
+    average_render_time_ = 0;
+  } else {
+    scale_ = std::clamp(scale_.load(), min_scale_, max_scale_);
+  }
+  raise_delay_ = kDynResRaiseDelayMin;
+  headroom_start_time_ = 0;
+  last_frame_time_ = 0;
+}
+
+auto DynamicResolution::OnFrame(microsecs_t now, microsecs_t render_time)
+    -> bool {
+  if (!enabled_) {
+    return false;
+  }
+  // We only look at the gap between frames to notice pauses; a frame
+  // right after one says nothing about steady-state cost.
+  microsecs_t interval = now - last_frame_time_;
+  bool valid = last_frame_time_ != 0 && interval > 0
+               && interval < kDynResMaxFrameInterval && render_time >= 0
+               && render_time < kDynResMaxFrameInterval;
+  last_frame_time_ = now;
+  if (!valid) {
+    headroom_start_time_ = 0;
+    return false;
+  }
+
+  // Exponential moving average over roughly the last 10 frames.
+  microsecs_t avg = average_render_time_;
+  avg = avg == 0 ? render_time : avg + (render_time - avg) / 10;
+  average_render_time_ = avg;
+
+  auto target = static_cast<float>(1000000 / target_fps_);
+  float scale = scale_;
+
+  if (static_cast<float>(avg) > target * kDynResOverBudgetFactor) {
+    headroom_start_time_ = 0;
+    if (scale > min_scale_
+        && now - last_change_time_ >= kDynResChangeInterval) {
+      if (last_raise_time_ != 0
+          && now - last_raise_time_ < kDynResRaiseProbeTime) {
+        raise_delay_ = std::min(raise_delay_ * 2, kDynResRaiseDelayMax);
+      }
+      SetScale_(std::max(min_scale_, scale - kDynResLowerStep), now);
+      return true;
+    }
+    return false;
+  }
+
+  if (static_cast<float>(avg) > target * kDynResHeadroomFactor
+      || scale >= max_scale_) {
+    headroom_start_time_ = 0;
+    return false;
+  }
+  if (headroom_start_time_ == 0) {
+    headroom_start_time_ = now;
+  }
+  if (now - headroom_start_time_ >= raise_delay_
+      && now - last_change_time_ >= kDynResChangeInterval) {
+    SetScale_(std::min(max_scale_, scale + kDynResRaiseStep), now);
+    last_raise_time_ = now;
+    headroom_start_time_ = 0;
+    return true;
+  }
+  return false;
+}
+
+void DynamicResolution::SetScale_(float scale, microsecs_t now) {
+  scale_ = scale;
+  last_change_time_ = now;
+  change_count_++;
+}
+
+}  // namespace ballistica::base
@@ -0,0 +1,63 @@
+// Released under the MIT License. See LICENSE for details.
+
+#ifndef BALLISTICA_BASE_GRAPHICS_SUPPORT_DYNAMIC_RESOLUTION_H_
+#define BALLISTICA_BASE_GRAPHICS_SUPPORT_DYNAMIC_RESOLUTION_H_
+
+#include <atomic>
+
+#include "ballistica/base/base.h"
+
+namespace ballistica::base {
+
+/// Adjusts the renderer's pixel-scale to hold a target frame rate.
+///
+/// Fed the time spent rendering each frame, this drops the scale in
+/// coarse steps when rendering is running over the frame budget and
+/// creeps it back up in finer steps once there has been headroom for a
+/// while. Each change rebuilds render targets, so whenever raising the
+/// scale promptly turns out to be too much we wait longer before trying
+/// that again, which keeps us from bouncing between two scales forever.
+///
+/// Only render work counts against the budget; time spent waiting on
+/// vsync or a Max FPS limit between frames does not, so those never
+/// push the scale down on their own.
+class DynamicResolution {
+ public:
+  /// Set bounds and target; the current scale is clamped to the new
+  /// bounds (and reset to max_scale when disabled).
+  void Configure(bool enabled, float min_scale, float max_scale,
+                 int target_fps);
+
+  /// Call once per rendered frame with the time it finished and how long
+  /// rendering it took. Returns true if scale() changed.
+  auto OnFrame(microsecs_t now, microsecs_t render_time) -> bool;
+
+  // These are all safe to read from any thread.
+  auto enabled() const -> bool { return enabled_; }
+  auto scale() const -> float { return scale_; }
+  auto target_fps() const -> int { return target_fps_; }
+  auto average_render_time() const -> microsecs_t {
+    return average_render_time_;
+  }
+  auto change_count() const -> int64_t { return change_count_; }
+
+ private:
+  void SetScale_(float scale, microsecs_t now);
+
+  std::atomic<bool> enabled_{};
+  std::atomic<float> scale_{1.0f};
+  std::atomic<int> target_fps_{60};
+  std::atomic<microsecs_t> average_render_time_{};
+  std::atomic<int64_t> change_count_{};
+  float min_scale_{0.5f};
+  float max_scale_{1.0f};
+  microsecs_t last_frame_time_{};
+  microsecs_t last_change_time_{};
+  microsecs_t last_raise_time_{};
+  microsecs_t headroom_start_time_{};
+  microsecs_t raise_delay_{};
+};
+
+}  // namespace ballistica::base
+
+#endif  // BALLISTICA_BASE_GRAPHICS_SUPPORT_DYNAMIC_RESOLUTION_H_
@@ -60,6 +60,7 @@ void FrameDef::Reset() {
   display_time_microsecs_ = 0;
   display_time_elapsed_microsecs_ = 0;
   frame_number_ = 0;
+  input_latency_sample_ = 0;
 
 #if BA_DEBUG_BUILD
   defining_component_ = false;
@@ -160,6 +160,10 @@ class FrameDef {
   void set_frame_number(int64_t val) { frame_number_ = val; }
   void set_frame_number_filtered(int64_t val) { frame_number_filtered_ = val; }
 
+  /// Input-latency sample this frame is carrying (0 for none).
+  auto input_latency_sample() const { return input_latency_sample_; }
+  void set_input_latency_sample(int val) { input_latency_sample_ = val; }
+
   auto overlay_flat_pass() const -> RenderPass* {
     return overlay_flat_pass_.get();
   }
@@ -271,6 +275,7 @@ class FrameDef {
   microsecs_t display_time_elapsed_millisecs_{};
   int64_t frame_number_{};
   int64_t frame_number_filtered_{};
+  int input_latency_sample_{};
   Vector3f shadow_offset_{0.0f, 0.0f, 0.0f};
   Vector2f shadow_scale_{1.0f, 1.0f};
   Vector3f tint_{1.0f, 1.0f, 1.0f};
@@ -18,6 +18,14 @@ GraphicsSettings::GraphicsSettings()
       pixel_scale{std::clamp(
           g_base->app_config->Resolve(AppConfig::FloatID::kScreenPixelScale),
           0.1f, 1.0f)},
+      dynamic_resolution{
+          g_base->app_config->Resolve(AppConfig::BoolID::kDynamicResolution)},
+      dynamic_resolution_min_scale{std::clamp(
+          g_base->app_config->Resolve(
+              AppConfig::FloatID::kDynamicResolutionMinScale),
+          0.1f, 1.0f)},
+      dynamic_resolution_target_fps{g_base->app_config->Resolve(
+          AppConfig::IntID::kDynamicResolutionTargetFPS)},
       graphics_quality{g_base->graphics->GraphicsQualityFromAppConfig()},
       texture_quality{g_base->graphics->TextureQualityFromAppConfig()},
       tv_border{
@@ -23,6 +23,12 @@ struct GraphicsSettings {
   Vector2f resolution;
   Vector2f resolution_virtual;
   float pixel_scale;
+
+  // When enabled, pixel_scale becomes the upper bound and the graphics
+  // server adjusts the scale within it to hold the target frame rate.
+  bool dynamic_resolution;
+  float dynamic_resolution_min_scale;
+  int dynamic_resolution_target_fps;
   GraphicsQualityRequest graphics_quality;
   TextureQualityRequest texture_quality;
   bool tv_border;
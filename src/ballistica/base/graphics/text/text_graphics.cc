@@ -2,6 +2,7 @@
 
 #include "ballistica/base/graphics/text/text_graphics.h"
 
+#include "ballistica/base/graphics/mesh/text_mesh.h"
 #include "ballistica/base/graphics/text/font_page_map_data.h"
 #include "ballistica/core/platform/core_platform.h"
 #include "ballistica/shared/generic/utils.h"
@@ -19,6 +20,14 @@ class TextGraphics::TextSpanBoundsCacheEntry : public Object {
   std::list<Object::Ref<TextSpanBoundsCacheEntry>>::iterator list_iterator_;
 };
 
+class TextGraphics::TextMeshCacheEntry : public Object {
+ public:
+  Object::Ref<TextMeshGeometry> geometry;
+  std::unordered_map<std::string, Object::Ref<TextMeshCacheEntry>>::iterator
+      map_iterator_;
+  std::list<Object::Ref<TextMeshCacheEntry>>::iterator list_iterator_;
+};
+
 TextGraphics::TextGraphics() {
   // Init glyph values for our custom font pages
   // (just a 5x5 array currently).
@@ -1052,6 +1061,49 @@ void TextGraphics::GetOSTextSpanBoundsAndWidth(const std::string& s, Rect* r,
   }
 }
 
+auto TextGraphics::GetCachedTextMeshGeometry(const std::string& key)
+    -> TextMeshGeometry* {
+  assert(g_base->InLogicThread());
+
+  auto i = text_mesh_cache_map_.find(key);
+  if (i == text_mesh_cache_map_.end()) {
+    text_mesh_cache_miss_count_++;
+    return nullptr;
+  }
+  text_mesh_cache_hit_count_++;
+  auto entry = Object::Ref<TextMeshCacheEntry>(i->second);
+
+  // Send this entry to the back of the list since we used it.
+  text_mesh_cache_.erase(entry->list_iterator_);
+  entry->list_iterator_ =
+      text_mesh_cache_.insert(text_mesh_cache_.end(), entry);
+  return entry->geometry.Get();
+}
+
+void TextGraphics::CacheTextMeshGeometry(
+    const std::string& key, const Object::Ref<TextMeshGeometry>& geometry) {
+  assert(g_base->InLogicThread());
+  assert(geometry.Exists());
+
+  auto i = text_mesh_cache_map_.find(key);
+  if (i != text_mesh_cache_map_.end()) {
+    i->second->geometry = geometry;
+    return;
+  }
+  auto entry(Object::New<TextMeshCacheEntry>());
+  entry->geometry = geometry;
+  entry->list_iterator_ =
+      text_mesh_cache_.insert(text_mesh_cache_.end(), entry);
+  entry->map_iterator_ =
+      text_mesh_cache_map_.insert(std::make_pair(key, entry)).first;
+
+  // Keep cache from growing too large.
+  while (text_mesh_cache_.size() > 250) {
+    text_mesh_cache_map_.erase(text_mesh_cache_.front()->map_iterator_);
+    text_mesh_cache_.pop_front();
+  }
+}
+
 auto TextGraphics::GetStringWidth(const char* text, bool big) -> float {
   assert(Utils::IsValidUTF8(text));
 
@@ -15,6 +15,8 @@
 
 namespace ballistica::base {
 
+class TextMeshGeometry;
+
 // Largest unicode value we ask the OS to draw for us.
 const int kTextMaxUnicodeVal = 999999;
 const float kTextRowHeight = 32.0f;
@@ -78,6 +80,34 @@ class TextGraphics {
   void BreakUpString(const char* text, float width,
                      std::vector<std::string>* v);
 
+  // Returns previously generated text-mesh geometry for a key, or nullptr.
+  auto GetCachedTextMeshGeometry(const std::string& key) -> TextMeshGeometry*;
+
+  // Store generated text-mesh geometry for later reuse under a key.
+  void CacheTextMeshGeometry(const std::string& key,
+                             const Object::Ref<TextMeshGeometry>& geometry);
+
+  // Stats for text geometry generation.
+  void IncrementTextGroupReuseCount() { text_group_reuse_count_++; }
+  void IncrementTextMeshIncrementalBuildCount() {
+    text_mesh_incremental_build_count_++;
+  }
+  void IncrementTextMeshFullBuildCount() { text_mesh_full_build_count_++; }
+  auto text_group_reuse_count() const { return text_group_reuse_count_; }
+  auto text_mesh_cache_hit_count() const { return text_mesh_cache_hit_count_; }
+  auto text_mesh_cache_miss_count() const {
+    return text_mesh_cache_miss_count_;
+  }
+  auto text_mesh_incremental_build_count() const {
+    return text_mesh_incremental_build_count_;
+  }
+  auto text_mesh_full_build_count() const {
+    return text_mesh_full_build_count_;
+  }
+  auto text_mesh_cache_size() const {
+    return static_cast<int>(text_mesh_cache_.size());
+  }
+
   // Some chars we allow the OS to draw in some cases but draw ourselves in
   // others (to minimize the amount of switching back and forth).
   static auto IsOSDrawableAscii(int val) -> bool {
@@ -91,6 +121,7 @@ class TextGraphics {
 
  private:
   class TextSpanBoundsCacheEntry;
+  class TextMeshCacheEntry;
   void LoadGlyphPage(uint32_t index);
 
   // Map of entries for fast lookup.
@@ -99,6 +130,16 @@ class TextGraphics {
 
   // List of entries for sorting by last-use-time
   std::list<Object::Ref<TextSpanBoundsCacheEntry> > text_span_bounds_cache_;
+
+  // Same deal for generated text-mesh geometry.
+  std::unordered_map<std::string, Object::Ref<TextMeshCacheEntry> >
+      text_mesh_cache_map_;
+  std::list<Object::Ref<TextMeshCacheEntry> > text_mesh_cache_;
+  int64_t text_group_reuse_count_{};
+  int64_t text_mesh_cache_hit_count_{};
+  int64_t text_mesh_cache_miss_count_{};
+  int64_t text_mesh_incremental_build_count_{};
+  int64_t text_mesh_full_build_count_{};
   std::mutex glyph_load_mutex_;
   Glyph glyphs_extras_[100]{};
   Glyph glyphs_big_[64]{};
@@ -8,10 +8,26 @@
 
 namespace ballistica::base {
 
+// Pseudo font-page value for our single big-font entry.
+const int kBigFontPage = -1;
+
 void TextGroup::SetText(const std::string& text, TextMesh::HAlign alignment_h,
                         TextMesh::VAlign alignment_v, bool big,
                         float resolution_scale) {
+  // Lots of things (score counters, timers, etc.) re-set their text every
+  // frame whether or not it has changed; make that case cheap.
+  if (built_ && text == text_ && alignment_h == alignment_h_
+      && alignment_v == alignment_v_ && resolution_scale == resolution_scale_
+      && big == big_requested_) {
+    g_base->text_graphics->IncrementTextGroupReuseCount();
+    return;
+  }
   text_ = text;
+  alignment_h_ = alignment_h;
+  alignment_v_ = alignment_v;
+  resolution_scale_ = resolution_scale;
+  big_requested_ = big;
+  built_ = true;
 
   // In order to *actually* draw big, all our letters
   // must be available in the big font.
@@ -22,11 +38,27 @@ void TextGroup::SetText(const std::string& text, TextMesh::HAlign alignment_h,
   // the same one if we havn't changed.
   os_texture_.Clear();
 
+  // Hang on to our existing entries so we can reuse meshes for any font
+  // pages we still need; this lets them skip work when their text is
+  // unchanged or has simply been appended to.
+  std::vector<std::unique_ptr<TextMeshEntry>> old_entries;
+  old_entries.swap(entries_);
+  auto get_entry = [&old_entries](int font_page) {
+    for (auto&& old_entry : old_entries) {
+      if (old_entry && old_entry->font_page == font_page) {
+        return std::move(old_entry);
+      }
+    }
+    auto entry{std::make_unique<TextMeshEntry>()};
+    entry->font_page = font_page;
+    return entry;
+  };
+
   // If we're drawing big we always just need 1 font page (the big one).
   if (big_) {
     // Now create entries for each page we use.
-    entries_.clear();
-    std::unique_ptr<TextMeshEntry> entry(new TextMeshEntry());
+    auto entry{get_entry(kBigFontPage)};
+    entry->type = TextMeshEntryType::kRegular;
     entry->u_scale = entry->v_scale = 1.5f;
     entry->can_color = true;
     entry->max_flatness = 1.0f;
@@ -46,11 +78,10 @@ void TextGroup::SetText(const std::string& text, TextMesh::HAlign alignment_h,
     // (we iterate this in reverse so that our custom pages draw first;
     // we want that stuff to show up underneath normal text since we
     // sometimes use it as backing elements,etc)
-    entries_.clear();
     for (auto i = font_pages.rbegin(); i != font_pages.rend(); i++) {
       uint32_t min, max;
       g_base->text_graphics->GetFontPageCharRange(*i, &min, &max);
-      std::unique_ptr<TextMeshEntry> entry(new TextMeshEntry());
+      auto entry{get_entry(*i)};
 
       // Our custom font page IDs start at value 9990 (kExtras1);
       // make sure for all private-use unicode chars (U+E000–U+F8FF)
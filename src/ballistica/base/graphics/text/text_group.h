@@ -76,6 +76,7 @@ class TextGroup : public Object {
 
  private:
   struct TextMeshEntry {
+    int font_page;
     TextMeshEntryType type;
     Object::Ref<TextureAsset> tex;
     TextMesh mesh;
@@ -87,7 +88,12 @@ class TextGroup : public Object {
   Object::Ref<TextureAsset> os_texture_;
   std::vector<std::unique_ptr<TextMeshEntry>> entries_;
   std::string text_;
+  TextMesh::HAlign alignment_h_{};
+  TextMesh::VAlign alignment_v_{};
+  float resolution_scale_{};
+  bool big_requested_{};
   bool big_{};
+  bool built_{};
 };
 
 }  // namespace ballistica::base
@@ -5,11 +5,10 @@
 #include "ballistica/base/input/device/joystick_input.h"
 #include "ballistica/base/input/input.h"
 #include "ballistica/base/ui/ui.h"
-#include "ballistica/shared/math/random.h"
 
 namespace ballistica::base {
 
-TestInput::TestInput() {
+TestInput::TestInput(uint32_t seed) : rng_(seed) {
   // In attract-mode (pretty demos) we want this to look more like
   // real people connecting to the game, so just say 'Controller'.
   const char* device_name =
@@ -28,6 +27,10 @@ TestInput::~TestInput() {
   g_base->input->PushRemoveInputDeviceCall(joystick_, true);
 }
 
+auto TestInput::RandomFloat_() -> float {
+  return std::uniform_real_distribution<float>(0.0f, 1.0f)(rng_);
+}
+
 void TestInput::Reset() {
   assert(g_base->InLogicThread());
   reset_ = true;
@@ -56,7 +59,7 @@ void TestInput::Process(millisecs_t time) {
   }
 
   if (time > next_event_time_) {
-    next_event_time_ = time + static_cast<int>(RandomFloat() * 300.0f);
+    next_event_time_ = time + static_cast<int>(RandomFloat_() * 300.0f);
 
     // Do absolutely nothing before join start time.
     if (time < join_start_time_) {
@@ -68,23 +71,23 @@ void TestInput::Process(millisecs_t time) {
       return;
     }
 
-    float r = RandomFloat();
+    float r = RandomFloat_();
 
     SDL_Event e;
     if (r < 0.5f) {
       // Movement change.
-      r = RandomFloat();
+      r = RandomFloat_();
       if (r < 0.3f) {
         lr_ = ud_ = 0;
       } else {
         lr_ = std::max(
             -32767,
             std::min(32767,
-                     static_cast<int>(-50000.0f + 100000.0f * RandomFloat())));
+                     static_cast<int>(-50000.0f + 100000.0f * RandomFloat_())));
         ud_ = std::max(
             -32767,
             std::min(32767,
-                     static_cast<int>(-50000.0f + 100000.0f * RandomFloat())));
+                     static_cast<int>(-50000.0f + 100000.0f * RandomFloat_())));
       }
       e.type = SDL_JOYAXISMOTION;
       e.jaxis.axis = 0;
@@ -95,7 +98,7 @@ void TestInput::Process(millisecs_t time) {
       g_base->input->PushJoystickEvent(e, joystick_);
     } else {
       // Button change.
-      r = RandomFloat();
+      r = RandomFloat_();
       if (r > 0.75f) {
         // Jump:
         // Don't do more than 2 presses while joining.
@@ -3,19 +3,24 @@
 #ifndef BALLISTICA_BASE_INPUT_DEVICE_TEST_INPUT_H_
 #define BALLISTICA_BASE_INPUT_DEVICE_TEST_INPUT_H_
 
+#include <random>
+
 #include "ballistica/base/base.h"
 
 namespace ballistica::base {
 
+/// A fake joystick which joins the game and mashes buttons randomly.
+/// Its behavior is fully determined by the seed it is created with.
 class TestInput {
  public:
-  TestInput();
+  explicit TestInput(uint32_t seed);
   virtual ~TestInput();
   void Process(millisecs_t time);
   void Reset();
 
  private:
   void HandleAlreadyPressedTwice();
+  auto RandomFloat_() -> float;
 
   int lr_{};
   int ud_{};
@@ -31,6 +36,7 @@ class TestInput {
   millisecs_t join_start_time_{};
   millisecs_t join_end_time_{9999};
   JoystickInput* joystick_{};
+  std::mt19937 rng_;
 };
 
 }  // namespace ballistica::base
@@ -2,6 +2,11 @@
 
 #include "ballistica/base/input/input.h"
 
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "ballistica/base/app_adapter/app_adapter.h"
 #include "ballistica/base/app_mode/app_mode.h"
 #include "ballistica/base/audio/audio.h"
@@ -779,12 +784,62 @@ void Input::PushTextInputEvent(const std::string& text) {
 
 void Input::PushJoystickEvent(const SDL_Event& event,
                               InputDevice* input_device) {
-  assert(g_base->logic->event_loop());
-  g_base->logic->event_loop()->PushCall([this, event, input_device] {
+  auto* loop = g_base->logic->event_loop();
+  assert(loop);
+  std::scoped_lock lock(pending_events_mutex_);
+
+  // Axis motion can come in far faster than we step; only the latest
+  // value for a given axis matters so update a pending one if possible.
+  if (event.type == SDL_JOYAXISMOTION) {
+    auto key = std::make_pair(input_device, static_cast<int>(event.jaxis.axis));
+    if (joystick_axis_slots_.Update(key, event)) {
+      return;
+    }
+    auto pending = joystick_axis_slots_.Open(key, event);
+    auto sample{latency_tracer_.BeginSample()};
+    loop->PushCall([this, pending, key, sample] {
+      SDL_Event latest;
+      {
+        std::scoped_lock lock(pending_events_mutex_);
+        latest = joystick_axis_slots_.Take(key, pending);
+      }
+      HandleJoystickEvent_(latest, key.first);
+      latency_tracer_.MarkHandled(sample);
+    });
+    return;
+  }
+
+  // Anything else from this device must stay ordered after the axis
+  // values already queued.
+  joystick_axis_slots_.CloseIf(
+      [input_device](const auto& key) { return key.first == input_device; });
+  auto sample{latency_tracer_.BeginSample()};
+  loop->PushCall([this, event, input_device, sample] {
     HandleJoystickEvent_(event, input_device);
+    latency_tracer_.MarkHandled(sample);
   });
 }
 
+void Input::CloseMouseEventSlots_() {
+  mouse_motion_slots_.CloseAll();
+  smooth_scroll_slots_.CloseAll();
+}
+
+auto Input::GetCoalescedMouseMotionCount() -> int64_t {
+  std::scoped_lock lock(pending_events_mutex_);
+  return mouse_motion_slots_.coalesced_count();
+}
+
+auto Input::GetCoalescedSmoothScrollCount() -> int64_t {
+  std::scoped_lock lock(pending_events_mutex_);
+  return smooth_scroll_slots_.coalesced_count();
+}
+
+auto Input::GetCoalescedJoystickAxisCount() -> int64_t {
+  std::scoped_lock lock(pending_events_mutex_);
+  return joystick_axis_slots_.coalesced_count();
+}
+
 void Input::HandleJoystickEvent_(const SDL_Event& event,
                                  InputDevice* input_device) {
   assert(g_base->InLogicThread());
@@ -813,8 +868,11 @@ void Input::HandleJoystickEvent_(const SDL_Event& event,
 
 void Input::PushKeyPressEventSimple(int key) {
   assert(g_base->logic->event_loop());
-  g_base->logic->event_loop()->PushCall(
-      [this, key] { HandleKeyPressSimple_(key); });
+  auto sample{latency_tracer_.BeginSample()};
+  g_base->logic->event_loop()->PushCall([this, key, sample] {
+    HandleKeyPressSimple_(key);
+    latency_tracer_.MarkHandled(sample);
+  });
 }
 
 void Input::PushKeyReleaseEventSimple(int key) {
@@ -825,8 +883,11 @@ void Input::PushKeyReleaseEventSimple(int key) {
 
 void Input::PushKeyPressEvent(const SDL_Keysym& keysym) {
   assert(g_base->logic->event_loop());
-  g_base->logic->event_loop()->PushCall(
-      [this, keysym] { HandleKeyPress_(keysym); });
+  auto sample{latency_tracer_.BeginSample()};
+  g_base->logic->event_loop()->PushCall([this, keysym, sample] {
+    HandleKeyPress_(keysym);
+    latency_tracer_.MarkHandled(sample);
+  });
 }
 
 void Input::PushKeyReleaseEvent(const SDL_Keysym& keysym) {
@@ -1169,6 +1230,11 @@ void Input::UpdateModKeyStates_(const SDL_Keysym* keysym, bool press) {
 
 void Input::PushMouseScrollEvent(const Vector2f& amount) {
   assert(g_base->logic->event_loop());
+
+  // Scroll amounts are deltas so these are never merged, but pending
+  // motion must not be moved past them.
+  std::scoped_lock lock(pending_events_mutex_);
+  CloseMouseEventSlots_();
   g_base->logic->event_loop()->PushCall(
       [this, amount] { HandleMouseScroll_(amount); });
 }
@@ -1205,9 +1271,24 @@ void Input::HandleMouseScroll_(const Vector2f& amount) {
 
 void Input::PushSmoothMouseScrollEvent(const Vector2f& velocity,
                                        bool momentum) {
-  assert(g_base->logic->event_loop());
-  g_base->logic->event_loop()->PushCall([this, velocity, momentum] {
-    HandleSmoothMouseScroll_(velocity, momentum);
+  auto* loop = g_base->logic->event_loop();
+  assert(loop);
+  std::scoped_lock lock(pending_events_mutex_);
+
+  // Velocities simply replace one another, so a still-pending one can be
+  // updated in place (as long as we're not switching to or from momentum).
+  if (smooth_scroll_slots_.Update(momentum, velocity)) {
+    return;
+  }
+  CloseMouseEventSlots_();
+  auto pending = smooth_scroll_slots_.Open(momentum, velocity);
+  loop->PushCall([this, pending, momentum] {
+    Vector2f latest;
+    {
+      std::scoped_lock lock(pending_events_mutex_);
+      latest = smooth_scroll_slots_.Take(momentum, pending);
+    }
+    HandleSmoothMouseScroll_(latest, momentum);
   });
 }
 
@@ -1243,14 +1324,33 @@ void Input::HandleSmoothMouseScroll_(const Vector2f& velocity, bool momentum) {
 void Input::PushMouseMotionEvent(const Vector2f& position) {
   auto* loop = g_base->logic->event_loop();
   assert(loop);
+  std::scoped_lock lock(pending_events_mutex_);
+
+  // If we've still got motion waiting to be handled, just update it with
+  // the latest position; there's no value in handling each intermediate
+  // one.
+  if (mouse_motion_slots_.Update(0, position)) {
+    return;
+  }
 
   // Don't overload it with events if it's stuck.
   if (!loop->CheckPushSafety()) {
     return;
   }
 
-  g_base->logic->event_loop()->PushCall(
-      [this, position] { HandleMouseMotion_(position); });
+  // Motion must not be moved ahead of a pending smooth-scroll.
+  CloseMouseEventSlots_();
+  auto pending = mouse_motion_slots_.Open(0, position);
+  auto sample{latency_tracer_.BeginSample()};
+  loop->PushCall([this, pending, sample] {
+    Vector2f latest;
+    {
+      std::scoped_lock lock(pending_events_mutex_);
+      latest = mouse_motion_slots_.Take(0, pending);
+    }
+    HandleMouseMotion_(latest);
+    latency_tracer_.MarkHandled(sample);
+  });
 }
 
 void Input::HandleMouseMotion_(const Vector2f& position) {
@@ -1300,8 +1400,13 @@ void Input::HandleMouseMotion_(const Vector2f& position) {
 
 void Input::PushMouseDownEvent(int button, const Vector2f& position) {
   assert(g_base->logic->event_loop());
-  g_base->logic->event_loop()->PushCall(
-      [this, button, position] { HandleMouseDown_(button, position); });
+  std::scoped_lock lock(pending_events_mutex_);
+  CloseMouseEventSlots_();
+  auto sample{latency_tracer_.BeginSample()};
+  g_base->logic->event_loop()->PushCall([this, button, position, sample] {
+    HandleMouseDown_(button, position);
+    latency_tracer_.MarkHandled(sample);
+  });
 }
 
 void Input::HandleMouseDown_(int button, const Vector2f& position) {
@@ -1365,6 +1470,8 @@ void Input::HandleMouseDown_(int button, const Vector2f& position) {
 
 void Input::PushMouseUpEvent(int button, const Vector2f& position) {
   assert(g_base->logic->event_loop());
+  std::scoped_lock lock(pending_events_mutex_);
+  CloseMouseEventSlots_();
   g_base->logic->event_loop()->PushCall(
       [this, button, position] { HandleMouseUp_(button, position); });
 }
@@ -1409,7 +1516,11 @@ void Input::HandleMouseUp_(int button, const Vector2f& position) {
 
 void Input::PushTouchEvent(const TouchEvent& e) {
   assert(g_base->logic->event_loop());
-  g_base->logic->event_loop()->PushCall([e, this] { HandleTouchEvent_(e); });
+  auto sample{latency_tracer_.BeginSample()};
+  g_base->logic->event_loop()->PushCall([e, this, sample] {
+    HandleTouchEvent_(e);
+    latency_tracer_.MarkHandled(sample);
+  });
 }
 
 void Input::HandleTouchEvent_(const TouchEvent& e) {
@@ -1562,6 +1673,11 @@ void Input::LsInputDevices() {
     ++index;
   }
 
+  out += ("\ncoalesced-events: mouse-motion="
+          + std::to_string(GetCoalescedMouseMotionCount()) + " smooth-scroll="
+          + std::to_string(GetCoalescedSmoothScrollCount()) + " joystick-axis="
+          + std::to_string(GetCoalescedJoystickAxisCount()));
+
   Log(LogLevel::kInfo, out);
 }
 
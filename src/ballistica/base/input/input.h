@@ -4,12 +4,16 @@
 #define BALLISTICA_BASE_INPUT_INPUT_H_
 
 #include <list>
+#include <mutex>
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "ballistica/base/base.h"
+#include "ballistica/base/input/support/input_latency_tracer.h"
+#include "ballistica/base/input/support/pending_event_slots.h"
 #include "ballistica/shared/foundation/macros.h"
 #include "ballistica/shared/foundation/object.h"
 #include "ballistica/shared/foundation/types.h"
@@ -143,6 +147,16 @@ class Input {
   /// Roughly how long in milliseconds have all input devices been idle.
   auto input_idle_time() const { return input_idle_time_; }
 
+  /// Number of high-rate events that were merged into an already-pending
+  /// event instead of being pushed to the logic thread on their own.
+  auto GetCoalescedMouseMotionCount() -> int64_t;
+  auto GetCoalescedSmoothScrollCount() -> int64_t;
+  auto GetCoalescedJoystickAxisCount() -> int64_t;
+
+  /// Follows sampled input events through to the screen. Safe to use from
+  /// any thread.
+  auto latency_tracer() -> InputLatencyTracer* { return &latency_tracer_; }
+
   typedef bool(HandleJoystickEventCall)(const SDL_Event& event,
                                         InputDevice* input_device);
   typedef bool(HandleKeyPressCall)(const SDL_Keysym& keysym);
@@ -185,6 +199,19 @@ class Input {
   void DestroyKeyboardInputDevices_();
   void AddFakeMods_(SDL_Keysym* sym);
 
+  // Latest-value slots for high-rate events waiting in the logic thread's
+  // queue; see PendingEventSlots. These are guarded by
+  // pending_events_mutex_ since pushes come from other threads. Mouse
+  // motion only ever uses key 0, smooth-scroll is keyed by momentum, and
+  // joystick axes by device and axis.
+  void CloseMouseEventSlots_();
+  InputLatencyTracer latency_tracer_;
+  std::mutex pending_events_mutex_;
+  PendingEventSlots<int, Vector2f> mouse_motion_slots_;
+  PendingEventSlots<bool, Vector2f> smooth_scroll_slots_;
+  PendingEventSlots<std::pair<InputDevice*, int>, SDL_Event>
+      joystick_axis_slots_;
+
   int connect_print_timer_id_{};
   int disconnect_print_timer_id_{};
   int max_controller_count_so_far_{};
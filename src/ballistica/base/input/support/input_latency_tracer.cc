@@ -0,0 +1,234 @@
+// Released under the MIT License. See LICENSE for details.
+
+#include "ballistica/base/input/support/input_latency_tracer.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "ballistica/core/platform/core_platform.h"
+#include "ballistica/shared/generic/json.h"
+
+namespace ballistica::base {
+
+// Samples that haven't made it to the screen after this long (due to
+// render holds, suspends, etc.) are dropped so new ones can begin.
+const microsecs_t kInputLatencySampleTimeout{1000000};
+
+auto InputLatencyTracer::BucketLimitsMillisecs() -> const std::vector<double>& {
+  static const std::vector<double> limits{
+      1.0, 2.0, 4.0, 8.0, 12.0, 16.7, 25.0, 33.3, 50.0, 66.7, 100.0, 250.0};
+  return limits;
+}
+
+auto InputLatencyTracer::StageName_(Stage stage) -> const char* {
+  switch (stage) {
+    case Stage::kArrived:
+      return "total";
+    case Stage::kHandled:
+      return "arrive_to_handle";
+    case Stage::kFramed:
+      return "handle_to_frame";
+    case Stage::kRendered:
+      return "frame_to_render";
+    case Stage::kPresented:
+      return "render_to_present";
+    default:
+      return "unknown";
+  }
+}
+
+void InputLatencyTracer::SetEnabled(bool enabled) {
+  std::scoped_lock lock(mutex_);
+  enabled_ = enabled;
+  sample_ = 0;
+}
+
+void InputLatencyTracer::Reset() {
+  std::scoped_lock lock(mutex_);
+  histograms_.clear();
+  abandoned_count_ = 0;
+  sample_ = 0;
+}
+
+auto InputLatencyTracer::BeginSample() -> int {
+  if (!enabled_) {
+    return 0;
+  }
+  auto now = core::CorePlatform::GetCurrentMicrosecs();
+  std::scoped_lock lock(mutex_);
+  if (sample_ != 0) {
+    if (now - stage_times_[static_cast<int>(Stage::kArrived)]
+        < kInputLatencySampleTimeout) {
+      return 0;
+    }
+    abandoned_count_++;
+  }
+  sample_ = next_sample_id_++;
+  if (next_sample_id_ <= 0) {
+    next_sample_id_ = 1;
+  }
+  sample_stage_ = Stage::kArrived;
+  stage_times_[static_cast<int>(Stage::kArrived)] = now;
+  return sample_;
+}
+
+void InputLatencyTracer::MarkHandled(int sample) {
+  if (sample == 0) {
+    return;
+  }
+  auto now = core::CorePlatform::GetCurrentMicrosecs();
+  std::scoped_lock lock(mutex_);
+  if (sample == sample_ && sample_stage_ == Stage::kArrived) {
+    sample_stage_ = Stage::kHandled;
+    stage_times_[static_cast<int>(Stage::kHandled)] = now;
+  }
+}
+
+auto InputLatencyTracer::MarkFramed() -> int {
+  if (!enabled_) {
+    return 0;
+  }
+  auto now = core::CorePlatform::GetCurrentMicrosecs();
+  std::scoped_lock lock(mutex_);
+  if (sample_ == 0 || sample_stage_ != Stage::kHandled) {
+    return 0;
+  }
+  sample_stage_ = Stage::kFramed;
+  stage_times_[static_cast<int>(Stage::kFramed)] = now;
+  return sample_;
+}
+
+void InputLatencyTracer::MarkRendered(int sample, bool presents_reported) {
+  if (sample == 0) {
+    return;
+  }
+  auto now = core::CorePlatform::GetCurrentMicrosecs();
+  std::scoped_lock lock(mutex_);
+  if (sample != sample_ || sample_stage_ != Stage::kFramed) {
+    return;
+  }
+  sample_stage_ = Stage::kRendered;
+  stage_times_[static_cast<int>(Stage::kRendered)] = now;
+
+  // With nobody to tell us when the frame hits the screen, consider it
+  // presented as soon as it's rendered.
+  if (!presents_reported) {
+    stage_times_[static_cast<int>(Stage::kPresented)] = now;
+    CompleteSample_();
+  }
+}
+
+void InputLatencyTracer::MarkPresented() {
+  if (!enabled_) {
+    return;
+  }
+  auto now = core::CorePlatform::GetCurrentMicrosecs();
+  std::scoped_lock lock(mutex_);
+  if (sample_ == 0 || sample_stage_ != Stage::kRendered) {
+    return;
+  }
+  stage_times_[static_cast<int>(Stage::kPresented)] = now;
+  CompleteSample_();
+}
+
+void InputLatencyTracer::AbandonSample(int sample) {
+  if (sample == 0) {
+    return;
+  }
+  std::scoped_lock lock(mutex_);
+  if (sample == sample_) {
+    sample_ = 0;
+    abandoned_count_++;
+  }
+}
+
+void InputLatencyTracer::CompleteSample_() {
+  for (int i = static_cast<int>(Stage::kHandled);
+       i <= static_cast<int>(Stage::kPresented); ++i) {
+    AddResult_(static_cast<Stage>(i), stage_times_[i] - stage_times_[i - 1]);
+  }
+  AddResult_(Stage::kArrived,
+             stage_times_[static_cast<int>(Stage::kPresented)]
+                 - stage_times_[static_cast<int>(Stage::kArrived)]);
+  sample_ = 0;
+}
+
+void InputLatencyTracer::AddResult_(Stage stage, microsecs_t elapsed) {
+  if (histograms_.empty()) {
+    histograms_.resize(static_cast<int>(Stage::kLast));
+    for (auto&& histogram : histograms_) {
+      histogram.counts.resize(BucketLimitsMillisecs().size() + 1);
+    }
+  }
+  auto& limits{BucketLimitsMillisecs()};
+  auto millisecs{static_cast<double>(elapsed) / 1000.0};
+  auto bucket{std::lower_bound(limits.begin(), limits.end(), millisecs)
+              - limits.begin()};
+  auto& histogram{histograms_[static_cast<int>(stage)]};
+  histogram.counts[bucket]++;
+  histogram.count++;
+  histogram.total_millisecs += millisecs;
+  histogram.max_millisecs = std::max(histogram.max_millisecs, millisecs);
+}
+
+auto InputLatencyTracer::Percentile_(const Histogram& histogram,
+                                     double fraction) -> double {
+  // We only know which bucket values fell in, so report bucket limits
+  // (or the max for the overflow bucket).
+  auto& limits{BucketLimitsMillisecs()};
+  auto target{static_cast<int64_t>(fraction
+                                   * static_cast<double>(histogram.count))};
+  int64_t total{};
+  for (size_t i = 0; i < limits.size(); ++i) {
+    total += histogram.counts[i];
+    if (total > target) {
+      return std::min(limits[i], histogram.max_millisecs);
+    }
+  }
+  return histogram.max_millisecs;
+}
+
+auto InputLatencyTracer::GetStatsJSON() -> std::string {
+  std::scoped_lock lock(mutex_);
+  cJSON* root = cJSON_CreateObject();
+  cJSON_AddBoolToObject(root, "enabled", enabled_);
+  cJSON_AddNumberToObject(root, "abandoned",
+                          static_cast<double>(abandoned_count_));
+  cJSON* limits = cJSON_CreateArray();
+  for (auto&& limit : BucketLimitsMillisecs()) {
+    cJSON_AddItemToArray(limits, cJSON_CreateNumber(limit));
+  }
+  cJSON_AddItemToObject(root, "bucket_limits_ms", limits);
+  cJSON* stages = cJSON_CreateObject();
+  for (int i = 0; i < static_cast<int>(histograms_.size()); ++i) {
+    auto& histogram{histograms_[i]};
+    cJSON* stage = cJSON_CreateObject();
+    cJSON_AddNumberToObject(stage, "count",
+                            static_cast<double>(histogram.count));
+    cJSON_AddNumberToObject(
+        stage, "avg_ms",
+        histogram.count
+            ? histogram.total_millisecs / static_cast<double>(histogram.count)
+            : 0.0);
+    cJSON_AddNumberToObject(stage, "p50_ms", Percentile_(histogram, 0.5));
+    cJSON_AddNumberToObject(stage, "p95_ms", Percentile_(histogram, 0.95));
+    cJSON_AddNumberToObject(stage, "max_ms", histogram.max_millisecs);
+    cJSON* counts = cJSON_CreateArray();
+    for (auto&& count : histogram.counts) {
+      cJSON_AddItemToArray(counts,
+                           cJSON_CreateNumber(static_cast<double>(count)));
+    }
+    cJSON_AddItemToObject(stage, "histogram", counts);
+    cJSON_AddItemToObject(stages, StageName_(static_cast<Stage>(i)), stage);
+  }
+  cJSON_AddItemToObject(root, "stages", stages);
+
+  char* buffer = cJSON_PrintUnformatted(root);
+  std::string out{buffer};
+  free(buffer);
+  cJSON_Delete(root);
+  return out;
+}
+
+}  // namespace ballistica::base
@@ -0,0 +1,98 @@
+// Released under the MIT License. See LICENSE for details.
+
+#ifndef BALLISTICA_BASE_INPUT_SUPPORT_INPUT_LATENCY_TRACER_H_
+#define BALLISTICA_BASE_INPUT_SUPPORT_INPUT_LATENCY_TRACER_H_
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "ballistica/base/base.h"
+
+namespace ballistica::base {
+
+/// Measures how long it takes input to make it to the screen.
+///
+/// A single input event at a time is followed through the pipeline: its
+/// arrival (in whatever thread pushes it), its handler finishing in the
+/// logic thread, the first frame-def built after that, the renderer
+/// finishing that frame-def, and finally the app-adapter presenting it.
+/// Once a sample completes, the next input event to arrive starts a new
+/// one. Times are plain wall-clock CPU timestamps (no GPU queries), so
+/// this works the same with any GL context, software ones included.
+class InputLatencyTracer {
+ public:
+  enum class Stage {
+    kArrived,
+    kHandled,
+    kFramed,
+    kRendered,
+    kPresented,
+    kLast  // Sentinel.
+  };
+
+  /// Upper bounds (in milliseconds) of our histogram buckets. One more
+  /// bucket exists beyond the last of these for everything slower.
+  static auto BucketLimitsMillisecs() -> const std::vector<double>&;
+
+  auto enabled() const -> bool { return enabled_; }
+  void SetEnabled(bool enabled);
+  void Reset();
+
+  /// Called as an input event is pushed. Returns a sample id to be passed
+  /// to MarkHandled() once the event is handled, or 0 if this event is
+  /// not being sampled.
+  auto BeginSample() -> int;
+
+  /// Called in the logic thread once an input event has been handled.
+  void MarkHandled(int sample);
+
+  /// Called in the logic thread as a frame-def is shipped to the graphics
+  /// server. Returns the sample id the frame-def is carrying (or 0).
+  auto MarkFramed() -> int;
+
+  /// Called by the graphics server once it has rendered a frame-def
+  /// carrying a sample. If the app-adapter doesn't report presents, this
+  /// completes the sample.
+  void MarkRendered(int sample, bool presents_reported);
+
+  /// Called by app-adapters after presenting a rendered frame.
+  void MarkPresented();
+
+  /// Called when a frame-def carrying a sample is dropped unrendered.
+  void AbandonSample(int sample);
+
+  /// Return stats as a JSON string; one histogram and some summary values
+  /// per pipeline interval plus one for the total.
+  auto GetStatsJSON() -> std::string;
+
+ private:
+  struct Histogram {
+    std::vector<int64_t> counts;
+    int64_t count{};
+    double total_millisecs{};
+    double max_millisecs{};
+  };
+  void AddResult_(Stage stage, microsecs_t elapsed);
+  void CompleteSample_();
+  static auto StageName_(Stage stage) -> const char*;
+  static auto Percentile_(const Histogram& histogram, double fraction)
+      -> double;
+
+  std::mutex mutex_;
+  std::atomic<bool> enabled_{};
+  int next_sample_id_{1};
+  int sample_{};
+  Stage sample_stage_{Stage::kLast};
+  microsecs_t stage_times_[static_cast<int>(Stage::kLast)]{};
+
+  // One histogram per stage (time since the previous stage), with the
+  // kArrived slot holding end-to-end totals.
+  std::vector<Histogram> histograms_;
+  int64_t abandoned_count_{};
+};
+
+}  // namespace ballistica::base
+
+#endif  // BALLISTICA_BASE_INPUT_SUPPORT_INPUT_LATENCY_TRACER_H_
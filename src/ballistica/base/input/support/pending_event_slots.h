@@ -0,0 +1,84 @@
+// Released under the MIT License. See LICENSE for details.
+
+#ifndef BALLISTICA_BASE_INPUT_SUPPORT_PENDING_EVENT_SLOTS_H_
+#define BALLISTICA_BASE_INPUT_SUPPORT_PENDING_EVENT_SLOTS_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+
+namespace ballistica::base {
+
+/// Latest-value slots for high-rate input events waiting in the logic
+/// thread's queue.
+///
+/// Opening a slot for a key gives a value to capture in the queued call.
+/// While that slot stays open, newer values for the same key overwrite it
+/// instead of queuing another call. When the call runs it takes the final
+/// value, and that closes the slot. Slots should also be closed when an
+/// event that must be handled after them gets queued. After that, new
+/// values open a fresh slot.
+///
+/// This does no locking of its own; callers pushing from multiple threads
+/// must guard it.
+template <typename KeyT, typename ValueT>
+class PendingEventSlots {
+ public:
+  using Slot = std::shared_ptr<ValueT>;
+
+  /// Overwrite the open slot for a key if there is one. Returns whether
+  /// the value was merged this way.
+  auto Update(const KeyT& key, const ValueT& value) -> bool {
+    auto i = open_.find(key);
+    if (i == open_.end()) {
+      return false;
+    }
+    *i->second = value;
+    coalesced_count_++;
+    return true;
+  }
+
+  /// Open a new slot for a key. The queued call should pass the result to
+  /// Take().
+  auto Open(const KeyT& key, const ValueT& value) -> Slot {
+    auto slot = std::make_shared<ValueT>(value);
+    open_[key] = slot.get();
+    return slot;
+  }
+
+  /// Close a slot if it is still open and return its final value.
+  auto Take(const KeyT& key, const Slot& slot) -> ValueT {
+    auto i = open_.find(key);
+    if (i != open_.end() && i->second == slot.get()) {
+      open_.erase(i);
+    }
+    return *slot;
+  }
+
+  /// Close all open slots whose keys match a predicate.
+  template <typename PredicateT>
+  void CloseIf(PredicateT predicate) {
+    for (auto i = open_.begin(); i != open_.end();) {
+      if (predicate(i->first)) {
+        i = open_.erase(i);
+      } else {
+        ++i;
+      }
+    }
+  }
+
+  void CloseAll() { open_.clear(); }
+
+  auto open_count() const { return open_.size(); }
+
+  /// Number of values merged into an already-open slot.
+  auto coalesced_count() const { return coalesced_count_; }
+
+ private:
+  std::map<KeyT, ValueT*> open_;
+  int64_t coalesced_count_{};
+};
+
+}  // namespace ballistica::base
+
+#endif  // BALLISTICA_BASE_INPUT_SUPPORT_PENDING_EVENT_SLOTS_H_
@@ -2,6 +2,8 @@
 
 #include "ballistica/base/logic/logic.h"
 
+#include <algorithm>
+
 #include "ballistica/base/app_adapter/app_adapter.h"
 #include "ballistica/base/app_mode/app_mode.h"
 #include "ballistica/base/audio/audio.h"
@@ -9,6 +11,7 @@
 #include "ballistica/base/networking/networking.h"
 #include "ballistica/base/platform/base_platform.h"
 #include "ballistica/base/python/base_python.h"
+#include "ballistica/base/support/context_accounting.h"
 #include "ballistica/base/support/plus_soft.h"
 #include "ballistica/base/support/stdio_console.h"
 #include "ballistica/base/ui/dev_console.h"
@@ -336,6 +339,7 @@ void Logic::OnScreenSizeChange(float virtual_width, float virtual_height,
 // Bring all logic-thread stuff up to date for a new visual frame.
 void Logic::StepDisplayTime_() {
   assert(g_base->InLogicThread());
+  auto step_start_time = g_core->GetAppTimeMicrosecs();
 
   // We have two different modes of operation here. When running in headless
   // mode, display time is driven by upcoming events such as sim steps; we
@@ -349,6 +353,16 @@ void Logic::StepDisplayTime_() {
     UpdateDisplayTimeForFrameDraw_();
   }
 
+  // Each step gets a deadline; we track how often it is blown and
+  // subsystems can put off non-urgent work when it is at risk.
+  step_budget_ = g_core->HeadlessMode()
+                     ? kHeadlessStepBudget
+                     : std::max(display_time_increment_microsecs_,
+                                microsecs_t{1000});
+  step_start_time_ = step_start_time;
+  step_deadline_ = step_start_time + step_budget_;
+  in_step_ = true;
+
   // Give all our subsystems some update love.
   // Note: keep these in the same order as OnAppStart.
   g_base->graphics->StepDisplayTime();
@@ -369,6 +383,60 @@ void Logic::StepDisplayTime_() {
   if (g_core->HeadlessMode()) {
     PostUpdateDisplayTimeForHeadlessMode_();
   }
+
+  in_step_ = false;
+  auto step_end_time = g_core->GetAppTimeMicrosecs();
+  auto step_time = step_end_time - step_start_time;
+  step_count_++;
+  step_time_total_ += step_time;
+  step_time_max_ = std::max(step_time_max_, step_time);
+  if (step_end_time > step_deadline_) {
+    auto overrun = step_end_time - step_deadline_;
+    step_overrun_count_++;
+    step_overrun_time_total_ += overrun;
+    step_overrun_max_ = std::max(step_overrun_max_, overrun);
+    if (debug_log_display_time_) {
+      Log(LogLevel::kDebug, "display-time step overran its deadline by "
+                                + std::to_string(overrun) + "us.");
+    }
+  }
+
+  // In gui mode our next step should come one frame interval after this
+  // one started (headless mode sets this when scheduling its timer).
+  if (!g_core->HeadlessMode()) {
+    next_step_time_ = step_start_time + step_budget_;
+  }
+}
+
+auto Logic::ShouldDeferWork(microsecs_t* deferred_since) -> bool {
+  assert(g_base->InLogicThread());
+  assert(deferred_since);
+  auto now = g_core->GetAppTimeMicrosecs();
+
+  // Within a step we've got a problem once we've burned through a good
+  // chunk of our budget. Between steps the worry is the next step
+  // starting late.
+  bool at_risk;
+  if (in_step_) {
+    at_risk = now - step_start_time_
+              > static_cast<microsecs_t>(static_cast<double>(step_budget_)
+                                         * kStepDeferBudgetFraction);
+  } else {
+    at_risk = next_step_time_ - now < kStepDeferMargin;
+  }
+  if (!at_risk) {
+    *deferred_since = 0;
+    return false;
+  }
+  if (*deferred_since == 0) {
+    *deferred_since = now;
+  } else if (now - *deferred_since > kMaxWorkDeferral) {
+    // We've put this off long enough; just do it.
+    *deferred_since = 0;
+    return false;
+  }
+  deferred_work_count_++;
+  return true;
 }
 
 void Logic::OnAppModeChanged() {
@@ -440,6 +508,7 @@ void Logic::PostUpdateDisplayTimeForHeadlessMode_() {
 
   auto sleep_microsecs = headless_display_step_microsecs;
   headless_display_time_step_timer_->SetLength(sleep_microsecs);
+  next_step_time_ = g_core->GetAppTimeMicrosecs() + sleep_microsecs;
 }
 
 void Logic::UpdateDisplayTimeForFrameDraw_() {
@@ -639,6 +708,7 @@ auto Logic::NewAppTimer(microsecs_t length, bool repeat,
   // App-Timers simply get injected into our loop and run alongside our own
   // stuff.
   assert(g_base->InLogicThread());
+  g_base->context_accounting->AddTimer();
   auto* timer = event_loop()->NewTimer(length, repeat, runnable);
   return timer->id();
 }
@@ -664,6 +734,7 @@ auto Logic::NewDisplayTimer(microsecs_t length, bool repeat,
   // Display-Timers go into a timer-list that we exec explicitly when we
   // step display-time.
   assert(g_base->InLogicThread());
+  g_base->context_accounting->AddTimer();
   int offset = 0;
   Timer* t = display_timers_->NewTimer(display_time_microsecs_, length, offset,
                                        repeat ? -1 : 0, runnable);
@@ -687,6 +758,12 @@ void Logic::SetDisplayTimerLength(int timer_id, microsecs_t length) {
 }
 
 void Logic::ProcessPendingWork_() {
+  // Loads can take a while; try to keep them from delaying our next step.
+  // (Our timer keeps firing while loads are pending so we'll be back).
+  if (have_pending_loads_
+      && ShouldDeferWork(&pending_loads_deferred_since_)) {
+    return;
+  }
   have_pending_loads_ = g_base->assets->RunPendingLoadsLogicThread();
   UpdatePendingWorkTimer_();
 }
@@ -21,6 +21,18 @@ const microsecs_t kHeadlessMaxDisplayTimeStep{500000};
 /// limit on stepping overhead in cases where events are densely packed.
 const microsecs_t kHeadlessMinDisplayTimeStep{1000};
 
+/// The time budget for a headless display-time step (one scene sim step).
+/// Gui builds use the current frame interval instead.
+const microsecs_t kHeadlessStepBudget{8000};
+
+/// Non-urgent work is deferred once a step has used this fraction of its
+/// budget, or when the next step is due sooner than kStepDeferMargin.
+const double kStepDeferBudgetFraction{0.5};
+const microsecs_t kStepDeferMargin{2000};
+
+/// Deferred work always runs once it has been put off this long.
+const microsecs_t kMaxWorkDeferral{250000};
+
 /// The logic subsystem of the app. This runs on a dedicated thread and is
 /// where most high level app logic happens. Much app functionality
 /// including UI calls must be run on the logic thread.
@@ -122,6 +134,37 @@ class Logic {
 
   auto app_active() const { return app_active_; }
 
+  /// Total number of display-time steps we've run and the total
+  /// wall-clock time they took.
+  auto step_count() const -> int64_t { return step_count_; }
+  auto step_time_total() const -> microsecs_t { return step_time_total_; }
+
+  /// Longest display-time step since the last ResetStepTimeMax() call.
+  auto step_time_max() const -> microsecs_t { return step_time_max_; }
+  void ResetStepTimeMax() { step_time_max_ = 0; }
+
+  /// Number of display-time steps that ran past their budget, the total
+  /// time by which they did so, and the largest single overrun.
+  auto step_overrun_count() const -> int64_t { return step_overrun_count_; }
+  auto step_overrun_time_total() const -> microsecs_t {
+    return step_overrun_time_total_;
+  }
+  auto step_overrun_max() const -> microsecs_t { return step_overrun_max_; }
+
+  /// Number of times non-urgent work was put off to protect a deadline.
+  auto deferred_work_count() const -> int64_t { return deferred_work_count_; }
+
+  /// App-time by which the current (or most recent) display-time step
+  /// should complete.
+  auto step_deadline() const -> microsecs_t { return step_deadline_; }
+
+  /// Non-urgent work (roster updates, pending-load processing, connection
+  /// housekeeping, etc.) should call this before running and skip itself
+  /// this time around if it returns true. The caller provides storage for
+  /// when deferral began (initialized to 0) so that nothing is deferred
+  /// for longer than kMaxWorkDeferral.
+  auto ShouldDeferWork(microsecs_t* deferred_since) -> bool;
+
  private:
   void UpdateDisplayTimeForFrameDraw_();
   void UpdateDisplayTimeForHeadlessMode_();
@@ -135,6 +178,19 @@ class Logic {
   seconds_t display_time_increment_{1.0 / 60.0};
   microsecs_t display_time_microsecs_{};
   microsecs_t display_time_increment_microsecs_{1000000 / 60};
+  int64_t step_count_{};
+  microsecs_t step_time_total_{};
+  microsecs_t step_time_max_{};
+  microsecs_t step_start_time_{};
+  microsecs_t step_budget_{kHeadlessStepBudget};
+  microsecs_t step_deadline_{};
+  microsecs_t next_step_time_{};
+  int64_t step_overrun_count_{};
+  microsecs_t step_overrun_time_total_{};
+  microsecs_t step_overrun_max_{};
+  int64_t deferred_work_count_{};
+  microsecs_t pending_loads_deferred_since_{};
+  bool in_step_{};
 
   // Headless scheduling.
   Timer* headless_display_time_step_timer_{};
@@ -5,6 +5,7 @@
 #include "ballistica/base/app_mode/app_mode.h"
 #include "ballistica/base/input/support/remote_app_server.h"
 #include "ballistica/base/logic/logic.h"
+#include "ballistica/base/networking/udp_recording.h"
 #include "ballistica/core/platform/core_platform.h"
 #include "ballistica/shared/foundation/event_loop.h"
 #include "ballistica/shared/generic/json.h"
@@ -178,6 +179,30 @@ auto NetworkReader::RunThread_() -> int {
     remote_server_ = std::make_unique<RemoteAppServer>();
   }
 
+  // Headless builds can be fed a recording before taking live traffic.
+  // Replay is one-way: our sockets aren't open yet, so anything we (or
+  // the app) send in response goes nowhere. This reproduces the load and
+  // ordering of incoming traffic, not a two-way exchange; our state only
+  // matches the original run as far as it depends on what we received.
+  // Once the recording runs out we open our sockets and carry on as a
+  // normal host.
+  if (auto replay_path = g_core->platform->GetEnv("BA_UDP_REPLAY")) {
+    if (g_core->HeadlessMode()) {
+      auto speed_env = g_core->platform->GetEnv("BA_UDP_REPLAY_SPEED");
+      RunReplay_(*replay_path, speed_env ? atof(speed_env->c_str()) : 1.0);
+    } else {
+      Log(LogLevel::kError,
+          "BA_UDP_REPLAY is only supported in headless builds.");
+    }
+  }
+  if (auto record_path = g_core->platform->GetEnv("BA_UDP_RECORD")) {
+    try {
+      StartRecording(*record_path);
+    } catch (const Exception& exc) {
+      Log(LogLevel::kError, exc.what());
+    }
+  }
+
   // Do this whole thing in a loop. If we get put to sleep we just start over.
   while (true) {
     // Sleep until we're unpaused.
@@ -265,100 +290,10 @@ auto NetworkReader::RunThread_() -> int {
             }
             break;
           }
-          switch (buffer[0]) {
-            case BA_PACKET_POKE:
-              break;
-            case BA_PACKET_SIMPLE_PING: {
-              // This needs to be locked during any sd changes/writes.
-              std::scoped_lock lock(sd_mutex_);
-              char msg[1] = {BA_PACKET_SIMPLE_PONG};
-              sendto(sd, msg, 1, 0, reinterpret_cast<sockaddr*>(&from),
-                     from_size);
-              break;
-            }
-            case BA_PACKET_JSON_PING: {
-              if (rresult2 > 1) {
-                std::vector<char> s_buffer(rresult2);
-                memcpy(s_buffer.data(), buffer + 1, rresult2 - 1);
-                s_buffer[rresult2 - 1] = 0;  // terminate string
-                std::string response =
-                    g_base->app_mode()->HandleJSONPing(s_buffer.data());
-                if (!response.empty()) {
-                  std::vector<char> msg(1 + response.size());
-                  msg[0] = BA_PACKET_JSON_PONG;
-                  memcpy(msg.data() + 1, response.c_str(), response.size());
-                  std::scoped_lock lock(sd_mutex_);
-                  sendto(
-                      sd, msg.data(),
-                      static_cast_check_fit<socket_send_length_t>(msg.size()),
-                      0, reinterpret_cast<sockaddr*>(&from), from_size);
-                }
-              }
-              break;
-            }
-            case BA_PACKET_JSON_PONG: {
-              if (rresult2 > 1) {
-                std::vector<char> s_buffer(rresult2);
-                memcpy(s_buffer.data(), buffer + 1, rresult2 - 1);
-                s_buffer[rresult2 - 1] = 0;  // terminate string
-                cJSON* data = cJSON_Parse(s_buffer.data());
-                if (data != nullptr) {
-                  cJSON_Delete(data);
-                }
-              }
-              break;
-            }
-            case BA_PACKET_REMOTE_PING:
-            case BA_PACKET_REMOTE_PONG:
-            case BA_PACKET_REMOTE_ID_REQUEST:
-            case BA_PACKET_REMOTE_ID_RESPONSE:
-            case BA_PACKET_REMOTE_DISCONNECT:
-            case BA_PACKET_REMOTE_STATE:
-            case BA_PACKET_REMOTE_STATE2:
-            case BA_PACKET_REMOTE_STATE_ACK:
-            case BA_PACKET_REMOTE_DISCONNECT_ACK:
-            case BA_PACKET_REMOTE_GAME_QUERY:
-            case BA_PACKET_REMOTE_GAME_RESPONSE:
-              // These packets are associated with the remote app; let the
-              // remote server handle them.
-              if (remote_server_) {
-                remote_server_->HandleData(
-                    sd, reinterpret_cast<uint8_t*>(buffer), rresult2,
-                    reinterpret_cast<sockaddr*>(&from),
-                    static_cast<size_t>(from_size));
-              }
-              break;
-
-            case BA_PACKET_CLIENT_REQUEST:
-            case BA_PACKET_CLIENT_ACCEPT:
-            case BA_PACKET_CLIENT_DENY:
-            case BA_PACKET_CLIENT_DENY_ALREADY_IN_PARTY:
-            case BA_PACKET_CLIENT_DENY_VERSION_MISMATCH:
-            case BA_PACKET_CLIENT_DENY_PARTY_FULL:
-            case BA_PACKET_DISCONNECT_FROM_CLIENT_REQUEST:
-            case BA_PACKET_DISCONNECT_FROM_CLIENT_ACK:
-            case BA_PACKET_DISCONNECT_FROM_HOST_REQUEST:
-            case BA_PACKET_DISCONNECT_FROM_HOST_ACK:
-            case BA_PACKET_CLIENT_GAMEPACKET_COMPRESSED:
-            case BA_PACKET_HOST_GAMEPACKET_COMPRESSED: {
-              // These messages are associated with udp host/client
-              // connections.. pass them to the logic thread to wrangle.
-              std::vector<uint8_t> msg_buffer(rresult2);
-              memcpy(msg_buffer.data(), buffer, rresult2);
-              PushIncomingUDPPacketCall_(msg_buffer, SockAddr(from));
-              break;
-            }
-
-            case BA_PACKET_HOST_QUERY: {
-              g_base->app_mode()->HandleGameQuery(buffer, rresult2, &from);
-
-              // HandleGameQuery(buffer, rresult2, &from);
-              break;
-            }
-
-            default:
-              break;
+          if (buffer[0] != BA_PACKET_POKE) {
+            RecordPacket_(buffer, rresult2, from);
           }
+          HandlePacket_(sd, buffer, rresult2, &from, from_size);
         }
       }
 
@@ -373,6 +308,185 @@ auto NetworkReader::RunThread_() -> int {
   }
 }
 
+void NetworkReader::HandlePacket_(int sd, char* buffer, size_t size,
+                                  sockaddr_storage* from,
+                                  socklen_t from_size) {
+  // Replayed packets come in with no socket to answer on (sd is -1); we
+  // skip answering them directly below.
+  switch (buffer[0]) {
+    case BA_PACKET_POKE:
+      break;
+    case BA_PACKET_SIMPLE_PING: {
+      if (sd == -1) {
+        break;
+      }
+      // This needs to be locked during any sd changes/writes.
+      std::scoped_lock lock(sd_mutex_);
+      char msg[1] = {BA_PACKET_SIMPLE_PONG};
+      sendto(sd, msg, 1, 0, reinterpret_cast<sockaddr*>(from), from_size);
+      break;
+    }
+    case BA_PACKET_JSON_PING: {
+      if (size > 1) {
+        std::vector<char> s_buffer(size);
+        memcpy(s_buffer.data(), buffer + 1, size - 1);
+        s_buffer[size - 1] = 0;  // terminate string
+        std::string response =
+            g_base->app_mode()->HandleJSONPing(s_buffer.data());
+        if (!response.empty() && sd != -1) {
+          std::vector<char> msg(1 + response.size());
+          msg[0] = BA_PACKET_JSON_PONG;
+          memcpy(msg.data() + 1, response.c_str(), response.size());
+          std::scoped_lock lock(sd_mutex_);
+          sendto(sd, msg.data(),
+                 static_cast_check_fit<socket_send_length_t>(msg.size()), 0,
+                 reinterpret_cast<sockaddr*>(from), from_size);
+        }
+      }
+      break;
+    }
+    case BA_PACKET_JSON_PONG: {
+      if (size > 1) {
+        std::vector<char> s_buffer(size);
+        memcpy(s_buffer.data(), buffer + 1, size - 1);
+        s_buffer[size - 1] = 0;  // terminate string
+        cJSON* data = cJSON_Parse(s_buffer.data());
+        if (data != nullptr) {
+          cJSON_Delete(data);
+        }
+      }
+      break;
+    }
+    case BA_PACKET_REMOTE_PING:
+    case BA_PACKET_REMOTE_PONG:
+    case BA_PACKET_REMOTE_ID_REQUEST:
+    case BA_PACKET_REMOTE_ID_RESPONSE:
+    case BA_PACKET_REMOTE_DISCONNECT:
+    case BA_PACKET_REMOTE_STATE:
+    case BA_PACKET_REMOTE_STATE2:
+    case BA_PACKET_REMOTE_STATE_ACK:
+    case BA_PACKET_REMOTE_DISCONNECT_ACK:
+    case BA_PACKET_REMOTE_GAME_QUERY:
+    case BA_PACKET_REMOTE_GAME_RESPONSE:
+      // These packets are associated with the remote app; let the
+      // remote server handle them.
+      if (remote_server_) {
+        remote_server_->HandleData(sd, reinterpret_cast<uint8_t*>(buffer),
+                                   size, reinterpret_cast<sockaddr*>(from),
+                                   static_cast<size_t>(from_size));
+      }
+      break;
+
+    case BA_PACKET_CLIENT_REQUEST:
+    case BA_PACKET_CLIENT_ACCEPT:
+    case BA_PACKET_CLIENT_DENY:
+    case BA_PACKET_CLIENT_DENY_ALREADY_IN_PARTY:
+    case BA_PACKET_CLIENT_DENY_VERSION_MISMATCH:
+    case BA_PACKET_CLIENT_DENY_PARTY_FULL:
+    case BA_PACKET_DISCONNECT_FROM_CLIENT_REQUEST:
+    case BA_PACKET_DISCONNECT_FROM_CLIENT_ACK:
+    case BA_PACKET_DISCONNECT_FROM_HOST_REQUEST:
+    case BA_PACKET_DISCONNECT_FROM_HOST_ACK:
+    case BA_PACKET_CLIENT_GAMEPACKET_COMPRESSED:
+    case BA_PACKET_HOST_GAMEPACKET_COMPRESSED: {
+      // These messages are associated with udp host/client
+      // connections.. pass them to the logic thread to wrangle.
+      std::vector<uint8_t> msg_buffer(size);
+      memcpy(msg_buffer.data(), buffer, size);
+      PushIncomingUDPPacketCall_(msg_buffer, SockAddr(*from));
+      break;
+    }
+
+    case BA_PACKET_HOST_QUERY: {
+      g_base->app_mode()->HandleGameQuery(buffer, size, from);
+
+      // HandleGameQuery(buffer, size, from);
+      break;
+    }
+
+    default:
+      break;
+  }
+}
+
+void NetworkReader::StartRecording(const std::string& path) {
+  auto recorder = std::make_unique<UDPRecordingWriter>(path);
+  std::scoped_lock lock(recorder_mutex_);
+  recorder_ = std::move(recorder);
+  Log(LogLevel::kInfo, "Recording incoming udp packets to '" + path + "'.");
+}
+
+void NetworkReader::StopRecording() {
+  std::scoped_lock lock(recorder_mutex_);
+  if (recorder_) {
+    Log(LogLevel::kInfo, "Recorded " + std::to_string(recorder_->packet_count())
+                             + " udp packets to '" + recorder_->path() + "'.");
+    recorder_.reset();
+  }
+}
+
+void NetworkReader::RecordPacket_(const char* buffer, size_t size,
+                                  const sockaddr_storage& from) {
+  std::scoped_lock lock(recorder_mutex_);
+  if (recorder_) {
+    recorder_->Write(reinterpret_cast<const uint8_t*>(buffer), size, from);
+  }
+}
+
+void NetworkReader::RunReplay_(const std::string& path, double speed) {
+  // Recordings start when sockets open, which is the point we're at now,
+  // so packets land at the same point in app startup as they originally
+  // did. A speed of zero or less replays as fast as the logic thread can
+  // take packets.
+  std::unique_ptr<UDPRecordingReader> reader;
+  try {
+    reader = std::make_unique<UDPRecordingReader>(path);
+  } catch (const Exception& exc) {
+    Log(LogLevel::kError, exc.what());
+    return;
+  }
+  Log(LogLevel::kInfo, "Replaying udp recording '" + path + "' at speed "
+                           + std::to_string(speed) + ".");
+
+  auto start_time = core::CorePlatform::GetCurrentMicrosecs();
+  UDPRecordingReader::Packet packet;
+  int64_t packet_count{};
+  microsecs_t recorded_duration{};
+  while (reader->Read(&packet)) {
+    recorded_duration = packet.time;
+    if (speed > 0.0) {
+      auto target_time =
+          start_time + static_cast<microsecs_t>(packet.time / speed);
+      auto now = core::CorePlatform::GetCurrentMicrosecs();
+      if (target_time > now) {
+        core::CorePlatform::SleepMicrosecs(target_time - now);
+      }
+    } else {
+      // Live packets get dropped when the logic thread falls behind, but
+      // here we'd rather wait so that runs are repeatable.
+      while (!g_base->logic->event_loop()->CheckPushSafety()) {
+        core::CorePlatform::SleepMillisecs(1);
+      }
+    }
+    HandlePacket_(-1, reinterpret_cast<char*>(packet.data.data()),
+                  packet.data.size(), &packet.from, packet.from_size);
+    packet_count++;
+  }
+
+  auto elapsed = core::CorePlatform::GetCurrentMicrosecs() - start_time;
+  char buffer[256];
+  snprintf(buffer, sizeof(buffer),
+           "Udp replay complete: %lld packets spanning %.2fs replayed in "
+           "%.2fs (%.0f packets/s).",
+           static_cast<long long>(packet_count),  // NOLINT
+           static_cast<double>(recorded_duration) / 1000000.0,
+           static_cast<double>(elapsed) / 1000000.0,
+           elapsed > 0 ? static_cast<double>(packet_count) * 1000000.0
+                             / static_cast<double>(elapsed)
+                       : 0.0);
+  Log(LogLevel::kInfo, buffer);
+}
+
 void NetworkReader::PushIncomingUDPPacketCall_(const std::vector<uint8_t>& data,
                                                const SockAddr& addr) {
   // Avoid buffer-full errors if something is causing us to write too often;
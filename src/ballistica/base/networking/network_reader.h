@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "ballistica/base/base.h"
+#include "ballistica/shared/networking/networking_sys.h"
 
 namespace ballistica::base {
 
@@ -32,12 +33,23 @@ class NetworkReader {
   auto sd4() const { return sd4_; }
   auto sd6() const { return sd6_; }
 
+  /// Start writing all incoming packets to a file for later replay (see
+  /// UDPRecordingWriter). Throws an Exception if the file can't be opened.
+  /// Can be called from any thread.
+  void StartRecording(const std::string& path);
+  void StopRecording();
+
  private:
   void DoSelect_(bool* can_read_4, bool* can_read_6);
   void DoPoll_(bool* can_read_4, bool* can_read_6);
   void OpenSockets_();
   void PokeSelf_();
   auto RunThread_() -> int;
+  void HandlePacket_(int sd, char* buffer, size_t size,
+                     sockaddr_storage* from, socklen_t from_size);
+  void RecordPacket_(const char* buffer, size_t size,
+                     const sockaddr_storage& from);
+  void RunReplay_(const std::string& path, double speed);
   void PushIncomingUDPPacketCall_(const std::vector<uint8_t>& data,
                                   const SockAddr& addr);
   static auto RunThreadStatic_(void* self) -> int {
@@ -58,6 +70,8 @@ class NetworkReader {
   std::mutex paused_mutex_;
   std::condition_variable paused_cv_;
   std::unique_ptr<RemoteAppServer> remote_server_;
+  std::mutex recorder_mutex_;
+  std::unique_ptr<UDPRecordingWriter> recorder_;
 };
 
 }  // namespace ballistica::base
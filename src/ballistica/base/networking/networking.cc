@@ -19,6 +19,11 @@ void Networking::DoApplyAppConfig() {
   // Grab network settings from config and kick them over to the main
   // thread to be applied.
   int port = g_base->app_config->Resolve(AppConfig::IntID::kPort);
+
+  // Preforked servers each take their own port above the configured one.
+  if (auto worker_index = g_core->prefork_worker_index()) {
+    port += *worker_index;
+  }
   g_base->app_adapter->PushMainThreadCall([port] {
     assert(g_core->InMainThread());
     g_base->network_reader->SetPort(port);
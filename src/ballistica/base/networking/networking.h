@@ -106,13 +106,6 @@ namespace ballistica::base {
 // Enable huffman compression for all net packets?
 #define BA_HUFFMAN_NET_COMPRESSION 1
 
-// Enable training mode to build the huffman tree.
-// This will spit a C array of ints to stdout based on net data.
-// we currently hard code our tree.
-#if !BA_HUFFMAN_NET_COMPRESSION
-#define HUFFMAN_TRAINING_MODE 0
-#endif
-
 // Singleton based in the main thread for wrangling network stuff.
 class Networking {
  public:
@@ -0,0 +1,141 @@
+// Released under the MIT License. See LICENSE for details.
+
+#include "ballistica/base/networking/udp_recording.h"
+
+#include <cstring>
+#include <string>
+
+#include "ballistica/core/core.h"
+#include "ballistica/core/platform/core_platform.h"
+
+namespace ballistica::base {
+
+// Bump the version number whenever the record layout changes.
+static const char kUDPRecordingMagic[8] = {'B', 'A', 'U', 'D',
+                                           'P', 'R', 'C', '1'};
+
+// Anything bigger than this is a corrupt record; UDP can't carry it.
+const uint32_t kUDPRecordingMaxPacketSize{65536};
+
+// Per-packet header: time, family, address, port, data size.
+struct UDPRecordHeader {
+  int64_t time;
+  uint8_t v6;
+  uint8_t addr[16];
+  uint16_t port;  // Network byte order.
+  uint32_t size;
+};
+
+static auto WriteRecordHeader(FILE* file, const UDPRecordHeader& header)
+    -> bool {
+  return fwrite(&header.time, sizeof(header.time), 1, file) == 1
+         && fwrite(&header.v6, sizeof(header.v6), 1, file) == 1
+         && fwrite(header.addr, sizeof(header.addr), 1, file) == 1
+         && fwrite(&header.port, sizeof(header.port), 1, file) == 1
+         && fwrite(&header.size, sizeof(header.size), 1, file) == 1;
+}
+
+static auto ReadRecordHeader(FILE* file, UDPRecordHeader* header) -> bool {
+  return fread(&header->time, sizeof(header->time), 1, file) == 1
+         && fread(&header->v6, sizeof(header->v6), 1, file) == 1
+         && fread(header->addr, sizeof(header->addr), 1, file) == 1
+         && fread(&header->port, sizeof(header->port), 1, file) == 1
+         && fread(&header->size, sizeof(header->size), 1, file) == 1;
+}
+
+UDPRecordingWriter::UDPRecordingWriter(const std::string& path)
+    : path_(path), start_time_(core::CorePlatform::GetCurrentMicrosecs()) {
+  file_ = g_core->platform->FOpen(path.c_str(), "wb");
+  if (!file_) {
+    throw Exception("Unable to open UDP recording for writing: '" + path
+                    + "'.");
+  }
+  if (fwrite(kUDPRecordingMagic, sizeof(kUDPRecordingMagic), 1, file_) != 1) {
+    fclose(file_);
+    file_ = nullptr;
+    throw Exception("Unable to write UDP recording header: '" + path + "'.");
+  }
+}
+
+UDPRecordingWriter::~UDPRecordingWriter() {
+  if (file_) {
+    fclose(file_);
+  }
+}
+
+void UDPRecordingWriter::Write(const uint8_t* data, size_t size,
+                               const sockaddr_storage& from) {
+  assert(file_);
+  UDPRecordHeader header{};
+  header.time = core::CorePlatform::GetCurrentMicrosecs() - start_time_;
+  if (from.ss_family == AF_INET6) {
+    auto* addr = reinterpret_cast<const sockaddr_in6*>(&from);
+    header.v6 = 1;
+    memcpy(header.addr, &addr->sin6_addr, sizeof(addr->sin6_addr));
+    header.port = addr->sin6_port;
+  } else {
+    auto* addr = reinterpret_cast<const sockaddr_in*>(&from);
+    memcpy(header.addr, &addr->sin_addr, sizeof(addr->sin_addr));
+    header.port = addr->sin_port;
+  }
+  header.size = static_cast<uint32_t>(size);
+
+  // Flushing per packet costs a bit, but means a recording of a server
+  // that crashes is still usable (which is often the point).
+  if (!WriteRecordHeader(file_, header) || fwrite(data, 1, size, file_) != size
+      || fflush(file_) != 0) {
+    BA_LOG_ONCE(LogLevel::kError,
+                "Error writing to UDP recording '" + path_ + "'.");
+    return;
+  }
+  packet_count_++;
+}
+
+UDPRecordingReader::UDPRecordingReader(const std::string& path) {
+  file_ = g_core->platform->FOpen(path.c_str(), "rb");
+  if (!file_) {
+    throw Exception("Unable to open UDP recording: '" + path + "'.");
+  }
+  char magic[sizeof(kUDPRecordingMagic)];
+  if (fread(magic, sizeof(magic), 1, file_) != 1
+      || memcmp(magic, kUDPRecordingMagic, sizeof(magic)) != 0) {
+    fclose(file_);
+    file_ = nullptr;
+    throw Exception("Not a UDP recording (or an incompatible version): '"
+                    + path + "'.");
+  }
+}
+
+UDPRecordingReader::~UDPRecordingReader() {
+  if (file_) {
+    fclose(file_);
+  }
+}
+
+auto UDPRecordingReader::Read(Packet* packet) -> bool {
+  assert(packet);
+  UDPRecordHeader header{};
+  if (!ReadRecordHeader(file_, &header) || header.size == 0
+      || header.size > kUDPRecordingMaxPacketSize) {
+    return false;
+  }
+  packet->time = header.time;
+  packet->from = {};
+  if (header.v6) {
+    auto* addr = reinterpret_cast<sockaddr_in6*>(&packet->from);
+    addr->sin6_family = AF_INET6;
+    memcpy(&addr->sin6_addr, header.addr, sizeof(addr->sin6_addr));
+    addr->sin6_port = header.port;
+    packet->from_size = sizeof(sockaddr_in6);
+  } else {
+    auto* addr = reinterpret_cast<sockaddr_in*>(&packet->from);
+    addr->sin_family = AF_INET;
+    memcpy(&addr->sin_addr, header.addr, sizeof(addr->sin_addr));
+    addr->sin_port = header.port;
+    packet->from_size = sizeof(sockaddr_in);
+  }
+  packet->data.resize(header.size);
+  return fread(packet->data.data(), 1, header.size, file_) == header.size;
+}
+
+}  // namespace ballistica::base
@@ -0,0 +1,66 @@
+// Released under the MIT License. See LICENSE for details.
+
+#ifndef BALLISTICA_BASE_NETWORKING_UDP_RECORDING_H_
+#define BALLISTICA_BASE_NETWORKING_UDP_RECORDING_H_
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "ballistica/base/base.h"
+#include "ballistica/shared/networking/networking_sys.h"
+
+namespace ballistica::base {
+
+/// Writes incoming datagrams to a file for later replay.
+///
+/// A recording is a short header followed by one record per packet: a
+/// timestamp relative to the start of the recording, the source address,
+/// and the raw packet data. Values are stored in native byte order;
+/// recordings are meant for replaying on the same sort of machine they
+/// were captured on.
+class UDPRecordingWriter {
+ public:
+  /// Opens the file for writing; throws an Exception on failure.
+  explicit UDPRecordingWriter(const std::string& path);
+  ~UDPRecordingWriter();
+
+  void Write(const uint8_t* data, size_t size, const sockaddr_storage& from);
+
+  auto path() const -> const std::string& { return path_; }
+  auto packet_count() const { return packet_count_; }
+
+ private:
+  std::string path_;
+  FILE* file_{};
+  microsecs_t start_time_{};
+  int64_t packet_count_{};
+};
+
+/// Reads back packets written by a UDPRecordingWriter.
+class UDPRecordingReader {
+ public:
+  struct Packet {
+    microsecs_t time{};
+    sockaddr_storage from{};
+    socklen_t from_size{};
+    std::vector<uint8_t> data;
+  };
+
+  /// Opens the file for reading; throws an Exception on failure or if
+  /// the file is not a recording.
+  explicit UDPRecordingReader(const std::string& path);
+  ~UDPRecordingReader();
+
+  /// Read the next packet. Returns false once the recording is exhausted
+  /// (a truncated final record, as left by a crashed recorder, simply
+  /// ends the recording).
+  auto Read(Packet* packet) -> bool;
+
+ private:
+  FILE* file_{};
+};
+
+}  // namespace ballistica::base
+
+#endif  // BALLISTICA_BASE_NETWORKING_UDP_RECORDING_H_
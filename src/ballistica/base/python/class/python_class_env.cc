@@ -16,6 +16,17 @@ static std::map<std::string, EnvEntry_>* g_entries_{};
 
 auto PythonClassEnv::type_name() -> const char* { return "Env"; }
 
+void PythonClassEnv::UpdateConfigFilePath() {
+  assert(Python::HaveGIL());
+  if (!g_entries_) {
+    return;
+  }
+  auto& entry{(*g_entries_)["config_file_path"]};
+  Py_XDECREF(entry.obj);
+  entry.obj =
+      PyUnicode_FromString(g_core->platform->GetConfigFilePath().c_str());
+}
+
 static auto BoolEntry_(bool val, const char* docs) -> EnvEntry_ {
   PyObject* pyval = val ? Py_True : Py_False;
   Py_INCREF(pyval);
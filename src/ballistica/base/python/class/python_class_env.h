@@ -12,6 +12,10 @@ namespace ballistica::base {
 class PythonClassEnv : public PythonClass {
  public:
   static void SetupType(PyTypeObject* cls);
+
+  /// Update our config path if the config dir has changed since we were
+  /// set up (as happens in preforked servers).
+  static void UpdateConfigFilePath();
   static auto type_name() -> const char*;
   static auto tp_getattro(PythonClassEnv* self, PyObject* attr) -> PyObject*;
   static auto Check(PyObject* o) -> bool {
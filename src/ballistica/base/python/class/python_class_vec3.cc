@@ -20,6 +20,13 @@ namespace ballistica::base {
 
 static const int kMemberCount = 3;
 
+// Game code tends to churn through lots of short-lived vectors, so we
+// keep some dead ones around to skip the allocator. Only touched with the
+// GIL held.
+static const int kMaxFreeListSize = 256;
+static PyObject* g_vec3_free_list[kMaxFreeListSize];
+static int g_vec3_free_list_size{};
+
 PyTypeObject PythonClassVec3::type_obj;
 PySequenceMethods PythonClassVec3::as_sequence_;
 PyNumberMethods PythonClassVec3::as_number_;
@@ -53,6 +60,7 @@ void PythonClassVec3::SetupType(PyTypeObject* cls) {
       "      The vector's Z component.\n";
 
   cls->tp_new = tp_new;
+  cls->tp_dealloc = (destructor)tp_dealloc;
   cls->tp_repr = (reprfunc)tp_repr;
   cls->tp_methods = tp_methods;
   cls->tp_getattro = (getattrofunc)tp_getattro;
@@ -79,17 +87,38 @@ void PythonClassVec3::SetupType(PyTypeObject* cls) {
 }
 
 auto PythonClassVec3::Create(const Vector3f& val) -> PyObject* {
-  auto obj =
-      reinterpret_cast<PythonClassVec3*>(type_obj.tp_alloc(&type_obj, 0));
+  PythonClassVec3* obj;
+  if (g_vec3_free_list_size > 0) {
+    PyObject* recycled = g_vec3_free_list[--g_vec3_free_list_size];
+    obj = reinterpret_cast<PythonClassVec3*>(
+        PyObject_Init(recycled, &type_obj));
+  } else {
+    obj = reinterpret_cast<PythonClassVec3*>(type_obj.tp_alloc(&type_obj, 0));
+  }
   if (obj) {
     obj->value = val;
   }
   return reinterpret_cast<PyObject*>(obj);
 }
 
+void PythonClassVec3::tp_dealloc(PythonClassVec3* self) {
+  // Hold on to plain Vec3s for reuse (subclasses may carry extra data so
+  // they always go the normal route).
+  if (Py_TYPE(self) == &type_obj
+      && g_vec3_free_list_size < kMaxFreeListSize) {
+    g_vec3_free_list[g_vec3_free_list_size++] =
+        reinterpret_cast<PyObject*>(self);
+    return;
+  }
+  Py_TYPE(self)->tp_free(reinterpret_cast<PyObject*>(self));
+}
+
 auto PythonClassVec3::tp_new(PyTypeObject* type, PyObject* args,
                              PyObject* keywds) -> PyObject* {
-  auto self = reinterpret_cast<PythonClassVec3*>(type->tp_alloc(type, 0));
+  // Plain Vec3s can come from our free-list.
+  auto self = reinterpret_cast<PythonClassVec3*>(
+      type == &type_obj ? Create(Vector3f(0.0f, 0.0f, 0.0f))
+                        : type->tp_alloc(type, 0));
   if (!self) {
     return nullptr;
   }
@@ -290,6 +319,39 @@ auto PythonClassVec3::Cross(PythonClassVec3* self,
   BA_PYTHON_CATCH;
 }
 
+auto PythonClassVec3::LengthSquared(PythonClassVec3* self) -> PyObject* {
+  BA_PYTHON_TRY;
+  return PyFloat_FromDouble(self->value.LengthSquared());
+  BA_PYTHON_CATCH;
+}
+
+auto PythonClassVec3::Distance(PythonClassVec3* self,
+                               PyObject* other) -> PyObject* {
+  BA_PYTHON_TRY;
+  return PyFloat_FromDouble(
+      (self->value - BasePython::GetPyVector3f(other)).Length());
+  BA_PYTHON_CATCH;
+}
+
+auto PythonClassVec3::Normalize(PythonClassVec3* self) -> PyObject* {
+  BA_PYTHON_TRY;
+  self->value.Normalize();
+  Py_RETURN_NONE;
+  BA_PYTHON_CATCH;
+}
+
+auto PythonClassVec3::Lerp(PythonClassVec3* self, PyObject* args) -> PyObject* {
+  BA_PYTHON_TRY;
+  PyObject* other;
+  float t;
+  if (!PyArg_ParseTuple(args, "Of", &other, &t)) {
+    return nullptr;
+  }
+  Vector3f target(BasePython::GetPyVector3f(other));
+  return Create(self->value + (target - self->value) * t);
+  BA_PYTHON_CATCH;
+}
+
 PyMethodDef PythonClassVec3::tp_methods[] = {
     {"length", (PyCFunction)Length, METH_NOARGS,
      "length() -> float\n"
@@ -307,6 +369,22 @@ PyMethodDef PythonClassVec3::tp_methods[] = {
      "cross(other: Vec3) -> Vec3\n"
      "\n"
      "Returns the cross product of this vector and another."},
+    {"length_squared", (PyCFunction)LengthSquared, METH_NOARGS,
+     "length_squared() -> float\n"
+     "\n"
+     "Returns the squared length of the vector (cheaper than length())."},
+    {"distance", (PyCFunction)Distance, METH_O,
+     "distance(other: Vec3) -> float\n"
+     "\n"
+     "Returns the distance between this vector and another."},
+    {"normalize", (PyCFunction)Normalize, METH_NOARGS,
+     "normalize() -> None\n"
+     "\n"
+     "Normalizes the vector in place. Zero-length vectors are unchanged."},
+    {"lerp", (PyCFunction)Lerp, METH_VARARGS,
+     "lerp(other: Vec3, t: float) -> Vec3\n"
+     "\n"
+     "Returns a vector t of the way from this one to another."},
     {nullptr}};
 
 auto PythonClassVec3::tp_getattro(PythonClassVec3* self,
@@ -20,6 +20,10 @@ class PythonClassVec3 : public PythonClass {
   static auto Normalized(PythonClassVec3* self) -> PyObject*;
   static auto Dot(PythonClassVec3* self, PyObject* other) -> PyObject*;
   static auto Cross(PythonClassVec3* self, PyObject* other) -> PyObject*;
+  static auto LengthSquared(PythonClassVec3* self) -> PyObject*;
+  static auto Distance(PythonClassVec3* self, PyObject* other) -> PyObject*;
+  static auto Normalize(PythonClassVec3* self) -> PyObject*;
+  static auto Lerp(PythonClassVec3* self, PyObject* args) -> PyObject*;
   static PyTypeObject type_obj;
   Vector3f value;
 
@@ -36,6 +40,7 @@ class PythonClassVec3 : public PythonClass {
   static auto nb_subtract(PythonClassVec3* l, PythonClassVec3* r) -> PyObject*;
   static auto nb_multiply(PyObject* l, PyObject* r) -> PyObject*;
   static auto nb_negative(PythonClassVec3* self) -> PyObject*;
+  static void tp_dealloc(PythonClassVec3* self);
   static auto tp_new(PyTypeObject* type, PyObject* args,
                      PyObject* keywds) -> PyObject*;
   static auto tp_getattro(PythonClassVec3* self, PyObject* attr) -> PyObject*;
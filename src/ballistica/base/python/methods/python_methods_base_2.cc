@@ -659,6 +659,40 @@ static PyMethodDef PyHaveCharsDef = {
     "(internal)",
 };
 
+// ------------------------ text_mesh_cache_stats -----------------------------
+
+static auto PyTextMeshCacheStats(PyObject* self) -> PyObject* {
+  BA_PYTHON_TRY;
+  BA_PRECONDITION(g_base->InLogicThread());
+  auto* tg = g_base->text_graphics;
+  return Py_BuildValue(
+      "{sLsLsLsLsLsi}", "group_reuses",
+      static_cast<long long>(tg->text_group_reuse_count()),  // NOLINT
+      "cache_hits",
+      static_cast<long long>(tg->text_mesh_cache_hit_count()),  // NOLINT
+      "cache_misses",
+      static_cast<long long>(tg->text_mesh_cache_miss_count()),  // NOLINT
+      "incremental_builds",
+      static_cast<long long>(  // NOLINT
+          tg->text_mesh_incremental_build_count()),
+      "full_builds",
+      static_cast<long long>(tg->text_mesh_full_build_count()),  // NOLINT
+      "cache_size", tg->text_mesh_cache_size());
+  BA_PYTHON_CATCH;
+}
+
+static PyMethodDef PyTextMeshCacheStatsDef = {
+    "text_mesh_cache_stats",            // name
+    (PyCFunction)PyTextMeshCacheStats,  // method
+    METH_NOARGS,                        // flags
+
+    "text_mesh_cache_stats() -> dict[str, int]\n"
+    "\n"
+    "(internal)\n"
+    "\n"
+    "Return counts of text geometry reuse and generation.",
+};
+
 // ----------------------------- fade_screen -----------------------------------
 
 static auto PyFadeScreen(PyObject* self, PyObject* args,
@@ -946,6 +980,7 @@ auto PythonMethodsBase2::GetMethods() -> std::vector<PyMethodDef> {
       PySetCameraManualDef,
       PyAddCleanFrameCallbackDef,
       PyHaveCharsDef,
+      PyTextMeshCacheStatsDef,
       PyFadeScreenDef,
       PyScreenMessageDef,
       PyGetStringWidthDef,
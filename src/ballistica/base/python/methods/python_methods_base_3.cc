@@ -2,18 +2,27 @@
 
 #include "ballistica/base/python/methods/python_methods_base_3.h"
 
+#include <algorithm>
 #include <list>
 #include <unordered_map>
 
 #include "ballistica/base/app_adapter/app_adapter.h"
 #include "ballistica/base/assets/sound_asset.h"
+#include "ballistica/base/dynamics/bg/bg_dynamics_server.h"
+#include "ballistica/base/graphics/graphics_server.h"
+#include "ballistica/base/graphics/renderer/renderer.h"
 #include "ballistica/base/input/input.h"
+#include "ballistica/base/logic/logic.h"
+#include "ballistica/base/networking/network_reader.h"
 #include "ballistica/base/platform/base_platform.h"
 #include "ballistica/base/python/base_python.h"
 #include "ballistica/base/python/class/python_class_simple_sound.h"
 #include "ballistica/base/support/app_config.h"
+#include "ballistica/base/support/context_accounting.h"
+#include "ballistica/base/support/native_tests.h"
 #include "ballistica/base/ui/dev_console.h"
 #include "ballistica/base/ui/ui.h"
+#include "ballistica/shared/foundation/event_loop.h"
 #include "ballistica/shared/generic/native_stack_trace.h"
 #include "ballistica/shared/generic/utils.h"
 
@@ -1826,6 +1835,416 @@ static PyMethodDef PyGetInputIdleTimeDef = {
     "\n"
     "Return seconds since any local input occurred (touch, keypress, etc.).",
 };
+
+// ------------------------ set_input_latency_tracing --------------------------
+
+static auto PySetInputLatencyTracing(PyObject* self, PyObject* args,
+                                     PyObject* keywds) -> PyObject* {
+  BA_PYTHON_TRY;
+
+  int enabled{};
+  static const char* kwlist[] = {"enabled", nullptr};
+  if (!PyArg_ParseTupleAndKeywords(args, keywds, "p",
+                                   const_cast<char**>(kwlist), &enabled)) {
+    return nullptr;
+  }
+  g_base->input->latency_tracer()->SetEnabled(enabled);
+  Py_RETURN_NONE;
+  BA_PYTHON_CATCH;
+}
+
+static PyMethodDef PySetInputLatencyTracingDef = {
+    "set_input_latency_tracing",            // name
+    (PyCFunction)PySetInputLatencyTracing,  // method
+    METH_VARARGS | METH_KEYWORDS,           // flags
+
+    "set_input_latency_tracing(enabled: bool) -> None\n"
+    "\n"
+    "(internal)\n"
+    "\n"
+    "Enable or disable timing of input events through to the screen.\n"
+    "While enabled, results show up in a 'Latency' dev-console tab.",
+};
+
+// ------------------------ get_input_latency_stats ----------------------------
+
+static auto PyGetInputLatencyStats(PyObject* self) -> PyObject* {
+  BA_PYTHON_TRY;
+
+  return PyUnicode_FromString(
+      g_base->input->latency_tracer()->GetStatsJSON().c_str());
+
+  BA_PYTHON_CATCH;
+}
+
+static PyMethodDef PyGetInputLatencyStatsDef = {
+    "get_input_latency_stats",            // name
+    (PyCFunction)PyGetInputLatencyStats,  // method
+    METH_NOARGS,                          // flags
+
+    "get_input_latency_stats() -> str\n"
+    "\n"
+    "(internal)\n"
+    "\n"
+    "Return input latency histograms as a json string.",
+};
+
+// ------------------------ reset_input_latency_stats --------------------------
+
+static auto PyResetInputLatencyStats(PyObject* self) -> PyObject* {
+  BA_PYTHON_TRY;
+
+  g_base->input->latency_tracer()->Reset();
+  Py_RETURN_NONE;
+
+  BA_PYTHON_CATCH;
+}
+
+static PyMethodDef PyResetInputLatencyStatsDef = {
+    "reset_input_latency_stats",            // name
+    (PyCFunction)PyResetInputLatencyStats,  // method
+    METH_NOARGS,                            // flags
+
+    "reset_input_latency_stats() -> None\n"
+    "\n"
+    "(internal)\n"
+    "\n"
+    "Clear all recorded input latency samples.",
+};
+
+// ----------------------------- set_udp_recording -----------------------------
+
+static auto PySetUDPRecording(PyObject* self, PyObject* args,
+                              PyObject* keywds) -> PyObject* {
+  BA_PYTHON_TRY;
+
+  PyObject* path_obj;
+  static const char* kwlist[] = {"path", nullptr};
+  if (!PyArg_ParseTupleAndKeywords(args, keywds, "O",
+                                   const_cast<char**>(kwlist), &path_obj)) {
+    return nullptr;
+  }
+  assert(g_base->network_reader);
+  if (path_obj == Py_None) {
+    g_base->network_reader->StopRecording();
+  } else {
+    g_base->network_reader->StartRecording(Python::GetPyString(path_obj));
+  }
+  Py_RETURN_NONE;
+  BA_PYTHON_CATCH;
+}
+
+static PyMethodDef PySetUDPRecordingDef = {
+    "set_udp_recording",             // name
+    (PyCFunction)PySetUDPRecording,  // method
+    METH_VARARGS | METH_KEYWORDS,    // flags
+
+    "set_udp_recording(path: str | None) -> None\n"
+    "\n"
+    "(internal)\n"
+    "\n"
+    "Start recording incoming udp packets to a file, or stop if None.",
+};
+
+// ------------------------ print_runnable_alloc_stats -------------------------
+
+static auto PyPrintRunnableAllocStats(PyObject* self) -> PyObject* {
+  BA_PYTHON_TRY;
+  EventLoop::LogRunnableAllocStats();
+  Py_RETURN_NONE;
+  BA_PYTHON_CATCH;
+}
+
+static PyMethodDef PyPrintRunnableAllocStatsDef = {
+    "print_runnable_alloc_stats",            // name
+    (PyCFunction)PyPrintRunnableAllocStats,  // method
+    METH_NOARGS,                             // flags
+
+    "print_runnable_alloc_stats() -> None\n"
+    "\n"
+    "(internal)\n"
+    "\n"
+    "Log pooled runnable allocation counts for each event loop.",
+};
+
+// --------------------------- get_logic_step_stats ----------------------------
+
+static auto PyGetLogicStepStats(PyObject* self) -> PyObject* {
+  BA_PYTHON_TRY;
+  BA_PRECONDITION(g_base->InLogicThread());
+  auto* logic = g_base->logic;
+  return Py_BuildValue(
+      "{sLsdsdsLsdsdsL}", "steps", static_cast<long long>(logic->step_count()),
+      "step_time_total", static_cast<double>(logic->step_time_total()) / 1e6,
+      "step_time_max", static_cast<double>(logic->step_time_max()) / 1e6,
+      "overruns", static_cast<long long>(logic->step_overrun_count()),
+      "overrun_time_total",
+      static_cast<double>(logic->step_overrun_time_total()) / 1e6,
+      "overrun_max", static_cast<double>(logic->step_overrun_max()) / 1e6,
+      "deferred_work", static_cast<long long>(logic->deferred_work_count()));
+  BA_PYTHON_CATCH;
+}
+
+static PyMethodDef PyGetLogicStepStatsDef = {
+    "get_logic_step_stats",            // name
+    (PyCFunction)PyGetLogicStepStats,  // method
+    METH_NOARGS,                       // flags
+
+    "get_logic_step_stats() -> dict[str, float]\n"
+    "\n"
+    "(internal)\n"
+    "\n"
+    "Return logic display-time step timing, deadline overrun (times in\n"
+    "seconds) and deferred work counts since launch.",
+};
+
+// ------------------------- get_renderer_media_stats --------------------------
+
+static auto PyGetRendererMediaStats(PyObject* self) -> PyObject* {
+  BA_PYTHON_TRY;
+  int64_t uploads{};
+  int64_t deferred{};
+  int64_t placeholder_draws{};
+  if (auto* renderer = g_base->graphics_server->renderer()) {
+    uploads = renderer->media_upload_count();
+    deferred = renderer->media_deferred_count();
+    placeholder_draws = renderer->placeholder_draw_count();
+  }
+  return Py_BuildValue("{sLsLsL}", "uploads", static_cast<long long>(uploads),
+                       "deferred", static_cast<long long>(deferred),
+                       "placeholder_draws",
+                       static_cast<long long>(placeholder_draws));
+  BA_PYTHON_CATCH;
+}
+
+static PyMethodDef PyGetRendererMediaStatsDef = {
+    "get_renderer_media_stats",            // name
+    (PyCFunction)PyGetRendererMediaStats,  // method
+    METH_NOARGS,                           // flags
+
+    "get_renderer_media_stats() -> dict[str, int]\n"
+    "\n"
+    "(internal)\n"
+    "\n"
+    "Return counts of in-frame media uploads, media put off to later\n"
+    "frames, and draws that used placeholders as a result.",
+};
+
+// ----------------------- get_dynamic_resolution_stats ------------------------
+
+static auto PyGetDynamicResolutionStats(PyObject* self) -> PyObject* {
+  BA_PYTHON_TRY;
+  auto& dynres = g_base->graphics_server->dynamic_resolution();
+  return Py_BuildValue(
+      "{sOsdsisdsL}", "enabled", dynres.enabled() ? Py_True : Py_False,
+      "scale", static_cast<double>(dynres.scale()), "target_fps",
+      dynres.target_fps(), "average_render_time_ms",
+      static_cast<double>(dynres.average_render_time()) / 1000.0, "changes",
+      static_cast<long long>(dynres.change_count()));
+  BA_PYTHON_CATCH;
+}
+
+static PyMethodDef PyGetDynamicResolutionStatsDef = {
+    "get_dynamic_resolution_stats",            // name
+    (PyCFunction)PyGetDynamicResolutionStats,  // method
+    METH_NOARGS,                               // flags
+
+    "get_dynamic_resolution_stats() -> dict[str, Any]\n"
+    "\n"
+    "(internal)\n"
+    "\n"
+    "Return the current dynamic-resolution pixel-scale along with its\n"
+    "target frame rate, the recent average time spent rendering a frame,\n"
+    "and how many times the scale has changed.",
+};
+
+// ------------------------ get_bg_dynamics_load_stats -------------------------
+
+static auto PyGetBGDynamicsLoadStats(PyObject* self) -> PyObject* {
+  BA_PYTHON_TRY;
+  auto* server = g_base->bg_dynamics_server;
+  if (server == nullptr) {
+    Py_RETURN_NONE;
+  }
+  return Py_BuildValue(
+      "{sOsdsdsdsLsLsL}", "governor_enabled",
+      server->governor_enabled() ? Py_True : Py_False, "load_scale",
+      static_cast<double>(server->load_scale()), "average_step_cost_ms",
+      static_cast<double>(server->average_step_cost()) / 1000.0,
+      "step_budget_ms", static_cast<double>(server->step_budget()) / 1000.0,
+      "throttled_emits",
+      static_cast<long long>(server->throttled_emit_count()),
+      "skipped_shadows",
+      static_cast<long long>(server->skipped_shadow_count()),
+      "too_slow_events", static_cast<long long>(server->too_slow_count()));
+  BA_PYTHON_CATCH;
+}
+
+static PyMethodDef PyGetBGDynamicsLoadStatsDef = {
+    "get_bg_dynamics_load_stats",           // name
+    (PyCFunction)PyGetBGDynamicsLoadStats,  // method
+    METH_NOARGS,                            // flags
+
+    "get_bg_dynamics_load_stats() -> dict[str, Any] | None\n"
+    "\n"
+    "(internal)\n"
+    "\n"
+    "Return the state of the bg-dynamics load governor: its current load\n"
+    "scale, recent average step cost against its budget, and how many\n"
+    "emissions and shadows it has held back. Returns None when running\n"
+    "headless.",
+};
+
+// ---------------------- set_context_accounting_enabled -----------------------
+
+static auto PySetContextAccountingEnabled(PyObject* self, PyObject* args,
+                                          PyObject* keywds) -> PyObject* {
+  BA_PYTHON_TRY;
+
+  int enabled{};
+  static const char* kwlist[] = {"enabled", nullptr};
+  if (!PyArg_ParseTupleAndKeywords(args, keywds, "p",
+                                   const_cast<char**>(kwlist), &enabled)) {
+    return nullptr;
+  }
+  BA_PRECONDITION(g_base->InLogicThread());
+  g_base->context_accounting->SetEnabled(enabled);
+  Py_RETURN_NONE;
+  BA_PYTHON_CATCH;
+}
+
+static PyMethodDef PySetContextAccountingEnabledDef = {
+    "set_context_accounting_enabled",            // name
+    (PyCFunction)PySetContextAccountingEnabled,  // method
+    METH_VARARGS | METH_KEYWORDS,                // flags
+
+    "set_context_accounting_enabled(enabled: bool) -> None\n"
+    "\n"
+    "(internal)\n"
+    "\n"
+    "Enable or disable charging of logic-thread time and resources to\n"
+    "the context they are used on behalf of. This can also be enabled at\n"
+    "launch by setting the BA_CONTEXT_ACCOUNTING env var to 1.",
+};
+
+// ------------------------ get_context_accounting_stats -----------------------
+
+static auto PyGetContextAccountingStats(PyObject* self, PyObject* args,
+                                        PyObject* keywds) -> PyObject* {
+  BA_PYTHON_TRY;
+
+  int reset{};
+  static const char* kwlist[] = {"reset", nullptr};
+  if (!PyArg_ParseTupleAndKeywords(args, keywds, "|p",
+                                   const_cast<char**>(kwlist), &reset)) {
+    return nullptr;
+  }
+  BA_PRECONDITION(g_base->InLogicThread());
+  auto* accounting = g_base->context_accounting;
+  auto entries = accounting->GetEntries();
+  if (reset) {
+    accounting->Reset();
+  }
+
+  // Biggest consumers first.
+  std::stable_sort(entries.begin(), entries.end(),
+                   [](const base::ContextAccounting::Entry& a,
+                      const base::ContextAccounting::Entry& b) {
+                     return a.time > b.time;
+                   });
+  PythonRef list(PyList_New(0), PythonRef::kSteal);
+  for (auto&& entry : entries) {
+    PythonRef dict(
+        Py_BuildValue(
+            "{sssOsdsLsdsLsLsL}", "context", entry.description.c_str(),
+            "alive", entry.context.Exists() ? Py_True : Py_False, "time_ms",
+            static_cast<double>(entry.time) / 1000.0, "python_calls",
+            static_cast<long long>(entry.python_calls),
+            "python_call_time_ms",
+            static_cast<double>(entry.python_call_time) / 1000.0, "timers",
+            static_cast<long long>(entry.timers), "nodes",
+            static_cast<long long>(entry.nodes), "stream_bytes",
+            static_cast<long long>(entry.stream_bytes)),
+        PythonRef::kSteal);
+    PyList_Append(list.Get(), dict.Get());
+  }
+  return list.HandOver();
+  BA_PYTHON_CATCH;
+}
+
+static PyMethodDef PyGetContextAccountingStatsDef = {
+    "get_context_accounting_stats",            // name
+    (PyCFunction)PyGetContextAccountingStats,  // method
+    METH_VARARGS | METH_KEYWORDS,              // flags
+
+    "get_context_accounting_stats(reset: bool = False)"
+    " -> list[dict[str, Any]]\n"
+    "\n"
+    "(internal)\n"
+    "\n"
+    "Return what has been charged to each context since accounting was\n"
+    "enabled (or last reset), sorted by logic-thread time. Time is\n"
+    "exclusive of nested contexts; Python call time is inclusive of\n"
+    "anything the calls did. Entries for recently died contexts are\n"
+    "included with 'alive' set to False. Pass reset=True to clear values\n"
+    "after fetching them.",
+};
+
+// ----------------------------- run_native_test -------------------------------
+
+static auto PyRunNativeTest(PyObject* self, PyObject* args,
+                            PyObject* keywds) -> PyObject* {
+  BA_PYTHON_TRY;
+  static const char* kwlist[] = {"name", nullptr};
+  const char* name;
+  if (!PyArg_ParseTupleAndKeywords(args, keywds, "s",
+                                   const_cast<char**>(kwlist), &name)) {
+    return nullptr;
+  }
+  NativeTests::Run(name);
+  Py_RETURN_NONE;
+  BA_PYTHON_CATCH;
+}
+
+static PyMethodDef PyRunNativeTestDef = {
+    "run_native_test",             // name
+    (PyCFunction)PyRunNativeTest,  // method
+    METH_VARARGS | METH_KEYWORDS,  // flags
+
+    "run_native_test(name: str) -> None\n"
+    "\n"
+    "(internal)\n"
+    "\n"
+    "Run one of the engine's built-in native tests, raising an\n"
+    "Exception if it fails.",
+};
+
+// ------------------------- get_native_test_names -----------------------------
+
+static auto PyGetNativeTestNames(PyObject* self) -> PyObject* {
+  BA_PYTHON_TRY;
+  auto names = NativeTests::GetNames();
+  PyObject* list = PyList_New(static_cast<Py_ssize_t>(names.size()));
+  for (size_t i = 0; i < names.size(); ++i) {
+    PyList_SET_ITEM(list, static_cast<Py_ssize_t>(i),
+                    PyUnicode_FromString(names[i].c_str()));
+  }
+  return list;
+  BA_PYTHON_CATCH;
+}
+
+static PyMethodDef PyGetNativeTestNamesDef = {
+    "get_native_test_names",            // name
+    (PyCFunction)PyGetNativeTestNames,  // method
+    METH_NOARGS,                        // flags
+
+    "get_native_test_names() -> list[str]\n"
+    "\n"
+    "(internal)\n"
+    "\n"
+    "Return the names of tests runnable via run_native_test().",
+};
+
 // -----------------------------------------------------------------------------
 
 auto PythonMoethodsBase3::GetMethods() -> std::vector<PyMethodDef> {
@@ -1895,6 +2314,19 @@ auto PythonMoethodsBase3::GetMethods() -> std::vector<PyMethodDef> {
       PyTempTestingDef,
       PyOpenFileExternallyDef,
       PyGetInputIdleTimeDef,
+      PySetInputLatencyTracingDef,
+      PyGetInputLatencyStatsDef,
+      PyResetInputLatencyStatsDef,
+      PySetUDPRecordingDef,
+      PyPrintRunnableAllocStatsDef,
+      PyGetLogicStepStatsDef,
+      PyGetRendererMediaStatsDef,
+      PyGetDynamicResolutionStatsDef,
+      PyGetBGDynamicsLoadStatsDef,
+      PySetContextAccountingEnabledDef,
+      PyGetContextAccountingStatsDef,
+      PyRunNativeTestDef,
+      PyGetNativeTestNamesDef,
   };
 }
 
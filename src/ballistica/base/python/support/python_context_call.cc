@@ -3,6 +3,7 @@
 #include "ballistica/base/python/support/python_context_call.h"
 
 #include "ballistica/base/logic/logic.h"
+#include "ballistica/base/support/context_accounting.h"
 #include "ballistica/base/ui/ui.h"
 #include "ballistica/core/python/core_python.h"
 #include "ballistica/shared/foundation/event_loop.h"
@@ -85,6 +86,9 @@ void PythonContextCall::Run(PyObject* args) {
   PythonContextCall* prev_call = current_call_;
   current_call_ = this;
   assert(Python::HaveGIL());
+  auto* accounting = g_base->context_accounting;
+  microsecs_t start_time =
+      accounting->enabled() ? g_core->GetAppTimeMicrosecs() : 0;
   PyObject* o =
       PyObject_Call(object_.Get(),
                     args ? args
@@ -93,6 +97,9 @@ void PythonContextCall::Run(PyObject* args) {
                                .Get(),
                     nullptr);
   current_call_ = prev_call;
+  if (accounting->enabled()) {
+    accounting->AddPythonCall(g_core->GetAppTimeMicrosecs() - start_time);
+  }
 
   if (o) {
     Py_DECREF(o);
@@ -184,6 +184,8 @@ void AppConfig::SetupEntries() {
   float gvrrts_default = g_core->platform->IsRunningOnDaydream() ? 1.0F : 0.5F;
   float_entries_[FloatID::kGoogleVRRenderTargetScale] =
       FloatEntry("GVR Render Target Scale", gvrrts_default);
+  float_entries_[FloatID::kDynamicResolutionMinScale] =
+      FloatEntry("Dynamic Resolution Min Scale", 0.5F);
 
   optional_float_entries_[OptionalFloatID::kIdleExitMinutes] =
       OptionalFloatEntry("Idle Exit Minutes", std::optional<float>());
@@ -209,6 +211,8 @@ void AppConfig::SetupEntries() {
   int_entries_[IntID::kMaxFPS] = IntEntry("Max FPS", 60);
   int_entries_[IntID::kSceneV1HostProtocol] =
       IntEntry("SceneV1 Host Protocol", 33);
+  int_entries_[IntID::kDynamicResolutionTargetFPS] =
+      IntEntry("Dynamic Resolution Target FPS", 60);
 
   bool_entries_[BoolID::kTouchControlsSwipeHidden] =
       BoolEntry("Touch Controls Swipe Hidden", false);
@@ -239,6 +243,8 @@ void AppConfig::SetupEntries() {
       BoolEntry("Show Demos When Idle", false);
   bool_entries_[BoolID::kShowDeprecatedLoginTypes] =
       BoolEntry("Show Deprecated Login Types", false);
+  bool_entries_[BoolID::kDynamicResolution] =
+      BoolEntry("Dynamic Resolution", false);
 
   // Now add everything to our name map and make sure all is kosher.
   CompleteMap(float_entries_);
@@ -32,6 +32,7 @@ class AppConfig {
     kSoundVolume,
     kMusicVolume,
     kGoogleVRRenderTargetScale,
+    kDynamicResolutionMinScale,
     kLast  // Sentinel.
   };
 
@@ -56,6 +57,7 @@ class AppConfig {
     kPort,
     kMaxFPS,
     kSceneV1HostProtocol,
+    kDynamicResolutionTargetFPS,
     kLast  // Sentinel.
   };
 
@@ -76,6 +78,7 @@ class AppConfig {
     kDisableCameraGyro,
     kShowDemosWhenIdle,
     kShowDeprecatedLoginTypes,
+    kDynamicResolution,
     kLast  // Sentinel.
   };
 
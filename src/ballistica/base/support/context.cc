@@ -2,6 +2,8 @@
 
 #include "ballistica/base/support/context.h"
 
+#include "ballistica/base/support/context_accounting.h"
+
 namespace ballistica::base {
 
 ContextRef::ContextRef()
@@ -44,16 +46,26 @@ auto Context::ContextAllowsDefaultTimerTypes() -> bool { return true; }
 ScopedSetContext::ScopedSetContext(const Object::Ref<Context>& target)
     : context_prev_(g_base->CurrentContext()) {
   g_base->context_ref->SetTarget(target.Get());
+  if (g_base->context_accounting->enabled()) {
+    g_base->context_accounting->Push(target.Get());
+  }
 }
 
 ScopedSetContext::ScopedSetContext(Context* target)
     : context_prev_(g_base->CurrentContext()) {
   g_base->context_ref->SetTarget(target);
+  if (g_base->context_accounting->enabled()) {
+    g_base->context_accounting->Push(target);
+  }
 }
 
 ScopedSetContext::ScopedSetContext(const ContextRef& context)
     : context_prev_(g_base->CurrentContext()) {
   *g_base->context_ref = context;
+  if (g_base->context_accounting->enabled()) {
+    g_base->context_accounting->Push(context.IsExpired() ? nullptr
+                                                         : context.Get());
+  }
 }
 
 ScopedSetContext::~ScopedSetContext() {
@@ -61,6 +73,9 @@ ScopedSetContext::~ScopedSetContext() {
   assert(g_base->InLogicThread());
   // Restore old.
   *g_base->context_ref = context_prev_;
+  if (g_base->context_accounting->enabled()) {
+    g_base->context_accounting->Pop();
+  }
 }
 
 }  // namespace ballistica::base
@@ -0,0 +1,224 @@
+// Released under the MIT License. See LICENSE for details.
+
+#include "ballistica/base/support/context_accounting.h"
+
+#include <string>
+#include <vector>
+
+#include "ballistica/base/support/context.h"
+#include "ballistica/core/core.h"
+#include "ballistica/core/platform/core_platform.h"
+
+namespace ballistica::base {
+
+// How many entries for contexts that have died we hang on to.
+const size_t kContextAccountingMaxDeadEntries{64};
+
+ContextAccounting::ContextAccounting()
+    : enabled_{g_core->platform->GetEnv("BA_CONTEXT_ACCOUNTING") == "1"} {}
+
+ContextAccounting::ScopedCharge::ScopedCharge(Context* context) {
+  auto* accounting = g_base->context_accounting;
+  if (accounting->enabled()) {
+    accounting->Push(context);
+    pushed_ = true;
+  }
+}
+
+ContextAccounting::ScopedCharge::~ScopedCharge() {
+  if (pushed_) {
+    g_base->context_accounting->Pop();
+  }
+}
+
+void ContextAccounting::SetEnabled(bool enabled) {
+  assert(g_base->InLogicThread());
+  if (enabled == enabled_) {
+    return;
+  }
+  enabled_ = enabled;
+
+  // Any scopes currently open were not pushed, so start from scratch
+  // (pops for them arriving with an empty stack are ignored).
+  stack_.clear();
+  switch_pushed_ = false;
+}
+
+void ContextAccounting::Reset() {
+  assert(g_base->InLogicThread());
+  entries_.clear();
+  dead_entries_.clear();
+
+  // Keep charging whatever is in progress, but to fresh entries.
+  for (auto&& entry : stack_) {
+    if (entry) {
+      Context* context = entry->context.Get();
+      entry = context ? GetEntry(context) : nullptr;
+    }
+  }
+  last_charge_time_ = g_core->GetAppTimeMicrosecs();
+}
+
+void ContextAccounting::Charge() {
+  auto now = g_core->GetAppTimeMicrosecs();
+  if (auto* entry = Top()) {
+    entry->time += now - last_charge_time_;
+  }
+  last_charge_time_ = now;
+}
+
+void ContextAccounting::Push(Context* context) {
+  assert(g_base->InLogicThread());
+  if (!enabled_) {
+    return;
+  }
+  Charge();
+  stack_.push_back(context ? GetEntry(context) : nullptr);
+}
+
+void ContextAccounting::Pop() {
+  assert(g_base->InLogicThread());
+  if (!enabled_ || stack_.empty()) {
+    return;
+  }
+  Charge();
+  stack_.pop_back();
+  if (stack_.empty()) {
+    switch_pushed_ = false;
+  }
+}
+
+void ContextAccounting::Switch(Context* context) {
+  assert(g_base->InLogicThread());
+  if (!enabled_) {
+    return;
+  }
+
+  // Switching with nothing in progress (a 'with' block in code run
+  // outside of any context, such as from the console) gets an entry of
+  // its own, which goes away again when switching back to no context.
+  if (stack_.empty()) {
+    if (context) {
+      Charge();
+      stack_.push_back(GetEntry(context));
+      switch_pushed_ = true;
+    }
+    return;
+  }
+  Charge();
+  if (context == nullptr && switch_pushed_ && stack_.size() == 1) {
+    stack_.pop_back();
+    switch_pushed_ = false;
+    return;
+  }
+  stack_.back() = context ? GetEntry(context) : nullptr;
+}
+
+void ContextAccounting::AddPythonCall(microsecs_t duration) {
+  if (!enabled_) {
+    return;
+  }
+  if (auto* entry = Top()) {
+    entry->python_calls++;
+    entry->python_call_time += duration;
+
+    // Activities' Python objects don't exist yet when they first become
+    // current; grab a more useful description once they're running code.
+    if (!entry->have_py_description) {
+      UpdateDescription(entry);
+      entry->have_py_description = true;
+    }
+  }
+}
+
+void ContextAccounting::AddTimer() {
+  if (!enabled_) {
+    return;
+  }
+  if (auto* entry = Top()) {
+    entry->timers++;
+  }
+}
+
+void ContextAccounting::AddNode() {
+  if (!enabled_) {
+    return;
+  }
+  if (auto* entry = Top()) {
+    entry->nodes++;
+  }
+}
+
+void ContextAccounting::AddStreamBytes(size_t bytes) {
+  if (!enabled_) {
+    return;
+  }
+  if (auto* entry = Top()) {
+    entry->stream_bytes += static_cast<int64_t>(bytes);
+  }
+}
+
+void ContextAccounting::UpdateDescription(Entry* entry) {
+  if (auto* context = entry->context.Get()) {
+    entry->description = context->GetContextDescription();
+  }
+}
+
+void ContextAccounting::PruneDeadEntries() {
+  for (auto i = entries_.begin(); i != entries_.end();) {
+    if (!i->second->context.Exists()) {
+      dead_entries_.push_back(i->second);
+      i = entries_.erase(i);
+    } else {
+      ++i;
+    }
+  }
+  while (dead_entries_.size() > kContextAccountingMaxDeadEntries) {
+    dead_entries_.pop_front();
+  }
+}
+
+auto ContextAccounting::GetEntry(Context* context) -> std::shared_ptr<Entry> {
+  assert(context);
+  auto i = entries_.find(context);
+  if (i != entries_.end()) {
+    if (i->second->context.Exists()) {
+      return i->second;
+    }
+    // This is a new context at a dead one's address.
+    dead_entries_.push_back(i->second);
+    entries_.erase(i);
+  }
+
+  // Sweep out dead contexts as new ones come along so we don't grow
+  // without bound over a long-running server's lifetime.
+  PruneDeadEntries();
+
+  auto entry = std::make_shared<Entry>();
+  entry->context = context;
+  entry->description = context->GetContextDescription();
+  entries_[context] = entry;
+  return entry;
+}
+
+auto ContextAccounting::GetEntries() -> std::vector<Entry> {
+  assert(g_base->InLogicThread());
+
+  // Get anything in progress up to date.
+  if (enabled_) {
+    Charge();
+  }
+  PruneDeadEntries();
+  std::vector<Entry> out;
+  out.reserve(entries_.size() + dead_entries_.size());
+  for (auto&& i : entries_) {
+    UpdateDescription(i.second.get());
+    out.push_back(*i.second);
+  }
+  for (auto i = dead_entries_.rbegin(); i != dead_entries_.rend(); ++i) {
+    out.push_back(**i);
+  }
+  return out;
+}
+
+}  // namespace ballistica::base
@@ -0,0 +1,105 @@
+// Released under the MIT License. See LICENSE for details.
+
+#ifndef BALLISTICA_BASE_SUPPORT_CONTEXT_ACCOUNTING_H_
+#define BALLISTICA_BASE_SUPPORT_CONTEXT_ACCOUNTING_H_
+
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ballistica/base/base.h"
+#include "ballistica/shared/foundation/object.h"
+
+namespace ballistica::base {
+
+/// Optional bookkeeping of which Context logic-thread work is done on
+/// behalf of.
+///
+/// When enabled, time spent with a context current (via ScopedSetContext
+/// and friends) is charged to that context, as are Python calls, timers,
+/// nodes and session-stream bytes created while it is active. Time is
+/// exclusive; while a nested context is active, its time is not also
+/// charged to the outer one. This is intended for spotting which
+/// activities/sessions (and thus which game modes or mods) are eating
+/// the logic thread's budget. It is off by default and can be toggled at
+/// runtime; when off, the hooks cost a single branch.
+///
+/// All methods must be called from the logic thread.
+class ContextAccounting {
+ public:
+  struct Entry {
+    Object::WeakRef<Context> context;
+    std::string description;
+    bool have_py_description{};
+    microsecs_t time{};
+    microsecs_t python_call_time{};
+    int64_t python_calls{};
+    int64_t timers{};
+    int64_t nodes{};
+    int64_t stream_bytes{};
+  };
+
+  /// Charges any time spent in its scope to a context without actually
+  /// making that context current.
+  class ScopedCharge {
+   public:
+    explicit ScopedCharge(Context* context);
+    ~ScopedCharge();
+
+   private:
+    BA_DISALLOW_CLASS_COPIES(ScopedCharge);
+    bool pushed_{};
+  };
+
+  ContextAccounting();
+
+  auto enabled() const { return enabled_; }
+  void SetEnabled(bool enabled);
+
+  /// Clear all accumulated values.
+  void Reset();
+
+  /// Called by ScopedSetContext; the context being set becomes the one
+  /// charged until the matching Pop().
+  void Push(Context* context);
+  void Pop();
+
+  /// Called when the current context is replaced without a scope (as by
+  /// Python ContextRef 'with' statements). If nothing is being charged
+  /// at that point, the new context is charged until switched away from.
+  void Switch(Context* context);
+
+  /// Charge things to whatever context is currently being charged.
+  void AddPythonCall(microsecs_t duration);
+  void AddTimer();
+  void AddNode();
+  void AddStreamBytes(size_t bytes);
+
+  /// Return all entries; live contexts first, followed by the most
+  /// recently died ones.
+  auto GetEntries() -> std::vector<Entry>;
+
+ private:
+  void Charge();
+  auto GetEntry(Context* context) -> std::shared_ptr<Entry>;
+  auto Top() const -> Entry* {
+    return stack_.empty() ? nullptr : stack_.back().get();
+  }
+  void UpdateDescription(Entry* entry);
+  void PruneDeadEntries();
+
+  bool enabled_{};
+
+  // Whether the bottom of our stack was pushed by Switch().
+  bool switch_pushed_{};
+  microsecs_t last_charge_time_{};
+  std::vector<std::shared_ptr<Entry>> stack_;
+  std::unordered_map<Context*, std::shared_ptr<Entry>> entries_;
+  std::list<std::shared_ptr<Entry>> dead_entries_;
+};
+
+}  // namespace ballistica::base
+
+#endif  // BALLISTICA_BASE_SUPPORT_CONTEXT_ACCOUNTING_H_
@@ -2,6 +2,12 @@
 
 #include "ballistica/base/support/huffman.h"
 
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <utility>
+
+#include "ballistica/base/base.h"
 #include "ballistica/base/networking/networking.h"
 
 namespace ballistica::base {
@@ -11,13 +17,7 @@ namespace ballistica::base {
 #pragma clang diagnostic push
 #pragma ide diagnostic ignored "hicpp-signed-bitwise"
 
-// how much data we read in training mode before spitting out results
-#if HUFFMAN_TRAINING_MODE
-const int kTrainingLength = 200000;
-#endif
-
-// we currently just have a static table of char frequencies - this can be
-// generated by setting "training mode" on.
+// Our generic table of char frequencies.
 static int g_freqs[] = {
     101342, 9667, 3497, 1072, 0, 3793, 0, 0, 2815, 5235, 0, 0, 0, 3570, 0, 0,
     0,      1383, 0,    0,    0, 2970, 0, 0, 2857, 0,    0, 0, 0, 0,    0, 0,
@@ -36,6 +36,16 @@ static int g_freqs[] = {
     0,      0,    0,    0,    0, 0,    0, 0, 0,    0,    0, 0, 0, 0,    0, 0,
     0,      0,    0,    0,    0, 0,    0, 0, 0,    0,    0, 0, 0, 0,    0, 0};
 
+// Per-channel tables built from a corpus of replays by
+// `tools/pcommand gen_huffman_tables`; don't edit these by hand. Channels
+// with no table here simply use the generic one.
+// __AUTOGENERATED_CHANNEL_TABLES_BEGIN__
+static auto GetBuiltinChannelFreqs()
+    -> std::vector<std::pair<HuffmanChannel, std::vector<int>>> {
+  return {};
+}
+// __AUTOGENERATED_CHANNEL_TABLES_END__
+
 static void DoWriteBits(char** ptr, int* bit, int val, int val_bits) {
   int src_bit = 0;
   while (src_bit < val_bits) {
@@ -46,14 +56,31 @@ static void DoWriteBits(char** ptr, int* bit, int val, int val_bits) {
   }
 }
 
-Huffman::Huffman() : built(false) {
-  static_assert(sizeof(g_freqs) == sizeof(int) * 256);
-  build();
+// Table ids live in bits 4-6 of the header byte of compressed data (bit 7
+// is the compressed flag and the low 3 bits are the trailing-bit count).
+const int kTableIDShift = 4;
+const uint8_t kTableIDMask = 0x07;
+
+HuffmanTable::HuffmanTable(const std::vector<int>& frequencies,
+                           uint8_t table_id)
+    : frequencies_(frequencies), table_id_(table_id) {
+  BA_PRECONDITION(frequencies_.size() == 256);
+  BA_PRECONDITION(table_id_ <= kTableIDMask);
+
+  // FNV-1a over the table; this is what peers compare when negotiating.
+  uint32_t hash = 2166136261u;
+  for (int freq : frequencies_) {
+    auto val = static_cast<uint32_t>(freq);
+    for (int i = 0; i < 4; ++i) {
+      hash ^= (val >> (i * 8)) & 0xFFu;
+      hash *= 16777619u;
+    }
+  }
+  version_ = hash;
+  Build();
 }
 
-Huffman::~Huffman() = default;
-
-auto Huffman::compress(const std::vector<uint8_t>& src)
+auto HuffmanTable::compress(const std::vector<uint8_t>& src) const
     -> std::vector<uint8_t> {
 #if BA_HUFFMAN_NET_COMPRESSION
 
@@ -110,24 +137,19 @@ auto Huffman::compress(const std::vector<uint8_t>& src)
                && bit_count != 0));
     assert(bit == bit_count % 8);
 
-    // mark it as compressed
+    // mark it as compressed and note which table we used
     out[0] |= (0x01 << 7);
+    out[0] |= static_cast<uint8_t>(table_id_ << kTableIDShift);
     return out;
   }
 #else
-
-#if HUFFMAN_TRAINING_MODE
-  train(data, length);
-#endif
-
-  data_out = data;
-  length_out = length;
+  return src;
 #endif
 }
 
 // hmmm - I saw a crash logged in this function; need to make sure this is
 // bulletproof since untrusted data is coming through here..
-auto Huffman::decompress(const std::vector<uint8_t>& src)
+auto HuffmanTable::decompress(const std::vector<uint8_t>& src) const
     -> std::vector<uint8_t> {
 #if BA_HUFFMAN_NET_COMPRESSION
 
@@ -222,8 +244,7 @@ auto Huffman::decompress(const std::vector<uint8_t>& src)
   }
 
 #else
-  data_out = data;
-  length_out = length;
+  return src;
 #endif
 }
 
@@ -436,53 +457,10 @@ void Huffman::decompress(const char* data, uint32_t length,
 }
 #endif  // 0
 
-#if HUFFMAN_TRAINING_MODE
-void Huffman::train(const char* buffer, int len) {
-  if (built) {
-    test_bytes += len;
-    for (int i = 0; i < len; i++) {
-      test_bits_compressed += nodes[static_cast<uint8_t>(buffer[i])].bits;
-    }
-    static int poo = 0;
-    poo++;
-    if (poo > 100) {
-      poo = 0;
-      test_bytes = 0;
-      test_bits_compressed = 0;
-    }
-    return;
-  }
-  total_length += len;
-  while (len > 0) {
-    nodes[static_cast<uint8_t>(*buffer)].frequency++;
-    total_count++;
-    buffer++;
-    len--;
-  }
-  if (total_length > kTrainingLength) {
-    Log(LogLevel::kInfo, "HUFFMAN TRAINING COMPLETE:");
-
-    build();
-
-    // spit the C array to stdout for insertion into our code
-    string s = "{";
-    for (int i = 0; i < 256; i++) {
-      s += std::to_string(nodes[i].frequency);
-      if (i < 255) s += ",";
-    }
-    s += "}";
-    Log(LogLevel::kInfo, "FINAL: " + s);
-  }
-}
-#endif  // HUFFMAN_TRAINING_MODE
-
-void Huffman::build() {
-  assert(!built);
-
-  // if we're not in training mode, use our hard-coded values
+void HuffmanTable::Build() {
 #if 1
   for (int i = 0; i < 256; i++) {
-    nodes_[i].frequency = g_freqs[i];
+    nodes_[i].frequency = frequencies_[i];
   }
 #else
   // go through and set all but the top 15 or so to zero
@@ -579,8 +557,160 @@ void Huffman::build() {
     // nodes[i].val = 0;
     nodes_[i].bits += 1;
   }
+}
+
+Huffman::Huffman() : channels_(static_cast<int>(HuffmanChannel::kLast)) {
+  static_assert(sizeof(g_freqs) == sizeof(int) * 256);
+  static_assert(static_cast<int>(HuffmanChannel::kLast) <= kTableIDMask + 1);
+  tables_.push_back(
+      std::make_unique<HuffmanTable>(std::vector<int>(g_freqs, g_freqs + 256)));
+  generic_table_ = tables_.back().get();
+  for (auto&& entry : GetBuiltinChannelFreqs()) {
+    BA_PRECONDITION(entry.first != HuffmanChannel::kGeneric
+                    && entry.first < HuffmanChannel::kLast);
+    tables_.push_back(std::make_unique<HuffmanTable>(
+        entry.second, static_cast<uint8_t>(entry.first)));
+    channels_[static_cast<int>(entry.first)].table = tables_.back().get();
+  }
+}
+
+Huffman::~Huffman() = default;
+
+auto Huffman::compress(const std::vector<uint8_t>& src)
+    -> std::vector<uint8_t> {
+  return generic_table_->compress(src);
+}
+
+auto Huffman::decompress(const std::vector<uint8_t>& src)
+    -> std::vector<uint8_t> {
+  return generic_table_->decompress(src);
+}
+
+auto Huffman::GetTableID(const std::vector<uint8_t>& data) -> uint8_t {
+  if (data.empty() || !(data[0] >> 7)) {
+    return 0;
+  }
+  return (data[0] >> kTableIDShift) & kTableIDMask;
+}
+
+auto Huffman::ChannelForPacket(const std::vector<uint8_t>& data)
+    -> HuffmanChannel {
+  // Message packets are 1 byte type, 2 byte num, 3 byte acks, and
+  // unreliable ones add a 2 byte unreliable-num before the acks.
+  size_t offset;
+  if (!data.empty() && data[0] == BA_SCENEPACKET_MESSAGE) {
+    offset = 6;
+  } else if (!data.empty() && data[0] == BA_SCENEPACKET_MESSAGE_UNRELIABLE) {
+    offset = 8;
+  } else {
+    return HuffmanChannel::kGeneric;
+  }
+  if (data.size() <= offset) {
+    return HuffmanChannel::kGeneric;
+  }
+  switch (data[offset]) {
+    case BA_MESSAGE_SESSION_COMMANDS:
+    // Anything big enough to be split into parts is almost always a
+    // batch of session commands.
+    case BA_MESSAGE_MULTIPART:
+    case BA_MESSAGE_MULTIPART_END:
+      return HuffmanChannel::kSessionCommands;
+    case BA_MESSAGE_SESSION_DYNAMICS_CORRECTION:
+      return HuffmanChannel::kDynamicsCorrection;
+    case BA_MESSAGE_REMOTE_PLAYER_INPUT_COMMANDS:
+      return HuffmanChannel::kInput;
+    default:
+      return HuffmanChannel::kGeneric;
+  }
+}
+
+auto Huffman::ChannelForMessage(const std::vector<uint8_t>& data)
+    -> HuffmanChannel {
+  if (data.empty()) {
+    return HuffmanChannel::kGeneric;
+  }
+  switch (data[0]) {
+    case BA_MESSAGE_SESSION_COMMANDS:
+      return HuffmanChannel::kSessionCommands;
+    case BA_MESSAGE_SESSION_DYNAMICS_CORRECTION:
+      return HuffmanChannel::kDynamicsCorrection;
+    case BA_MESSAGE_REMOTE_PLAYER_INPUT_COMMANDS:
+      return HuffmanChannel::kInput;
+    default:
+      return HuffmanChannel::kGeneric;
+  }
+}
+
+auto Huffman::ChannelName(HuffmanChannel channel) -> const char* {
+  switch (channel) {
+    case HuffmanChannel::kGeneric:
+      return "generic";
+    case HuffmanChannel::kSessionCommands:
+      return "session_commands";
+    case HuffmanChannel::kDynamicsCorrection:
+      return "dynamics_correction";
+    case HuffmanChannel::kInput:
+      return "input";
+    default:
+      throw Exception("Invalid huffman channel.");
+  }
+}
+
+auto Huffman::GetTableVersions(const std::vector<const HuffmanTable*>& tables)
+    -> std::string {
+  // Comma-separated hex versions for each non-generic channel; 0 for
+  // channels that simply use the generic table.
+  std::string out;
+  for (size_t i = 1; i < tables.size(); ++i) {
+    char buffer[16];
+    snprintf(buffer, sizeof(buffer), "%x",
+             tables[i] ? tables[i]->version() : 0);
+    if (!out.empty()) {
+      out += ",";
+    }
+    out += buffer;
+  }
+  return out;
+}
+
+auto Huffman::MatchTableVersions(const std::vector<const HuffmanTable*>& tables,
+                                 const std::string& versions) -> uint32_t {
+  // Older peers send nothing here and so match nothing.
+  uint32_t matches{};
+  const char* ptr = versions.c_str();
+  for (size_t i = 1; i < tables.size() && *ptr != 0; ++i) {
+    char* end;
+    auto version = static_cast<uint32_t>(strtoul(ptr, &end, 16));
+    if (end == ptr) {
+      break;
+    }
+    if (tables[i] && version == tables[i]->version()) {
+      matches |= (0x01u << i);
+    }
+    ptr = (*end == ',') ? end + 1 : end;
+  }
+  return matches;
+}
+
+auto Huffman::GetChannelTable(HuffmanChannel channel) const
+    -> const HuffmanTable* {
+  return channels_.at(static_cast<int>(channel)).table;
+}
+
+void Huffman::RecordChannelBytes(HuffmanChannel channel, size_t raw_bytes,
+                                 size_t compressed_bytes) {
+  auto& state{channels_.at(static_cast<int>(channel))};
+  state.raw_bytes += static_cast<int64_t>(raw_bytes);
+  state.compressed_bytes += static_cast<int64_t>(compressed_bytes);
+}
+
+auto Huffman::GetChannelRawBytes(HuffmanChannel channel) const -> int64_t {
+  return channels_.at(static_cast<int>(channel)).raw_bytes;
+}
 
-  built = true;
+auto Huffman::GetChannelCompressedBytes(HuffmanChannel channel) const
+    -> int64_t {
+  return channels_.at(static_cast<int>(channel)).compressed_bytes;
 }
 
 #pragma clang diagnostic pop
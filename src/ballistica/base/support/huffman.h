@@ -3,37 +3,50 @@
 #ifndef BALLISTICA_BASE_SUPPORT_HUFFMAN_H_
 #define BALLISTICA_BASE_SUPPORT_HUFFMAN_H_
 
+#include <memory>
+#include <string>
 #include <vector>
 
-#include "ballistica/shared/foundation/object.h"
+#include "ballistica/shared/ballistica.h"
 
 namespace ballistica::base {
 
-class Huffman {
- public:
-  Huffman();
-  ~Huffman();
-
-#if HUFFMAN_TRAINING_MODE
-  void train(const char* buffer, int len);
-#endif
+/// Classes of traffic which can each be compressed with their own table.
+/// Values are sent over the wire as table ids so must fit in 3 bits and
+/// must never be reordered.
+enum class HuffmanChannel : uint8_t {
+  kGeneric,
+  kSessionCommands,
+  kDynamicsCorrection,
+  kInput,
+  kLast  // Sentinel.
+};
 
-  void build();
+/// A single Huffman code built from a table of byte frequencies.
+/// Tables are immutable and are never freed once created, so connections
+/// can hold on to the ones they negotiated for their whole lifetime.
+class HuffmanTable {
+ public:
+  explicit HuffmanTable(const std::vector<int>& frequencies,
+                        uint8_t table_id = 0);
 
   // NOTE: this assumes the topmost bit of the first byte is unused
   // (see details in implementation).
-  auto compress(const std::vector<uint8_t>& src) -> std::vector<uint8_t>;
-  auto decompress(const std::vector<uint8_t>& src) -> std::vector<uint8_t>;
-  auto get_built() const -> bool { return built; }
+  auto compress(const std::vector<uint8_t>& src) const -> std::vector<uint8_t>;
+  auto decompress(const std::vector<uint8_t>& src) const
+      -> std::vector<uint8_t>;
+
+  auto frequencies() const -> const std::vector<int>& { return frequencies_; }
+
+  /// A hash of our frequency table; peers compare these to decide whether
+  /// they are able to use a table.
+  auto version() const -> uint32_t { return version_; }
+
+  /// The id we embed in the header of data we compress.
+  auto table_id() const -> uint8_t { return table_id_; }
 
  private:
-  bool built;
-#if HUFFMAN_TRAINING_MODE
-  uint32_t test_bytes = 0;
-  uint32_t test_bits_compressed = 0;
-  int total_count = 0;
-  int total_length = 0;
-#endif
+  void Build();
 
   class Node {
    public:
@@ -53,9 +66,76 @@ class Huffman {
     int frequency = 0;
   };
 
+  std::vector<int> frequencies_;
+  uint32_t version_{};
+  uint8_t table_id_{};
   Node nodes_[511];
 };
 
+/// Wrangles our built-in generic and per-channel tables along with
+/// per-channel stats. Channel tables are generated offline from replays
+/// (see tools/batools/huffman.py) and compiled in; peers only use one
+/// after confirming through their handshake that they have the same one.
+class Huffman {
+ public:
+  Huffman();
+  ~Huffman();
+
+  // Compress/decompress using the generic table.
+  // NOTE: this assumes the topmost bit of the first byte is unused
+  // (see details in implementation).
+  auto compress(const std::vector<uint8_t>& src) -> std::vector<uint8_t>;
+  auto decompress(const std::vector<uint8_t>& src) -> std::vector<uint8_t>;
+  auto get_built() const -> bool { return generic_table_ != nullptr; }
+
+  /// Return the table id embedded in compressed data (0 for the generic
+  /// table or for uncompressed data).
+  static auto GetTableID(const std::vector<uint8_t>& data) -> uint8_t;
+
+  /// Return the channel a raw scene-packet belongs to.
+  static auto ChannelForPacket(const std::vector<uint8_t>& data)
+      -> HuffmanChannel;
+
+  /// Return the channel a session message belongs to.
+  static auto ChannelForMessage(const std::vector<uint8_t>& data)
+      -> HuffmanChannel;
+
+  static auto ChannelName(HuffmanChannel channel) -> const char*;
+
+  /// Describe per-channel tables (indexed by channel; nullptr for
+  /// channels using the generic table) in the form we send in handshakes.
+  static auto GetTableVersions(const std::vector<const HuffmanTable*>& tables)
+      -> std::string;
+
+  /// Return a bitmask of the channels in a set of tables whose versions
+  /// match those in a string from a peer's GetTableVersions().
+  static auto MatchTableVersions(const std::vector<const HuffmanTable*>& tables,
+                                 const std::string& versions) -> uint32_t;
+
+  auto generic_table() const -> const HuffmanTable* { return generic_table_; }
+
+  /// Return the table for a channel, or nullptr if the channel has no
+  /// table of its own and simply uses the generic one.
+  auto GetChannelTable(HuffmanChannel channel) const -> const HuffmanTable*;
+
+  /// Record the raw and compressed size of data sent on a channel.
+  void RecordChannelBytes(HuffmanChannel channel, size_t raw_bytes,
+                          size_t compressed_bytes);
+  auto GetChannelRawBytes(HuffmanChannel channel) const -> int64_t;
+  auto GetChannelCompressedBytes(HuffmanChannel channel) const -> int64_t;
+
+ private:
+  struct ChannelState {
+    const HuffmanTable* table{};
+    int64_t raw_bytes{};
+    int64_t compressed_bytes{};
+  };
+  // Every table we've created; we never free these.
+  std::vector<std::unique_ptr<HuffmanTable>> tables_;
+  const HuffmanTable* generic_table_{};
+  std::vector<ChannelState> channels_;
+};
+
 }  // namespace ballistica::base
 
 #endif  // BALLISTICA_BASE_SUPPORT_HUFFMAN_H_
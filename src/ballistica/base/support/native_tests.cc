@@ -0,0 +1,845 @@
+// Released under the MIT License. See LICENSE for details.
+
+#include "ballistica/base/support/native_tests.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ballistica/base/base.h"
+#include "ballistica/base/graphics/support/dynamic_resolution.h"
+#include "ballistica/base/input/support/pending_event_slots.h"
+#include "ballistica/base/networking/udp_recording.h"
+#include "ballistica/base/support/huffman.h"
+#include "ballistica/core/core.h"
+#include "ballistica/core/platform/core_platform.h"
+#include "ballistica/shared/foundation/exception.h"
+#include "ballistica/shared/generic/lambda_runnable.h"
+#include "ballistica/shared/generic/timer_list.h"
+#include "ballistica/shared/generic/worker_pool.h"
+#include "ode/ode.h"
+
+namespace ballistica::base {
+
+static void ExpectSequence(const std::vector<std::string>& got,
+                           const std::vector<std::string>& expected,
+                           const std::string& what) {
+  if (got == expected) {
+    return;
+  }
+  auto join = [](const std::vector<std::string>& vals) {
+    std::string out;
+    for (auto&& val : vals) {
+      out += (out.empty() ? "" : " ") + val;
+    }
+    return "[" + out + "]";
+  };
+  throw Exception(what + ": expected " + join(expected) + "; got "
+                  + join(got));
+}
+
+// Timers in groups should interleave with their parent's in expire order
+// no matter how far the parent is stepped at once, and groups should come
+// apart cleanly.
+static void TestTimerListGroups() {
+  std::vector<std::string> fired;
+  auto record = [&fired](const char* name) {
+    return NewLambdaRunnable([&fired, name] { fired.emplace_back(name); });
+  };
+
+  TimerList parent;
+  TimerList group;
+
+  // Give the group a clock running well ahead of its parent's to make
+  // sure we're converting between the two.
+  group.AttachToParent(&parent, 0, 1000);
+  BA_PRECONDITION(group.LocalTime(50) == 1050);
+
+  parent.NewTimer(0, 10, 0, 0, record("p10").Get());
+  group.NewTimer(1000, 20, 0, 0, record("g20a").Get());
+  group.NewTimer(1000, 20, 0, 0, record("g20b").Get());
+  parent.NewTimer(0, 30, 0, 0, record("p30").Get());
+  group.NewTimer(1000, 25, 0, 0, record("g25").Get());
+  auto* doomed = group.NewTimer(1000, 15, 0, 0, record("doomed").Get());
+  group.DeleteTimer(doomed->id());
+
+  parent.Run(100);
+  ExpectSequence(fired, {"p10", "g20a", "g20b", "g25", "p30"},
+                 "single large step");
+  BA_PRECONDITION(parent.fire_count() == 2);
+  BA_PRECONDITION(group.fire_count() == 3);
+
+  // Repeating timers in small steps; 2 repeats means 3 fires.
+  fired.clear();
+  group.NewTimer(group.LocalTime(100), 25, 0, 2, record("rep").Get());
+  parent.NewTimer(100, 60, 0, 0, record("p160").Get());
+  for (TimerMedium t = 101; t <= 300; ++t) {
+    parent.Run(t);
+  }
+  ExpectSequence(fired, {"rep", "rep", "p160", "rep"}, "repeating");
+
+  // Once detached, the parent no longer knows about the group, and the
+  // group's clock stands still.
+  fired.clear();
+  group.NewTimer(group.LocalTime(300), 10, 0, 0, record("orphan").Get());
+  group.DetachFromParent();
+  BA_PRECONDITION(group.LocalTime(500) == group.LocalTime(0));
+  BA_PRECONDITION(parent.ActiveTimerCount() == 0
+                  && parent.InactiveTimerCount() == 0);
+  parent.Run(1000);
+  ExpectSequence(fired, {}, "detached");
+
+  // A group killed by one of its own timers mid-run must leave the
+  // parent's run intact.
+  fired.clear();
+  auto short_lived = std::make_unique<TimerList>();
+  short_lived->AttachToParent(&parent, 1000, 0);
+  short_lived->NewTimer(
+      0, 5, 0, 0,
+      NewLambdaRunnable([&short_lived, &fired] {
+        fired.emplace_back("kill");
+        short_lived.reset();
+      }).Get());
+  parent.NewTimer(1000, 10, 0, 0, record("after").Get());
+  parent.Run(1020);
+  ExpectSequence(fired, {"kill", "after"}, "self-destructing group");
+  BA_PRECONDITION(!short_lived);
+
+  // Clearing a parent detaches its groups.
+  group.AttachToParent(&parent, 1020, 0);
+  group.NewTimer(0, 10, 0, 0, record("cleared").Get());
+  parent.Clear();
+  fired.clear();
+  parent.Run(2000);
+  ExpectSequence(fired, {}, "cleared parent");
+  BA_PRECONDITION(group.LocalTime(2000) == 0);
+}
+
+struct SolverScenario {
+  dWorldID world;
+  dJointGroupID joints;
+};
+
+static void SolverScenarioCollide(void* data, dGeomID o1, dGeomID o2) {
+  auto* scenario = static_cast<SolverScenario*>(data);
+  dBodyID b1 = dGeomGetBody(o1);
+  dBodyID b2 = dGeomGetBody(o2);
+  dContact contacts[4];
+  int count = dCollide(o1, o2, 4, &contacts[0].geom, sizeof(dContact));
+  for (int i = 0; i < count; ++i) {
+    contacts[i].surface.mode = dContactBounce;
+    contacts[i].surface.mu = 0.6f;
+    contacts[i].surface.bounce = 0.2f;
+    contacts[i].surface.bounce_vel = 0.5f;
+    dJointID joint =
+        dJointCreateContact(scenario->world, scenario->joints, &contacts[i]);
+    dJointAttach(joint, b1, b2);
+  }
+}
+
+// Drop a small pile of boxes and a rolling ball on a plane and return
+// where everything ends up.
+static auto RunSolverScenario(bool warm_start, dQuickStepStats* totals)
+    -> std::vector<float> {
+  dRandSetSeed(5432);
+  dWorldID world = dWorldCreate();
+  dWorldSetGravity(world, 0, -20, 0);
+  dWorldSetContactSurfaceLayer(world, 0.001f);
+  dWorldSetQuickStepNumIterations(world, 10);
+  if (warm_start) {
+    dWorldSetQuickStepWarmStarting(world, true);
+    dWorldSetQuickStepTolerance(world, 0.01f, 3);
+  }
+  dSpaceID space = dHashSpaceCreate(nullptr);
+  SolverScenario scenario{world, dJointGroupCreate(0)};
+  dCreatePlane(space, 0, 1, 0, 0);
+
+  std::vector<dBodyID> bodies;
+  for (int i = 0; i < 6; ++i) {
+    dBodyID body = dBodyCreate(world);
+    dMass mass;
+    dMassSetBox(&mass, 1.0f, 0.5f, 0.5f, 0.5f);
+    dBodySetMass(body, &mass);
+    dBodySetPosition(body, 0.07f * static_cast<float>(i % 3),
+                     0.3f + 0.55f * static_cast<float>(i), 0.0f);
+    dGeomSetBody(dCreateBox(space, 0.5f, 0.5f, 0.5f), body);
+    bodies.push_back(body);
+  }
+  dBodyID ball = dBodyCreate(world);
+  dMass mass;
+  dMassSetSphere(&mass, 1.0f, 0.3f);
+  dBodySetMass(ball, &mass);
+  dBodySetPosition(ball, 3.0f, 1.0f, 0.2f);
+  dBodySetLinearVel(ball, -2.0f, 0.0f, 0.0f);
+  dGeomSetBody(dCreateSphere(space, 0.3f), ball);
+  bodies.push_back(ball);
+
+  *totals = dQuickStepStats{};
+  for (int step = 0; step < 250; ++step) {
+    dSpaceCollide(space, &scenario, SolverScenarioCollide);
+    dWorldQuickStep(world, 0.008f);
+    dJointGroupEmpty(scenario.joints);
+    dQuickStepStats stats;
+    dWorldGetQuickStepStats(world, &stats);
+    totals->islands += stats.islands;
+    totals->rows += stats.rows;
+    totals->warm_started_rows += stats.warm_started_rows;
+    totals->iterations_total += stats.iterations_total;
+  }
+
+  std::vector<float> positions;
+  for (auto&& body : bodies) {
+    const dReal* pos = dBodyGetPosition(body);
+    positions.insert(positions.end(), pos, pos + 3);
+  }
+  dJointGroupDestroy(scenario.joints);
+  dSpaceDestroy(space);
+  dWorldDestroy(world);
+  return positions;
+}
+
+// With warm starting and early-out left off (the default), the quick-step
+// solver should give exactly what it did before those were added.
+static void TestODEDefaultSolver() {
+  // Final positions from the same scenario run on the solver as it was
+  // before warm starting.
+  const std::vector<float> expected{
+      -0.05720f, 0.24666f, 0.00448f,   //
+      0.00343f,  0.74477f, 0.01027f,   //
+      0.06570f,  1.24294f, 0.00277f,   //
+      -0.08751f, 1.74129f, -0.00061f,  //
+      0.00020f,  2.23990f, 0.00056f,   //
+      0.07393f,  2.73791f, 0.01057f,   //
+      0.50620f,  0.29973f, 0.21071f};
+
+  dQuickStepStats totals;
+  auto positions = RunSolverScenario(false, &totals);
+  BA_PRECONDITION(positions.size() == expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    if (std::abs(positions[i] - expected[i]) > 0.0001f) {
+      throw Exception("Body " + std::to_string(i / 3) + " axis "
+                      + std::to_string(i % 3) + " ended at "
+                      + std::to_string(positions[i]) + "; expected "
+                      + std::to_string(expected[i]) + ".");
+    }
+  }
+  BA_PRECONDITION(totals.islands > 0);
+  BA_PRECONDITION(totals.warm_started_rows == 0);
+  BA_PRECONDITION(totals.iterations_total == totals.islands * 10);
+
+  // Opting in should actually carry impulses over and cut iterations.
+  auto warm_positions = RunSolverScenario(true, &totals);
+  BA_PRECONDITION(warm_positions.size() == expected.size());
+  BA_PRECONDITION(totals.warm_started_rows > 0);
+  BA_PRECONDITION(totals.iterations_total < totals.islands * 10);
+}
+
+// A bumpy 12x12 terrain mesh.
+static void MakeTerrainMesh(std::vector<float>* verts,
+                            std::vector<uint32_t>* indices) {
+  const int kGrid{24};
+  for (int z = 0; z <= kGrid; ++z) {
+    for (int x = 0; x <= kGrid; ++x) {
+      auto fx = static_cast<float>(x) * 0.5f - 6.0f;
+      auto fz = static_cast<float>(z) * 0.5f - 6.0f;
+      verts->insert(verts->end(),
+                    {fx, 0.4f * std::sin(fx) * std::cos(fz * 0.7f), fz});
+    }
+  }
+  for (int z = 0; z < kGrid; ++z) {
+    for (int x = 0; x < kGrid; ++x) {
+      auto i = static_cast<uint32_t>(z * (kGrid + 1) + x);
+      auto row = static_cast<uint32_t>(kGrid + 1);
+      indices->insert(indices->end(), {i, i + row, i + 1, i + 1, i + row,
+                                       i + row + 1});
+    }
+  }
+}
+
+// Running narrow-phase collision tests across threads (as scene dynamics
+// does) should give exactly the contacts running them one at a time does.
+static void TestNarrowPhaseParallel() {
+  const int kMaxContacts{20};
+  dSpaceID space = dHashSpaceCreate(nullptr);
+
+  std::vector<float> verts;
+  std::vector<uint32_t> indices;
+  MakeTerrainMesh(&verts, &indices);
+  dTriMeshDataID mesh_data = dGeomTriMeshDataCreate();
+  dGeomTriMeshDataBuildSingle(
+      mesh_data, verts.data(), 3 * sizeof(float),
+      static_cast<int>(verts.size() / 3), indices.data(),
+      static_cast<int>(indices.size()), 3 * sizeof(uint32_t));
+  dCreateTriMesh(space, mesh_data, nullptr, nullptr, nullptr);
+
+  // A crowd of the primitive shapes scene bodies use, resting in and on
+  // the terrain and each other.
+  uint32_t seed{12345};
+  auto rand = [&seed](float lo, float hi) {
+    seed = seed * 1664525u + 1013904223u;
+    return lo + (hi - lo) * static_cast<float>(seed >> 8) / 16777216.0f;
+  };
+  for (int i = 0; i < 240; ++i) {
+    dGeomID geom;
+    switch (i % 3) {
+      case 0:
+        geom = dCreateSphere(space, rand(0.2f, 0.5f));
+        break;
+      case 1:
+        geom = dCreateBox(space, rand(0.3f, 0.8f), rand(0.3f, 0.8f),
+                          rand(0.3f, 0.8f));
+        break;
+      default:
+        geom = dCreateCCylinder(space, rand(0.15f, 0.3f), rand(0.3f, 0.8f));
+        break;
+    }
+    dGeomSetPosition(geom, rand(-5.5f, 5.5f), rand(-0.3f, 0.8f),
+                     rand(-5.5f, 5.5f));
+    dMatrix3 rotation;
+    dRFromAxisAndAngle(rotation, rand(-1.0f, 1.0f), 1.0f, rand(-1.0f, 1.0f),
+                       rand(0.0f, 3.0f));
+    dGeomSetRotation(geom, rotation);
+  }
+
+  std::vector<std::pair<dGeomID, dGeomID>> pairs;
+  dSpaceCollide(space, &pairs, [](void* data, dGeomID o1, dGeomID o2) {
+    static_cast<std::vector<std::pair<dGeomID, dGeomID>>*>(data)->emplace_back(
+        o1, o2);
+  });
+
+  auto run = [&pairs, kMaxContacts](WorkerPool* pool) {
+    std::vector<std::vector<dContactGeom>> results(pairs.size());
+    auto call = [&pairs, &results, kMaxContacts](int i) {
+      auto& contacts{results[i]};
+      contacts.resize(kMaxContacts);
+      int count = dCollide(pairs[i].first, pairs[i].second, kMaxContacts,
+                           contacts.data(), sizeof(dContactGeom));
+      contacts.resize(static_cast<size_t>(count));
+    };
+    if (pool) {
+      pool->ParallelFor(static_cast<int>(pairs.size()), call);
+    } else {
+      for (int i = 0; i < static_cast<int>(pairs.size()); ++i) {
+        call(i);
+      }
+    }
+    return results;
+  };
+
+  auto serial = run(nullptr);
+  int contact_count{};
+  int mesh_contact_count{};
+  for (size_t i = 0; i < pairs.size(); ++i) {
+    contact_count += static_cast<int>(serial[i].size());
+    if (dGeomGetClass(pairs[i].first) == dTriMeshClass
+        || dGeomGetClass(pairs[i].second) == dTriMeshClass) {
+      mesh_contact_count += static_cast<int>(serial[i].size());
+    }
+  }
+  BA_PRECONDITION(mesh_contact_count > 0);
+  BA_PRECONDITION(contact_count > mesh_contact_count);
+
+  WorkerPool pool("narrowphasetest", 3);
+  for (int attempt = 0; attempt < 10; ++attempt) {
+    auto parallel = run(&pool);
+    for (size_t i = 0; i < pairs.size(); ++i) {
+      BA_PRECONDITION(parallel[i].size() == serial[i].size());
+      for (size_t j = 0; j < serial[i].size(); ++j) {
+        const dContactGeom& a{serial[i][j]};
+        const dContactGeom& b{parallel[i][j]};
+        if (memcmp(a.pos, b.pos, 3 * sizeof(dReal)) != 0
+            || memcmp(a.normal, b.normal, 3 * sizeof(dReal)) != 0
+            || a.depth != b.depth || a.g1 != b.g1 || a.g2 != b.g2) {
+          throw Exception("Contact " + std::to_string(j) + " of pair "
+                          + std::to_string(i) + " differs when run in "
+                          + "parallel.");
+        }
+      }
+    }
+  }
+
+  dSpaceDestroy(space);
+  dGeomTriMeshDataDestroy(mesh_data);
+}
+
+// Collision trees loaded from serialized data or shared with another
+// mesh-data should collide exactly like freshly built ones, and tree data
+// that doesn't fit should be ignored rather than trusted.
+static void TestCollisionTreeCache() {
+  const int kMaxContacts{20};
+  std::vector<float> verts;
+  std::vector<uint32_t> indices;
+  MakeTerrainMesh(&verts, &indices);
+  auto vert_count = static_cast<int>(verts.size() / 3);
+  auto index_count = static_cast<int>(indices.size());
+  auto build = [&](dTriMeshDataID data, bool quantized,
+                   const std::vector<uint8_t>& tree) {
+    return dGeomTriMeshDataBuildSingle2(
+        data, verts.data(), 3 * sizeof(float), vert_count, indices.data(),
+        index_count, 3 * sizeof(uint32_t), nullptr, quantized,
+        tree.empty() ? nullptr : tree.data(), static_cast<int>(tree.size()));
+  };
+  auto get_tree = [](dTriMeshDataID data) {
+    std::vector<uint8_t> tree(
+        static_cast<size_t>(dGeomTriMeshDataGetTreeData(data, nullptr)));
+    BA_PRECONDITION(!tree.empty());
+    dGeomTriMeshDataGetTreeData(data, tree.data());
+    return tree;
+  };
+
+  // Shapes scattered over and into the terrain.
+  std::vector<dGeomID> shapes;
+  uint32_t seed{54321};
+  auto rand = [&seed](float lo, float hi) {
+    seed = seed * 1664525u + 1013904223u;
+    return lo + (hi - lo) * static_cast<float>(seed >> 8) / 16777216.0f;
+  };
+  for (int i = 0; i < 120; ++i) {
+    dGeomID geom = (i % 2) ? dCreateSphere(nullptr, rand(0.2f, 0.5f))
+                           : dCreateBox(nullptr, rand(0.3f, 0.8f),
+                                        rand(0.3f, 0.8f), rand(0.3f, 0.8f));
+    dGeomSetPosition(geom, rand(-5.5f, 5.5f), rand(-0.3f, 0.8f),
+                     rand(-5.5f, 5.5f));
+    shapes.push_back(geom);
+  }
+  auto collide = [&shapes, kMaxContacts](dTriMeshDataID data) {
+    dGeomID mesh = dCreateTriMesh(nullptr, data, nullptr, nullptr, nullptr);
+    std::vector<dContactGeom> out;
+    for (auto&& shape : shapes) {
+      dContactGeom contacts[kMaxContacts];
+      int count =
+          dCollide(mesh, shape, kMaxContacts, contacts, sizeof(dContactGeom));
+      out.insert(out.end(), contacts, contacts + count);
+    }
+    dGeomDestroy(mesh);
+    return out;
+  };
+  auto expect_same = [](const std::vector<dContactGeom>& a,
+                        const std::vector<dContactGeom>& b, const char* what) {
+    bool same{a.size() == b.size()};
+    for (size_t i = 0; same && i < a.size(); ++i) {
+      same = memcmp(a[i].pos, b[i].pos, 3 * sizeof(dReal)) == 0
+             && memcmp(a[i].normal, b[i].normal, 3 * sizeof(dReal)) == 0
+             && a[i].depth == b[i].depth;
+    }
+    if (!same) {
+      throw Exception(std::string("Collisions differ with ") + what + ".");
+    }
+  };
+
+  for (bool quantized : {false, true}) {
+    dTriMeshDataID built = dGeomTriMeshDataCreate();
+    BA_PRECONDITION(build(built, quantized, {}) == 0);
+    auto tree = get_tree(built);
+    auto expected = collide(built);
+    BA_PRECONDITION(!expected.empty());
+
+    // Loading our own data should skip the build and give the same tree.
+    dTriMeshDataID loaded = dGeomTriMeshDataCreate();
+    BA_PRECONDITION(build(loaded, quantized, tree) == 1);
+    BA_PRECONDITION(get_tree(loaded) == tree);
+    expect_same(expected, collide(loaded), "a loaded tree");
+
+    dTriMeshDataID shared = dGeomTriMeshDataCreate();
+    dGeomTriMeshDataBuildShared(shared, built);
+    expect_same(expected, collide(shared), "a shared tree");
+
+    // Truncated data or data for the other layout gets rebuilt.
+    std::vector<uint8_t> truncated(tree.begin(), tree.end() - 1);
+    dTriMeshDataID rebuilt = dGeomTriMeshDataCreate();
+    BA_PRECONDITION(build(rebuilt, quantized, truncated) == 0);
+    expect_same(expected, collide(rebuilt), "a rebuilt tree");
+    dTriMeshDataID other = dGeomTriMeshDataCreate();
+    BA_PRECONDITION(build(other, !quantized, tree) == 0);
+
+    dGeomTriMeshDataDestroy(other);
+    dGeomTriMeshDataDestroy(rebuilt);
+    dGeomTriMeshDataDestroy(shared);
+    dGeomTriMeshDataDestroy(loaded);
+    dGeomTriMeshDataDestroy(built);
+  }
+  for (auto&& shape : shapes) {
+    dGeomDestroy(shape);
+  }
+}
+
+// Dynamic resolution should only react to render cost (not to frames
+// being held back by vsync or max-fps), drop fast, climb slowly, and back
+// off when climbing turns out to be a mistake.
+static void TestDynamicResolution() {
+  const microsecs_t kFrameInterval{16667};
+  const microsecs_t kCheap{5000};
+  const microsecs_t kExpensive{25000};
+  DynamicResolution dynres;
+  microsecs_t now{1000000};
+
+  // Feed frames for a while; returns how many of them changed the scale.
+  auto run = [&dynres, &now](microsecs_t duration, microsecs_t interval,
+                             microsecs_t render_time) {
+    int changes{};
+    for (microsecs_t end = now + duration; now < end;) {
+      now += interval;
+      changes += dynres.OnFrame(now, render_time);
+    }
+    return changes;
+  };
+  auto scale_is = [&dynres](float scale) {
+    return std::abs(dynres.scale() - scale) < 0.001f;
+  };
+
+  dynres.Configure(false, 0.5f, 1.0f, 60);
+  BA_PRECONDITION(run(2000000, kFrameInterval, kExpensive) == 0);
+  BA_PRECONDITION(scale_is(1.0f));
+
+  // Cheap frames that only come in at 30fps (a max-fps below target)
+  // should leave us alone.
+  dynres.Configure(true, 0.5f, 1.0f, 60);
+  BA_PRECONDITION(run(5000000, 33333, kCheap) == 0);
+  BA_PRECONDITION(scale_is(1.0f));
+
+  // Expensive frames should walk us down to the minimum in 0.1 steps no
+  // more than twice a second.
+  BA_PRECONDITION(run(1000000, kFrameInterval, kExpensive) == 2);
+  BA_PRECONDITION(scale_is(0.8f));
+  BA_PRECONDITION(run(5000000, kFrameInterval, kExpensive) == 3);
+  BA_PRECONDITION(scale_is(0.5f));
+
+  // Once things are cheap again we wait a few seconds before stepping up.
+  BA_PRECONDITION(run(2500000, kFrameInterval, kCheap) == 0);
+  BA_PRECONDITION(run(1000000, kFrameInterval, kCheap) == 1);
+  BA_PRECONDITION(scale_is(0.55f));
+
+  // Having to drop right after stepping up doubles that wait.
+  BA_PRECONDITION(run(600000, kFrameInterval, kExpensive) == 1);
+  BA_PRECONDITION(scale_is(0.5f));
+  BA_PRECONDITION(run(5000000, kFrameInterval, kCheap) == 0);
+  BA_PRECONDITION(run(2000000, kFrameInterval, kCheap) == 1);
+  BA_PRECONDITION(scale_is(0.55f));
+
+  // Long gaps (app suspended, hitches, etc.) don't count.
+  now += 1000000;
+  BA_PRECONDITION(!dynres.OnFrame(now, kExpensive));
+  BA_PRECONDITION(scale_is(0.55f));
+}
+
+// High-rate input events should collapse into the latest value while
+// their call is still queued, without ever being moved past discrete
+// events queued after them.
+static void TestPendingEventSlots() {
+  PendingEventSlots<int, int> motion;
+  std::vector<std::function<void()>> queue;
+  std::vector<std::string> handled;
+  auto push_motion = [&](int value) {
+    if (motion.Update(0, value)) {
+      return;
+    }
+    auto pending = motion.Open(0, value);
+    queue.emplace_back([&, pending] {
+      handled.push_back("m" + std::to_string(motion.Take(0, pending)));
+    });
+  };
+  auto push_click = [&](const std::string& name) {
+    motion.CloseAll();
+    queue.emplace_back([&handled, name] { handled.push_back(name); });
+  };
+  auto run_queue = [&queue] {
+    for (auto&& call : queue) {
+      call();
+    }
+    queue.clear();
+  };
+
+  push_motion(1);
+  push_motion(2);
+  push_motion(3);
+  push_click("click");
+  push_motion(4);
+  push_motion(5);
+  BA_PRECONDITION(queue.size() == 3);
+  BA_PRECONDITION(motion.coalesced_count() == 3);
+  run_queue();
+  ExpectSequence(handled, {"m3", "click", "m5"}, "coalesced motion");
+  BA_PRECONDITION(motion.open_count() == 0);
+
+  // Once handled, the next value gets a call of its own.
+  handled.clear();
+  push_motion(6);
+  run_queue();
+  ExpectSequence(handled, {"m6"}, "motion after handling");
+
+  // A stale slot finishing must not close the one that replaced it.
+  auto stale = motion.Open(0, 7);
+  motion.CloseAll();
+  auto current = motion.Open(0, 8);
+  BA_PRECONDITION(motion.Take(0, stale) == 7);
+  BA_PRECONDITION(motion.Update(0, 9));
+  BA_PRECONDITION(motion.Take(0, current) == 9);
+  BA_PRECONDITION(!motion.Update(0, 10));
+
+  // Keys are independent and can be closed selectively.
+  PendingEventSlots<std::pair<int, int>, int> axes;
+  auto axis_a = axes.Open({1, 0}, 0);
+  auto axis_b = axes.Open({1, 1}, 0);
+  auto axis_c = axes.Open({2, 0}, 0);
+  BA_PRECONDITION(axes.Update({1, 1}, 5));
+  axes.CloseIf([](const auto& key) { return key.first == 1; });
+  BA_PRECONDITION(axes.open_count() == 1);
+  BA_PRECONDITION(!axes.Update({1, 0}, 6));
+  BA_PRECONDITION(axes.Update({2, 0}, 7));
+  BA_PRECONDITION(axes.Take({1, 0}, axis_a) == 0);
+  BA_PRECONDITION(axes.Take({1, 1}, axis_b) == 5);
+  BA_PRECONDITION(axes.Take({2, 0}, axis_c) == 7);
+  BA_PRECONDITION(axes.open_count() == 0);
+  BA_PRECONDITION(axes.coalesced_count() == 2);
+}
+
+// Data compressed with any of our tables should come back out intact,
+// and the wire format should stay put since peers and replays depend on
+// it (tools/batools/huffman.py checks the same golden data).
+static void TestHuffmanRoundTrip() {
+  Huffman huffman;
+
+  const std::vector<uint8_t> golden_in{1, 0, 0, 0, 5, 9, 0, 33, 0,
+                                       2, 0, 0, 64, 0, 191, 0, 0, 0};
+  const std::vector<uint8_t> golden_out{129, 241, 183, 249, 196,
+                                        253, 167, 23,  126};
+  BA_PRECONDITION(huffman.compress(golden_in) == golden_out);
+  BA_PRECONDITION(huffman.decompress(golden_out) == golden_in);
+
+  // A lopsided table like the ones we build for individual channels.
+  std::vector<int> frequencies(256, 1);
+  frequencies[0] = 5000;
+  frequencies[1] = 3000;
+  frequencies[7] = 2000;
+  frequencies[64] = 800;
+  HuffmanTable channel_table(frequencies, 3);
+
+  std::vector<const HuffmanTable*> tables{huffman.generic_table(),
+                                          &channel_table};
+  for (int i = 0; i < static_cast<int>(HuffmanChannel::kLast); ++i) {
+    if (auto* table = huffman.GetChannelTable(static_cast<HuffmanChannel>(i))) {
+      BA_PRECONDITION(table->table_id() == i);
+      tables.push_back(table);
+    }
+  }
+
+  // Mostly-common bytes with some arbitrary ones mixed in.
+  uint32_t seed{12345};
+  auto rand_byte = [&seed] {
+    seed = seed * 1103515245u + 12345u;
+    return static_cast<uint8_t>(seed >> 16);
+  };
+  const uint8_t common[] = {0, 0, 0, 1, 1, 7, 64};
+  for (auto* table : tables) {
+    int compressed_count{};
+    for (int length = 1; length < 600; length += 7) {
+      std::vector<uint8_t> data(length);
+      for (auto&& val : data) {
+        uint8_t roll = rand_byte();
+        val = roll < 200 ? common[roll % sizeof(common)] : rand_byte();
+      }
+      data[0] &= 0x7F;
+      auto compressed = table->compress(data);
+      if (compressed != data) {
+        compressed_count++;
+        BA_PRECONDITION(compressed.size() < data.size());
+        BA_PRECONDITION(Huffman::GetTableID(compressed) == table->table_id());
+      }
+      if (table->decompress(compressed) != data) {
+        throw Exception("Huffman table " + std::to_string(table->table_id())
+                        + " failed to round-trip " + std::to_string(length)
+                        + " bytes.");
+      }
+    }
+    BA_PRECONDITION(compressed_count > 0);
+  }
+
+  // Data that doesn't shrink goes out untouched.
+  std::vector<uint8_t> noise(300);
+  for (auto&& val : noise) {
+    val = rand_byte();
+  }
+  noise[0] &= 0x7F;
+  BA_PRECONDITION(channel_table.compress(noise) == noise);
+  BA_PRECONDITION(Huffman::GetTableID(noise) == 0);
+}
+
+// Peers should only use channel tables both sides have identical copies
+// of, and peers that don't send versions at all get none.
+static void TestHuffmanNegotiation() {
+  std::vector<int> frequencies(256, 1);
+  frequencies[0] = 100;
+  HuffmanTable table1(frequencies, 1);
+  frequencies[1] = 50;
+  HuffmanTable table3(frequencies, 3);
+  frequencies[2] = 25;
+  HuffmanTable table3_other(frequencies, 3);
+  BA_PRECONDITION(table3.version() != table3_other.version());
+  BA_PRECONDITION(table1.version() != table3.version());
+
+  std::vector<const HuffmanTable*> ours{nullptr, &table1, nullptr, &table3};
+  std::vector<const HuffmanTable*> theirs{nullptr, &table1, nullptr,
+                                          &table3_other};
+  auto versions = Huffman::GetTableVersions(ours);
+  BA_PRECONDITION(std::count(versions.begin(), versions.end(), ',') == 2);
+
+  BA_PRECONDITION(Huffman::MatchTableVersions(ours, versions) == 0b1010);
+  BA_PRECONDITION(
+      Huffman::MatchTableVersions(ours, Huffman::GetTableVersions(theirs))
+      == 0b0010);
+  BA_PRECONDITION(Huffman::MatchTableVersions(ours, "") == 0);
+  BA_PRECONDITION(Huffman::MatchTableVersions(ours, "zzz") == 0);
+  BA_PRECONDITION(Huffman::MatchTableVersions(ours, "0,0,0") == 0);
+
+  // A peer with fewer channels than us still matches the ones it has.
+  BA_PRECONDITION(
+      Huffman::MatchTableVersions(
+          ours, Huffman::GetTableVersions({nullptr, &table1}))
+      == 0b0010);
+}
+
+// Packets written to a udp recording should read back exactly, with a
+// truncated final record (as a crashed recorder leaves) ending it cleanly.
+static void TestUDPRecordingRoundTrip() {
+  auto path = (std::filesystem::temp_directory_path()
+               / ("ba_udp_recording_test_"
+                  + std::to_string(core::CorePlatform::GetCurrentMicrosecs())))
+                  .string();
+
+  sockaddr_storage from4{};
+  auto* addr4 = reinterpret_cast<sockaddr_in*>(&from4);
+  addr4->sin_family = AF_INET;
+  addr4->sin_port = htons(43210);  // NOLINT
+  BA_PRECONDITION(inet_pton(AF_INET, "192.0.2.7", &addr4->sin_addr) == 1);
+  sockaddr_storage from6{};
+  auto* addr6 = reinterpret_cast<sockaddr_in6*>(&from6);
+  addr6->sin6_family = AF_INET6;
+  addr6->sin6_port = htons(43211);  // NOLINT
+  BA_PRECONDITION(inet_pton(AF_INET6, "2001:db8::1", &addr6->sin6_addr) == 1);
+
+  std::vector<std::pair<std::vector<uint8_t>, const sockaddr_storage*>> sent{
+      {{22, 1, 2, 3}, &from4},
+      {{7}, &from6},
+      {std::vector<uint8_t>(1400, 0xAB), &from4},
+  };
+  {
+    UDPRecordingWriter writer(path);
+    for (auto&& i : sent) {
+      writer.Write(i.first.data(), i.first.size(), *i.second);
+    }
+    BA_PRECONDITION(writer.packet_count() == 3);
+  }
+
+  // Tack on part of another record.
+  FILE* file = fopen(path.c_str(), "ab");
+  BA_PRECONDITION(file);
+  uint8_t partial[10]{};
+  BA_PRECONDITION(fwrite(partial, sizeof(partial), 1, file) == 1);
+  fclose(file);
+
+  {
+    UDPRecordingReader reader(path);
+    UDPRecordingReader::Packet packet;
+    microsecs_t last_time{};
+    for (auto&& i : sent) {
+      BA_PRECONDITION(reader.Read(&packet));
+      BA_PRECONDITION(packet.data == i.first);
+      BA_PRECONDITION(packet.time >= last_time);
+      last_time = packet.time;
+      BA_PRECONDITION(packet.from.ss_family == i.second->ss_family);
+      if (i.second == &from4) {
+        auto* addr = reinterpret_cast<sockaddr_in*>(&packet.from);
+        BA_PRECONDITION(packet.from_size == sizeof(sockaddr_in));
+        BA_PRECONDITION(addr->sin_port == addr4->sin_port);
+        BA_PRECONDITION(!memcmp(&addr->sin_addr, &addr4->sin_addr,
+                                sizeof(addr->sin_addr)));
+      } else {
+        auto* addr = reinterpret_cast<sockaddr_in6*>(&packet.from);
+        BA_PRECONDITION(packet.from_size == sizeof(sockaddr_in6));
+        BA_PRECONDITION(addr->sin6_port == addr6->sin6_port);
+        BA_PRECONDITION(!memcmp(&addr->sin6_addr, &addr6->sin6_addr,
+                                sizeof(addr->sin6_addr)));
+      }
+    }
+    BA_PRECONDITION(!reader.Read(&packet));
+  }
+
+  // Anything else should be refused outright.
+  file = fopen(path.c_str(), "wb");
+  BA_PRECONDITION(file);
+  BA_PRECONDITION(fwrite("BAUDPRC0", 8, 1, file) == 1);
+  fclose(file);
+  bool refused{};
+  try {
+    UDPRecordingReader reader(path);
+  } catch (const Exception&) {
+    refused = true;
+  }
+  std::filesystem::remove(path);
+  BA_PRECONDITION(refused);
+}
+
+struct NativeTestEntry {
+  const char* name;
+  void (*call)();
+};
+
+static const NativeTestEntry kNativeTests[] = {
+    {"timer_list_groups", TestTimerListGroups},
+    {"ode_default_solver", TestODEDefaultSolver},
+    {"narrow_phase_parallel", TestNarrowPhaseParallel},
+    {"collision_tree_cache", TestCollisionTreeCache},
+    {"dynamic_resolution", TestDynamicResolution},
+    {"pending_event_slots", TestPendingEventSlots},
+    {"huffman_round_trip", TestHuffmanRoundTrip},
+    {"huffman_negotiation", TestHuffmanNegotiation},
+    {"udp_recording_round_trip", TestUDPRecordingRoundTrip},
+};
+
+// Tests added by other feature-sets.
+static auto GetAddedTests()
+    -> std::vector<std::pair<std::string, void (*)()>>& {
+  static std::vector<std::pair<std::string, void (*)()>> tests;
+  return tests;
+}
+
+void NativeTests::Add(const std::string& name, void (*call)()) {
+  assert(g_core->InMainThread());
+  GetAddedTests().emplace_back(name, call);
+}
+
+void NativeTests::Run(const std::string& name) {
+  for (auto&& test : kNativeTests) {
+    if (name == test.name) {
+      test.call();
+      return;
+    }
+  }
+  for (auto&& test : GetAddedTests()) {
+    if (name == test.first) {
+      test.second();
+      return;
+    }
+  }
+  throw Exception("No native test named '" + name + "'.", PyExcType::kValue);
+}
+
+auto NativeTests::GetNames() -> std::vector<std::string> {
+  std::vector<std::string> names;
+  for (auto&& test : kNativeTests) {
+    names.emplace_back(test.name);
+  }
+  for (auto&& test : GetAddedTests()) {
+    names.push_back(test.first);
+  }
+  return names;
+}
+
+}  // namespace ballistica::base
@@ -0,0 +1,28 @@
+// Released under the MIT License. See LICENSE for details.
+
+#ifndef BALLISTICA_BASE_SUPPORT_NATIVE_TESTS_H_
+#define BALLISTICA_BASE_SUPPORT_NATIVE_TESTS_H_
+
+#include <string>
+#include <vector>
+
+namespace ballistica::base {
+
+/// Self-contained checks of engine internals that can't be reached from
+/// Python. The test suite runs these through _babase.run_native_test().
+class NativeTests {
+ public:
+  /// Run the named test, throwing an Exception if it fails.
+  static void Run(const std::string& name);
+
+  /// Return the names of all available tests.
+  static auto GetNames() -> std::vector<std::string>;
+
+  /// Make a test from another feature-set available; feature-sets should
+  /// add their tests when their modules are imported.
+  static void Add(const std::string& name, void (*call)());
+};
+
+}  // namespace ballistica::base
+
+#endif  // BALLISTICA_BASE_SUPPORT_NATIVE_TESTS_H_
@@ -2,6 +2,9 @@
 
 #include "ballistica/classic/python/methods/python_methods_classic.h"
 
+#include <optional>
+#include <string>
+
 #include "ballistica/base/graphics/graphics.h"
 #include "ballistica/base/graphics/support/camera.h"
 #include "ballistica/base/input/input.h"
@@ -179,12 +182,68 @@ static PyMethodDef PySetStressTestingDef = {
     "(internal)",
 };
 
+// --------------------------- set_stress_test_soak ----------------------------
+
+static auto PySetStressTestSoak(PyObject* self, PyObject* args,
+                                PyObject* keywds) -> PyObject* {
+  BA_PYTHON_TRY;
+  PyObject* seed_obj = Py_None;
+  PyObject* report_path_obj = Py_None;
+  double report_interval = 60.0;
+  static const char* kwlist[] = {"seed", "report_path", "report_interval",
+                                 nullptr};
+  if (!PyArg_ParseTupleAndKeywords(args, keywds, "|OOd",
+                                   const_cast<char**>(kwlist), &seed_obj,
+                                   &report_path_obj, &report_interval)) {
+    return nullptr;
+  }
+  std::optional<uint32_t> seed;
+  if (seed_obj != Py_None) {
+    seed = static_cast<uint32_t>(Python::GetPyInt64(seed_obj));
+  }
+  std::string report_path;
+  if (report_path_obj != Py_None) {
+    report_path = Python::GetPyString(report_path_obj);
+  }
+  if (report_interval <= 0.0) {
+    throw Exception("report_interval must be positive.", PyExcType::kValue);
+  }
+  g_base->logic->event_loop()->PushCall([seed, report_path, report_interval] {
+    if (seed.has_value()) {
+      g_classic->stress_test()->SetSeed(*seed);
+    }
+    g_classic->stress_test()->SetReporting(report_path, report_interval);
+  });
+  Py_RETURN_NONE;
+  BA_PYTHON_CATCH;
+}
+
+static PyMethodDef PySetStressTestSoakDef = {
+    "set_stress_test_soak",            // name
+    (PyCFunction)PySetStressTestSoak,  // method
+    METH_VARARGS | METH_KEYWORDS,      // flags
+
+    "set_stress_test_soak(seed: int | None = None,\n"
+    "                        report_path: str | None = None,\n"
+    "                        report_interval: float = 60.0) -> None\n"
+    "\n"
+    "(internal)\n"
+    "\n"
+    "Configure long-running stress-test (soak) behavior.\n"
+    "\n"
+    "If a seed is passed, player churn is reseeded with it so runs can be\n"
+    "reproduced. If a report path is passed, a line of JSON summarizing\n"
+    "step times, memory, node, asset, and connection counts is appended\n"
+    "to it every report_interval seconds; pass None to stop reporting.",
+};
+
 // -----------------------------------------------------------------------------
 
 auto PythonMethodsClassic::GetMethods() -> std::vector<PyMethodDef> {
   return {
       PyValueTestDef,
       PySetStressTestingDef,
+      PySetStressTestSoakDef,
   };
 }
 
@@ -2,14 +2,44 @@
 
 #include "ballistica/classic/support/stress_test.h"
 
+#if BA_OSTYPE_LINUX
+#include <unistd.h>
+#endif
+
+#include <cstdio>
+#include <string>
+
+#include "ballistica/base/assets/assets.h"
 #include "ballistica/base/graphics/graphics_server.h"
 #include "ballistica/base/graphics/renderer/renderer.h"
 #include "ballistica/base/input/device/test_input.h"
+#include "ballistica/base/logic/logic.h"
 #include "ballistica/base/support/app_timer.h"
 #include "ballistica/classic/classic.h"
+#include "ballistica/core/platform/core_platform.h"
+#include "ballistica/scene_v1/connection/connection_set.h"
+#include "ballistica/scene_v1/support/host_session.h"
+#include "ballistica/scene_v1/support/scene_v1_app_mode.h"
 
 namespace ballistica::classic {
 
+// Resident memory for our process in bytes, or -1 if unknown.
+static auto GetResidentMemoryBytes() -> int64_t {
+#if BA_OSTYPE_LINUX
+  int64_t bytes{-1};
+  if (FILE* f = fopen("/proc/self/statm", "r")) {
+    long long size, resident;  // NOLINT
+    if (fscanf(f, "%lld %lld", &size, &resident) == 2) {
+      bytes = static_cast<int64_t>(resident) * sysconf(_SC_PAGESIZE);
+    }
+    fclose(f);
+  }
+  return bytes;
+#else
+  return -1;
+#endif
+}
+
 void StressTest::Set(bool enable, int player_count, bool attract_mode) {
   assert(g_base->InLogicThread());
   bool was_stress_testing = stress_testing_;
@@ -38,6 +68,105 @@ void StressTest::Set(bool enable, int player_count, bool attract_mode) {
   }
 }
 
+void StressTest::SetSeed(uint32_t seed) {
+  assert(g_base->InLogicThread());
+  rng_.seed(seed);
+}
+
+void StressTest::SetReporting(const std::string& path, seconds_t interval) {
+  assert(g_base->InLogicThread());
+  report_path_ = path;
+  if (path.empty()) {
+    report_timer_.Clear();
+    return;
+  }
+  assert(interval > 0.0);
+  report_start_time_ = g_base->logic->display_time();
+  report_last_step_count_ = g_base->logic->step_count();
+  report_last_step_time_total_ = g_base->logic->step_time_total();
+  report_last_overrun_count_ = g_base->logic->step_overrun_count();
+  report_last_overrun_time_total_ = g_base->logic->step_overrun_time_total();
+  report_last_deferred_count_ = g_base->logic->deferred_work_count();
+  report_joins_ = report_leaves_ = 0;
+  g_base->logic->ResetStepTimeMax();
+  report_timer_ =
+      base::AppTimer::New(interval, true, [this] { WriteReport(); });
+}
+
+void StressTest::WriteReport() {
+  assert(g_base->InLogicThread());
+  auto* logic = g_base->logic;
+
+  auto steps = logic->step_count() - report_last_step_count_;
+  auto step_time = logic->step_time_total() - report_last_step_time_total_;
+  double step_time_avg =
+      steps > 0 ? static_cast<double>(step_time) / 1000.0 / steps : 0.0;
+  double step_time_max = static_cast<double>(logic->step_time_max()) / 1000.0;
+  auto overruns = logic->step_overrun_count() - report_last_overrun_count_;
+  auto overrun_time =
+      logic->step_overrun_time_total() - report_last_overrun_time_total_;
+  auto deferred = logic->deferred_work_count() - report_last_deferred_count_;
+  report_last_step_count_ = logic->step_count();
+  report_last_step_time_total_ = logic->step_time_total();
+  report_last_overrun_count_ = logic->step_overrun_count();
+  report_last_overrun_time_total_ = logic->step_overrun_time_total();
+  report_last_deferred_count_ = logic->deferred_work_count();
+  logic->ResetStepTimeMax();
+
+  int64_t node_count{-1};
+  int connection_count{-1};
+  if (auto* appmode = scene_v1::SceneV1AppMode::GetActive()) {
+    connection_count = appmode->connections()->GetConnectedClientCount();
+    if (auto* session = appmode->GetForegroundSession()) {
+      if (auto* host_session = session->GetHostSession()) {
+        node_count = static_cast<int64_t>(host_session->GetNodeCount());
+      }
+    }
+  }
+
+  int64_t object_count{-1};
+#if BA_DEBUG_BUILD
+  object_count = g_core->object_count;
+#endif
+
+  auto* assets = g_base->assets;
+  char buffer[1024];
+  snprintf(buffer, sizeof(buffer),
+           "{\"time\": %.3f, \"elapsed\": %.3f, \"players\": %d,"
+           " \"joins\": %lld, \"leaves\": %lld, \"steps\": %lld,"
+           " \"step_time_avg_ms\": %.3f, \"step_time_max_ms\": %.3f,"
+           " \"step_overruns\": %lld, \"step_overrun_total_ms\": %.3f,"
+           " \"deferred_work\": %lld,"
+           " \"memory_rss\": %lld, \"objects\": %lld, \"nodes\": %lld,"
+           " \"meshes\": %u, \"textures\": %u, \"sounds\": %u,"
+           " \"collision_meshes\": %u, \"connections\": %d}\n",
+           logic->display_time(), logic->display_time() - report_start_time_,
+           static_cast<int>(test_inputs_.size()),
+           static_cast<long long>(report_joins_),   // NOLINT
+           static_cast<long long>(report_leaves_),  // NOLINT
+           static_cast<long long>(steps),           // NOLINT
+           step_time_avg, step_time_max,
+           static_cast<long long>(overruns),  // NOLINT
+           static_cast<double>(overrun_time) / 1000.0,
+           static_cast<long long>(deferred),  // NOLINT
+           static_cast<long long>(GetResidentMemoryBytes()),  // NOLINT
+           static_cast<long long>(object_count),              // NOLINT
+           static_cast<long long>(node_count),                // NOLINT
+           assets->total_mesh_count(), assets->total_texture_count(),
+           assets->total_sound_count(), assets->total_collision_mesh_count(),
+           connection_count);
+
+  FILE* f = g_core->platform->FOpen(report_path_.c_str(), "a");
+  if (!f) {
+    Log(LogLevel::kError,
+        "Unable to open stress-test report file '" + report_path_ + "'.");
+    report_timer_.Clear();
+    return;
+  }
+  fputs(buffer, f);
+  fclose(f);
+}
+
 void StressTest::Update() {
   assert(g_base->InLogicThread());
 
@@ -62,23 +191,27 @@ void StressTest::ProcessInputs(int player_count) {
   while (static_cast<int>(test_inputs_.size()) > player_count) {
     delete test_inputs_.front();
     test_inputs_.pop_front();
+    report_leaves_++;
   }
 
   // If we have less than full test-inputs, add one randomly.
   if (static_cast<int>(test_inputs_.size()) < player_count
-      && ((rand() % 1000 < 10))) {  // NOLINT
-    test_inputs_.push_back(new base::TestInput());
+      && rng_() % 1000 < 10) {
+    test_inputs_.push_back(
+        new base::TestInput(static_cast<uint32_t>(rng_())));
+    report_joins_++;
   }
 
   // Every so often lets kill the oldest one off (less often in attract-mode
   // though).
   int odds = attract_mode_ ? 10000 : 2000;
   if (explicit_bool(true)) {
-    if (test_inputs_.size() > 0 && (rand() % odds < 3)) {  // NOLINT
+    if (test_inputs_.size() > 0 && rng_() % odds < 3) {
       stress_test_last_leave_time_ = time;
+      report_leaves_++;
 
       // Usually do oldest; sometimes newest.
-      if (rand() % 5 == 0) {  // NOLINT
+      if (rng_() % 5 == 0) {
         delete test_inputs_.back();
         test_inputs_.pop_back();
       } else {
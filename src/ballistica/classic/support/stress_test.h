@@ -3,19 +3,38 @@
 #ifndef BALLISTICA_CLASSIC_SUPPORT_STRESS_TEST_H_
 #define BALLISTICA_CLASSIC_SUPPORT_STRESS_TEST_H_
 
+#include <list>
+#include <random>
+#include <string>
+
 #include "ballistica/base/base.h"
 #include "ballistica/shared/ballistica.h"
 #include "ballistica/shared/foundation/object.h"
 
 namespace ballistica::classic {
 
+/// Drives a set of fake players joining, playing, and leaving.
+///
+/// Player churn is driven by a seedable generator so long-running soak
+/// tests can be reproduced, and we can optionally write periodic JSON
+/// summaries of engine state to a file to catch slow leaks/slowdowns.
 class StressTest {
  public:
   void Set(bool enable, int player_count, bool attract_mode);
+
+  /// Reseed our player churn (and the fake players we create).
+  void SetSeed(uint32_t seed);
+
+  /// Start writing a JSON summary line to the provided file every
+  /// interval seconds. Pass an empty path to stop. Reporting is
+  /// independent of Set() so it continues across test rounds.
+  void SetReporting(const std::string& path, seconds_t interval);
+
   void Update();
 
  private:
   void ProcessInputs(int player_count);
+  void WriteReport();
   std::list<base::TestInput*> test_inputs_;
 
   millisecs_t stress_test_time_{};
@@ -25,6 +44,19 @@ class StressTest {
   bool stress_testing_{};
   bool attract_mode_{};
   Object::Ref<base::AppTimer> update_timer_{};
+  std::mt19937 rng_;
+
+  // Soak reporting.
+  std::string report_path_;
+  Object::Ref<base::AppTimer> report_timer_{};
+  seconds_t report_start_time_{};
+  int64_t report_last_step_count_{};
+  microsecs_t report_last_step_time_total_{};
+  int64_t report_last_overrun_count_{};
+  microsecs_t report_last_overrun_time_total_{};
+  int64_t report_last_deferred_count_{};
+  int64_t report_joins_{};
+  int64_t report_leaves_{};
 };
 
 }  // namespace ballistica::classic
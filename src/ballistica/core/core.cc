@@ -196,6 +196,11 @@ auto CoreFeatureSet::GetConfigDirectory() -> std::string {
   return ba_env_config_dir_;
 }
 
+void CoreFeatureSet::SetConfigDirectory(const std::string& dir) {
+  BA_PRECONDITION(have_ba_env_vals_);
+  ba_env_config_dir_ = dir;
+}
+
 auto CoreFeatureSet::GetDataDirectory() -> std::string {
   BA_PRECONDITION(have_ba_env_vals_);
   return ba_env_data_dir_;
@@ -5,6 +5,7 @@
 
 #include <list>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <thread>
 #include <unordered_map>
@@ -131,6 +132,10 @@ class CoreFeatureSet {
   /// should be included in OS backups.
   auto GetConfigDirectory() -> std::string;
 
+  /// Switch to a different config directory. This must happen before the
+  /// app starts (see PreforkServer).
+  void SetConfigDirectory(const std::string& dir);
+
   /// Get the data directory. This dir contains ba_data and possibly other
   /// platform-specific bits needed for the app to function.
   auto GetDataDirectory() -> std::string;
@@ -157,6 +162,11 @@ class CoreFeatureSet {
   auto engine_done() const { return engine_done_; }
   void set_engine_done() { engine_done_ = true; }
 
+  /// When running as one of a set of preforked servers, our index in the
+  /// set (see PreforkServer). Unset otherwise.
+  auto prefork_worker_index() const { return prefork_worker_index_; }
+  void set_prefork_worker_index(int val) { prefork_worker_index_ = val; }
+
   // Subsystems.
   CorePython* const python;
   CorePlatform* const platform;
@@ -204,6 +214,7 @@ class CoreFeatureSet {
   bool using_custom_app_python_dir_{};
   bool engine_done_{};
 
+  std::optional<int> prefork_worker_index_{};
   std::thread::id main_thread_id_{};
   CoreConfig core_config_;
   std::string build_src_dir_;
@@ -2,8 +2,10 @@
 
 #include "ballistica/core/support/core_config.h"
 
+#include <algorithm>
 #include <cstring>
 #include <filesystem>
+#include <string>
 
 // Note to self: this stuff gets used before *any* of the engine is inited
 // so we can't use engine functionality at all here.
@@ -46,7 +48,10 @@ static void PrintHelp() {
       " the app loop.\n"
       " -C, --config-dir  <path>  Override the app config directory.\n"
       " -d, --data-dir    <path>  Override the app data directory.\n"
-      " -m, --mods-dir    <path>  Override the app mods directory.\n");
+      " -m, --mods-dir    <path>  Override the app mods directory.\n"
+      " -p, --prefork     <count> Bootstrap once and fork this many"
+      " servers\n"
+      "                           (headless builds only).\n");
 }
 
 /// If the arg at the provided index matches the long/short names given,
@@ -91,6 +96,9 @@ void CoreConfig::ApplyEnvVars() {
       debug_timing = true;
     }
   }
+  if (auto* envval = getenv("BA_PREFORK_WORKERS")) {
+    prefork_workers = std::max(0, atoi(envval));
+  }
 }
 
 void CoreConfig::ApplyArgs(int argc, char** argv) {
@@ -157,6 +165,12 @@ void CoreConfig::ApplyArgs(int argc, char** argv) {
                  user_python_dir->c_str());
           throw BadArgsException();
         }
+      } else if ((value = ParseArgValue(argc, argv, &i, "--prefork", "-p"))) {
+        prefork_workers = atoi(value->c_str());
+        if (prefork_workers < 1) {
+          printf("Error: Prefork worker count must be a positive integer.\n");
+          throw BadArgsException();
+        }
       } else {
         printf(
             "Error: Invalid arg '%s'.\n"
@@ -67,6 +67,10 @@ class CoreConfig {
 
   /// Explicitly passed user-python (mods) dir.
   std::optional<std::string> user_python_dir{};
+
+  /// If nonzero, a headless build bootstraps once and then forks this
+  /// many server processes which share its memory copy-on-write.
+  int prefork_workers{};
 };
 
 }  // namespace ballistica::core
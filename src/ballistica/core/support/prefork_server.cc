@@ -0,0 +1,399 @@
+// Released under the MIT License. See LICENSE for details.
+
+#include "ballistica/core/support/prefork_server.h"
+
+#if !BA_OSTYPE_WINDOWS
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "ballistica/core/core.h"
+#include "ballistica/core/platform/core_platform.h"
+#include "ballistica/shared/foundation/logging.h"
+#include "ballistica/shared/python/python.h"
+#include "ballistica/shared/python/python_command.h"
+#include "ballistica/shared/python/python_sys.h"
+
+namespace ballistica::core {
+
+// How often we log how much memory our workers are sharing.
+const millisecs_t kPreforkMemoryReportInterval{60000};
+
+// Workers crashing sooner than this after spawning are not respawned;
+// something is likely wrong with our setup and we'd just spin.
+const millisecs_t kPreforkMinRespawnUptime{5000};
+
+// Modules most servers wind up importing; pulling these in before forking
+// lets all workers share them.
+static const char* kPreforkPreloadCommand =
+    "import gc\n"
+    "import logging\n"
+    "for _mod in ('bascenev1', 'baclassic', 'bascenev1lib.mainmenu',\n"
+    "             'bascenev1lib.actor.playerspaz',\n"
+    "             'bascenev1lib.actor.spazbot', 'bascenev1lib.maps'):\n"
+    "    try:\n"
+    "        __import__(_mod)\n"
+    "    except Exception:\n"
+    "        logging.exception('Prefork preload of %s failed.', _mod)\n"
+    "gc.collect()\n"
+    "gc.freeze()\n";
+
+#if !BA_OSTYPE_WINDOWS
+static volatile sig_atomic_t g_prefork_stop_signal{};
+static struct sigaction g_prefork_old_sigterm {};
+static struct sigaction g_prefork_old_sigint {};
+
+static void PreforkStopSignalHandler(int sig) { g_prefork_stop_signal = sig; }
+
+static void WriteAll(int fd, const char* data, size_t size) {
+  while (size > 0) {
+    auto written = write(fd, data, size);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      // Most likely the worker just died; we'll find out when reaping.
+      return;
+    }
+    data += written;
+    size -= static_cast<size_t>(written);
+  }
+}
+#endif  // !BA_OSTYPE_WINDOWS
+
+PreforkServer::PreforkServer(int worker_count) {
+  assert(worker_count > 0);
+  workers_.resize(static_cast<size_t>(worker_count));
+  for (int i = 0; i < worker_count; ++i) {
+    workers_[i].index = i;
+  }
+}
+
+#if BA_OSTYPE_WINDOWS
+
+auto PreforkServer::Run() -> std::optional<int> {
+  Log(LogLevel::kError,
+      "Prefork mode is not supported on this platform;"
+      " running a single server.");
+  return {};
+}
+
+#else  // BA_OSTYPE_WINDOWS
+
+auto PreforkServer::Run() -> std::optional<int> {
+  assert(g_core && g_core->InMainThread());
+  assert(Python::HaveGIL());
+
+  Preload_();
+
+  for (auto&& worker : workers_) {
+    if (SpawnWorker_(&worker)) {
+      return {};
+    }
+  }
+
+  // From here on out we're the parent. Shut our workers down along with
+  // us, and don't let a worker that died mid-read take us down.
+  struct sigaction action {};
+  action.sa_handler = PreforkStopSignalHandler;
+  sigemptyset(&action.sa_mask);
+  sigaction(SIGTERM, &action, &g_prefork_old_sigterm);
+  sigaction(SIGINT, &action, &g_prefork_old_sigint);
+  signal(SIGPIPE, SIG_IGN);
+
+  Log(LogLevel::kInfo, "Prefork parent supervising "
+                           + std::to_string(workers_.size()) + " workers.");
+  last_memory_report_time_ = CorePlatform::GetCurrentMillisecs();
+
+  while (true) {
+    // We need the GIL to fork but don't want to hold it while sitting
+    // around (Python's log thread needs it).
+    std::vector<Worker*> respawns;
+    {
+      Python::ScopedInterpreterLockRelease gil_release;
+      respawns = Supervise_();
+    }
+    if (respawns.empty()) {
+      break;
+    }
+    for (auto* worker : respawns) {
+      Log(LogLevel::kWarning,
+          "Respawning prefork worker " + std::to_string(worker->index) + ".");
+      if (SpawnWorker_(worker)) {
+        return {};
+      }
+    }
+  }
+
+  int exit_code{};
+  for (auto&& worker : workers_) {
+    if (worker.exit_code != 0) {
+      exit_code = worker.exit_code;
+    }
+  }
+  Log(LogLevel::kInfo, "All prefork workers have exited.");
+  return exit_code;
+}
+
+void PreforkServer::Preload_() {
+  if (!PythonCommand(kPreforkPreloadCommand, "<prefork preload>")
+           .Exec(true, nullptr, nullptr)) {
+    Log(LogLevel::kWarning, "Prefork preload failed; continuing anyway.");
+  }
+}
+
+auto PreforkServer::SpawnWorker_(Worker* worker) -> bool {
+  int fds[2];
+  if (pipe(fds) != 0) {
+    Log(LogLevel::kError, "Prefork: unable to create worker stdin pipe.");
+    return false;
+  }
+
+  // Don't want anything sitting in stdio buffers to get written twice.
+  fflush(stdout);
+  fflush(stderr);
+
+  PyOS_BeforeFork();
+  pid_t pid = fork();
+  if (pid == 0) {
+    PyOS_AfterFork_Child();
+
+    // Go back to regular signal behavior (this only matters for respawns
+    // since our handlers aren't installed for the first batch).
+    if (g_prefork_old_sigterm.sa_handler != nullptr) {
+      sigaction(SIGTERM, &g_prefork_old_sigterm, nullptr);
+      sigaction(SIGINT, &g_prefork_old_sigint, nullptr);
+    }
+
+    // Our stdin is now whatever the parent forwards to us.
+    dup2(fds[0], STDIN_FILENO);
+    close(fds[0]);
+    close(fds[1]);
+    for (auto&& other : workers_) {
+      if (other.stdin_fd != -1) {
+        close(other.stdin_fd);
+      }
+    }
+    g_core->set_prefork_worker_index(worker->index);
+    UseWorkerConfigDir_(*worker);
+    return true;
+  }
+  PyOS_AfterFork_Parent();
+  close(fds[0]);
+
+  if (pid < 0) {
+    close(fds[1]);
+    Log(LogLevel::kError, "Prefork: fork() failed for worker "
+                              + std::to_string(worker->index) + ".");
+    return false;
+  }
+  worker->pid = pid;
+  worker->stdin_fd = fds[1];
+  worker->start_time = CorePlatform::GetCurrentMillisecs();
+  worker->exit_code = 0;
+  if (!stdin_open_) {
+    close(worker->stdin_fd);
+    worker->stdin_fd = -1;
+  } else if (have_initial_input_) {
+    WriteAll(worker->stdin_fd, initial_input_.data(), initial_input_.size());
+  }
+  return false;
+}
+
+void PreforkServer::UseWorkerConfigDir_(const Worker& worker) {
+  // Workers would otherwise all be writing the same config, replays,
+  // logs, etc. Each gets a dir of its own, starting with a copy of our
+  // config the first time through.
+  std::string parent_dir = g_core->GetConfigDirectory();
+  std::string dir = parent_dir + BA_DIRSLASH + "prefork_worker_"
+                    + std::to_string(worker.index);
+  g_core->platform->MakeDir(dir);
+  std::string config_path = dir + BA_DIRSLASH + "config.json";
+  std::string parent_config_path = parent_dir + BA_DIRSLASH + "config.json";
+  std::error_code err;
+  if (!g_core->platform->FilePathExists(config_path)
+      && g_core->platform->FilePathExists(parent_config_path)) {
+    std::filesystem::copy_file(parent_config_path, config_path, err);
+    if (err) {
+      Log(LogLevel::kWarning, "Prefork: unable to copy config to '" + dir
+                                  + "': " + err.message());
+    }
+  }
+  g_core->SetConfigDirectory(dir);
+}
+
+auto PreforkServer::Supervise_() -> std::vector<Worker*> {
+  std::vector<Worker*> respawns;
+  while (true) {
+    if (g_prefork_stop_signal != 0 && !shutting_down_) {
+      shutting_down_ = true;
+      for (auto&& worker : workers_) {
+        if (worker.pid != -1) {
+          kill(worker.pid, g_prefork_stop_signal);
+        }
+      }
+    }
+
+    ReapWorkers_(&respawns);
+    if (!respawns.empty() || LiveWorkerCount_() == 0) {
+      return respawns;
+    }
+
+    if (stdin_open_) {
+      pollfd pfd{STDIN_FILENO, POLLIN, 0};
+      if (poll(&pfd, 1, 500) > 0) {
+        ForwardStdin_();
+      }
+    } else {
+      CorePlatform::SleepMillisecs(500);
+    }
+
+    auto now = CorePlatform::GetCurrentMillisecs();
+    if (now - last_memory_report_time_ >= kPreforkMemoryReportInterval) {
+      last_memory_report_time_ = now;
+      ReportMemory_();
+    }
+  }
+}
+
+void PreforkServer::ForwardStdin_() {
+  char buffer[4096];
+  auto count = read(STDIN_FILENO, buffer, sizeof(buffer));
+  if (count < 0 && errno == EINTR) {
+    return;
+  }
+  if (count <= 0) {
+    // Whoever was feeding us is gone; pass that along.
+    stdin_open_ = false;
+    for (auto&& worker : workers_) {
+      if (worker.stdin_fd != -1) {
+        close(worker.stdin_fd);
+        worker.stdin_fd = -1;
+      }
+    }
+    return;
+  }
+  auto size = static_cast<size_t>(count);
+  if (!have_initial_input_) {
+    auto* newline = static_cast<const char*>(memchr(buffer, '\n', size));
+    if (newline) {
+      initial_input_.append(buffer, static_cast<size_t>(newline - buffer) + 1);
+      have_initial_input_ = true;
+    } else {
+      initial_input_.append(buffer, size);
+    }
+  }
+  for (auto&& worker : workers_) {
+    if (worker.stdin_fd != -1) {
+      WriteAll(worker.stdin_fd, buffer, size);
+    }
+  }
+}
+
+void PreforkServer::ReapWorkers_(std::vector<Worker*>* respawns) {
+  int status{};
+  pid_t pid;
+  while ((pid = waitpid(-1, &status, WNOHANG)) > 0) {
+    auto worker = std::find_if(workers_.begin(), workers_.end(),
+                               [pid](const Worker& w) { return w.pid == pid; });
+    if (worker == workers_.end()) {
+      continue;
+    }
+    worker->pid = -1;
+    if (worker->stdin_fd != -1) {
+      close(worker->stdin_fd);
+      worker->stdin_fd = -1;
+    }
+    if (WIFSIGNALED(status)) {
+      worker->exit_code = 128 + WTERMSIG(status);
+    } else if (WIFEXITED(status)) {
+      worker->exit_code = WEXITSTATUS(status);
+    }
+    Log(worker->exit_code == 0 ? LogLevel::kInfo : LogLevel::kWarning,
+        "Prefork worker " + std::to_string(worker->index) + " exited with code "
+            + std::to_string(worker->exit_code) + ".");
+
+    // Clean exits are intentional (shutdown commands, idle exits, etc.)
+    // so we only bring back workers that died.
+    if (worker->exit_code == 0 || shutting_down_) {
+      continue;
+    }
+    auto uptime = CorePlatform::GetCurrentMillisecs() - worker->start_time;
+    if (uptime < kPreforkMinRespawnUptime) {
+      Log(LogLevel::kError, "Prefork worker " + std::to_string(worker->index)
+                                + " died too quickly; not respawning.");
+      continue;
+    }
+    respawns->push_back(&*worker);
+  }
+}
+
+auto PreforkServer::LiveWorkerCount_() const -> int {
+  return static_cast<int>(
+      std::count_if(workers_.begin(), workers_.end(),
+                    [](const Worker& w) { return w.pid != -1; }));
+}
+
+void PreforkServer::ReportMemory_() {
+#if BA_OSTYPE_LINUX
+  // Sum up proportional vs. resident usage for us and our workers. Pages
+  // we all share get split between us in the proportional set size, so
+  // the difference between the two is roughly what we'd be spending if
+  // each server were loading everything itself.
+  std::vector<int> pids{static_cast<int>(getpid())};
+  for (auto&& worker : workers_) {
+    if (worker.pid != -1) {
+      pids.push_back(worker.pid);
+    }
+  }
+  int64_t rss_kb{}, pss_kb{}, shared_kb{};
+  for (auto pid : pids) {
+    auto path{"/proc/" + std::to_string(pid) + "/smaps_rollup"};
+    FILE* file = fopen(path.c_str(), "r");
+    if (!file) {
+      continue;
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), file)) {
+      char name[64];
+      long long value{};  // NOLINT(runtime/int)
+      if (sscanf(line, "%63[^:]: %lld kB", name, &value) != 2) {
+        continue;
+      }
+      if (!strcmp(name, "Rss")) {
+        rss_kb += value;
+      } else if (!strcmp(name, "Pss")) {
+        pss_kb += value;
+      } else if (!strcmp(name, "Shared_Clean")
+                 || !strcmp(name, "Shared_Dirty")) {
+        shared_kb += value;
+      }
+    }
+    fclose(file);
+  }
+  char buffer[256];
+  snprintf(buffer, sizeof(buffer),
+           "Prefork memory (%d processes): rss %.1f MB, pss %.1f MB,"
+           " shared %.1f MB, ~%.1f MB saved.",
+           static_cast<int>(pids.size()), static_cast<double>(rss_kb) / 1024.0,
+           static_cast<double>(pss_kb) / 1024.0,
+           static_cast<double>(shared_kb) / 1024.0,
+           static_cast<double>(rss_kb - pss_kb) / 1024.0);
+  Log(LogLevel::kInfo, buffer);
+#endif  // BA_OSTYPE_LINUX
+}
+
+#endif  // BA_OSTYPE_WINDOWS
+
+}  // namespace ballistica::core
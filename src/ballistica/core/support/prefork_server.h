@@ -0,0 +1,66 @@
+// Released under the MIT License. See LICENSE for details.
+
+#ifndef BALLISTICA_CORE_SUPPORT_PREFORK_SERVER_H_
+#define BALLISTICA_CORE_SUPPORT_PREFORK_SERVER_H_
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "ballistica/shared/ballistica.h"
+
+namespace ballistica::core {
+
+/// Runs a set of headless servers as forks of a single bootstrapped
+/// process so that they share its Python modules and other read-only
+/// memory copy-on-write.
+///
+/// This must happen before the app is started since fork() only carries
+/// the calling thread over to the child; at that point we're still
+/// single-threaded (aside from Python's log thread, which knows how to
+/// restart itself). Each worker listens on the configured port plus its
+/// worker index. Our stdin is forwarded to all workers, and the first
+/// line received (the server wrapper's config command) is replayed to any
+/// worker we respawn. Workers that crash are respawned; workers exiting
+/// cleanly are not, and once all workers have exited we exit too.
+///
+/// Each worker uses its own 'prefork_worker_<index>' dir inside the
+/// configured config dir, seeded with a copy of the config there. Mods
+/// and other Python paths are still shared.
+class PreforkServer {
+ public:
+  explicit PreforkServer(int worker_count);
+
+  /// Preload shared state and fork our workers. In workers, this returns
+  /// an empty value and the caller should go on to run the app normally.
+  /// In the parent this returns an exit code once all workers are done.
+  auto Run() -> std::optional<int>;
+
+ private:
+  struct Worker {
+    int index{};
+    int pid{-1};
+    int stdin_fd{-1};
+    millisecs_t start_time{};
+    int exit_code{};
+  };
+  void Preload_();
+  void UseWorkerConfigDir_(const Worker& worker);
+  auto SpawnWorker_(Worker* worker) -> bool;
+  auto Supervise_() -> std::vector<Worker*>;
+  void ForwardStdin_();
+  void ReapWorkers_(std::vector<Worker*>* respawns);
+  void ReportMemory_();
+  auto LiveWorkerCount_() const -> int;
+
+  std::vector<Worker> workers_;
+  std::string initial_input_;
+  bool have_initial_input_{};
+  bool stdin_open_{true};
+  bool shutting_down_{};
+  millisecs_t last_memory_report_time_{};
+};
+
+}  // namespace ballistica::core
+
+#endif  // BALLISTICA_CORE_SUPPORT_PREFORK_SERVER_H_
@@ -33,6 +33,22 @@ const int kPingMeasureInterval = 2000;
 Connection::Connection() {
   // NOLINTNEXTLINE(cppcoreguidelines-prefer-member-initializer)
   creation_time_ = last_average_update_time_ = g_core->GetAppTimeMillisecs();
+
+  // Grab our built-in channel tables; these are what we advertise to our
+  // peer and decode with.
+  for (int i = 0; i < static_cast<int>(base::HuffmanChannel::kLast); ++i) {
+    huffman_tables_.push_back(
+        g_base->huffman->GetChannelTable(static_cast<base::HuffmanChannel>(i)));
+  }
+}
+
+auto Connection::GetHuffmanTableVersions() const -> std::string {
+  return base::Huffman::GetTableVersions(huffman_tables_);
+}
+
+void Connection::SetPeerHuffmanTableVersions(const std::string& versions) {
+  huffman_peer_channels_ =
+      base::Huffman::MatchTableVersions(huffman_tables_, versions);
 }
 
 void Connection::ProcessWaitingMessages() {
@@ -152,7 +168,19 @@ void Connection::HandleResends(millisecs_t real_time,
 void Connection::HandleGamePacketCompressed(const std::vector<uint8_t>& data) {
   std::vector<uint8_t> data_decompressed;
   try {
-    data_decompressed = g_base->huffman->decompress(data);
+    // Peers only use channel tables we've advertised, so anything else
+    // is garbage.
+    auto table_id = base::Huffman::GetTableID(data);
+    if (table_id == 0) {
+      data_decompressed = g_base->huffman->decompress(data);
+    } else {
+      if (table_id >= huffman_tables_.size()
+          || !huffman_tables_[table_id]) {
+        throw Exception("unknown huffman table "
+                        + std::to_string(static_cast<int>(table_id)));
+      }
+      data_decompressed = huffman_tables_[table_id]->decompress(data);
+    }
   } catch (const std::exception& e) {
     Log(LogLevel::kError,
         std::string("Error in huffman decompression for packet: ") + e.what());
@@ -496,8 +524,16 @@ void Connection::SendGamePacket(const std::vector<uint8_t>& data) {
   packet_count_out_++;
   bytes_out_ += data.size();
 
-  // We huffman-compress gamepackets on their way out.
-  std::vector<uint8_t> data_compressed = g_base->huffman->compress(data);
+  // We huffman-compress gamepackets on their way out, using a
+  // channel-specific table when our peer has the same one.
+  auto channel = base::Huffman::ChannelForPacket(data);
+  auto channel_index = static_cast<int>(channel);
+  std::vector<uint8_t> data_compressed =
+      (huffman_peer_channels_ & (0x01u << channel_index))
+          ? huffman_tables_[channel_index]->compress(data)
+          : g_base->huffman->compress(data);
+  g_base->huffman->RecordChannelBytes(channel, data.size(),
+                                      data_compressed.size());
 
 #if kTestPacketDrops
   if (rand() % 100 < kTestPacketDropPercent) {  // NOLINT
@@ -7,6 +7,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "ballistica/base/support/huffman.h"
 #include "ballistica/scene_v1/support/player_spec.h"
 #include "ballistica/shared/foundation/object.h"
 #include "ballistica/shared/python/python_ref.h"
@@ -83,6 +84,13 @@ class Connection : public Object {
   void set_connection_dying(bool val) { connection_dying_ = val; }
   void set_errored(bool val) { errored_ = val; }
 
+  // Per-channel huffman table versions for embedding in our handshake.
+  auto GetHuffmanTableVersions() const -> std::string;
+
+  // Take note of the table versions from our peer's handshake; we'll use
+  // any channel tables that match ours when sending to them.
+  void SetPeerHuffmanTableVersions(const std::string& versions);
+
  private:
   void ProcessWaitingMessages();
   void HandleResends(millisecs_t real_time, const std::vector<uint8_t>& data,
@@ -90,6 +98,11 @@ class Connection : public Object {
   void EmbedAcks(millisecs_t real_time, std::vector<uint8_t>* data, int offset);
   std::vector<uint8_t> multipart_buffer_;
 
+  // The channel tables we advertise to our peer (nullptr means the
+  // generic table) and a bitmask of channels where our peer matches.
+  std::vector<const base::HuffmanTable*> huffman_tables_;
+  uint32_t huffman_peer_channels_{};
+
   struct ReliableMessageIn {
     std::vector<uint8_t> data;
     millisecs_t arrival_time;
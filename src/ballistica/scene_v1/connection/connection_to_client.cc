@@ -107,6 +107,9 @@ void ConnectionToClient::Update() {
       // We also add our random salt for hashing.
       dict.AddString("l", our_handshake_salt_);
 
+      // And the versions of our channel-specific huffman tables.
+      dict.AddString("hv", GetHuffmanTableVersions());
+
       std::string out = dict.PrintUnformatted();
       std::vector<uint8_t> data(3 + out.size());
       data[0] = BA_SCENEPACKET_HANDSHAKE;
@@ -174,6 +177,13 @@ void ConnectionToClient::HandleGamePacket(const std::vector<uint8_t>& data) {
           if (cJSON* pubdeviceid = cJSON_GetObjectItem(handshake, "d")) {
             public_device_id_ = pubdeviceid->valuestring;
           }
+
+          // Newer builds also tell us which huffman tables they have.
+          if (cJSON* versions = cJSON_GetObjectItem(handshake, "hv")) {
+            if (cJSON_IsString(versions)) {
+              SetPeerHuffmanTableVersions(versions->valuestring);
+            }
+          }
           cJSON_Delete(handshake);
         }
       } else {
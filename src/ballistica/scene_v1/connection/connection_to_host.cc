@@ -128,6 +128,9 @@ void ConnectionToHost::HandleGamePacket(const std::vector<uint8_t>& data) {
         // use this to combat spammers.
         dict.AddString("d", g_base->platform->GetPublicDeviceUUID());
 
+        // And the versions of our channel-specific huffman tables.
+        dict.AddString("hv", GetHuffmanTableVersions());
+
         std::string out = dict.PrintUnformatted();
 
         std::vector<uint8_t> data2(3 + out.size());
@@ -181,6 +184,12 @@ void ConnectionToHost::HandleGamePacket(const std::vector<uint8_t>& data) {
             if (salt) {
               peer_hash_input_ += salt->valuestring;
             }
+
+            // Use any channel huffman tables we have in common.
+            cJSON* versions = cJSON_GetObjectItem(handshake, "hv");
+            if (versions && cJSON_IsString(versions)) {
+              SetPeerHuffmanTableVersions(versions->valuestring);
+            }
             cJSON_Delete(handshake);
           }
         } else {
@@ -0,0 +1,175 @@
+// Released under the MIT License. See LICENSE for details.
+
+#ifndef BALLISTICA_SCENE_V1_DYNAMICS_COLLISION_SOUND_MERGER_H_
+#define BALLISTICA_SCENE_V1_DYNAMICS_COLLISION_SOUND_MERGER_H_
+
+#include <vector>
+
+#include "ballistica/scene_v1/scene_v1.h"
+#include "ballistica/shared/foundation/object.h"
+
+namespace ballistica::scene_v1 {
+
+/// Gathers the collision sounds requested during a dynamics step and
+/// merges ones close together, so a burst of contacts plays as a handful
+/// of sounds instead of one per contact. This is templated on the sound
+/// type only so it can be tested without real sound assets.
+template <typename SoundT>
+class CollisionSoundMerger {
+ public:
+  /// Impacts merged into a single sound. We keep the loudest one's sound
+  /// and sum gains as uncorrelated sources do.
+  struct Impact {
+    Object::Ref<SoundT> sound;
+    float gain{};
+    float gain_squared_sum{};
+
+    // Gain-weighted position sums; divide by weight for the position.
+    float x{};
+    float y{};
+    float z{};
+    float weight{};
+    int event_count{};
+  };
+
+  /// A looping skid or roll sound waiting to be started. Merged starts
+  /// keep the loudest one's values.
+  struct LoopStart {
+    bool roll{};
+    Object::Ref<SoundT> sound;
+    float gain{};
+    float x{};
+    float y{};
+    float z{};
+    uint32_t* play_id{};
+    bool* playing{};
+    Part* part1{};
+    Part* part2{};
+    int event_count{};
+  };
+
+  explicit CollisionSoundMerger(float merge_distance)
+      : merge_distance_{merge_distance} {}
+
+  void AddImpact(SoundT* sound, float gain, float x, float y, float z) {
+    assert(sound);
+    for (auto&& i : impacts_) {
+      if (Near_(i.x / i.weight, i.y / i.weight, i.z / i.weight, x, y, z)) {
+        if (gain > i.gain) {
+          i.sound = sound;
+          i.gain = gain;
+        }
+        i.gain_squared_sum += gain * gain;
+        i.x += x * gain;
+        i.y += y * gain;
+        i.z += z * gain;
+        i.weight += gain;
+        i.event_count++;
+        return;
+      }
+    }
+    if (gain <= 0.0f) {
+      return;
+    }
+    auto& i = impacts_.emplace_back();
+    i.sound = sound;
+    i.gain = gain;
+    i.gain_squared_sum = gain * gain;
+    i.x = x * gain;
+    i.y = y * gain;
+    i.z = z * gain;
+    i.weight = gain;
+    i.event_count = 1;
+  }
+
+  void AddLoopStart(bool roll, SoundT* sound, float gain, float x, float y,
+                    float z, uint32_t* play_id, bool* playing, Part* p1,
+                    Part* p2) {
+    assert(sound && play_id && playing);
+    for (auto&& i : loop_starts_) {
+      // Multiple contacts for the same collision come through separately;
+      // they must only ever start one sound.
+      if (i.playing == playing
+          || (i.roll == roll && i.sound.Get() == sound
+              && Near_(i.x, i.y, i.z, x, y, z))) {
+        if (gain > i.gain) {
+          i.gain = gain;
+          i.x = x;
+          i.y = y;
+          i.z = z;
+          i.play_id = play_id;
+          i.playing = playing;
+          i.part1 = p1;
+          i.part2 = p2;
+        }
+        i.event_count++;
+        return;
+      }
+    }
+    auto& i = loop_starts_.emplace_back();
+    i.roll = roll;
+    i.sound = sound;
+    i.gain = gain;
+    i.x = x;
+    i.y = y;
+    i.z = z;
+    i.play_id = play_id;
+    i.playing = playing;
+    i.part1 = p1;
+    i.part2 = p2;
+    i.event_count = 1;
+  }
+
+  /// Note a skid or roll sound that is already playing, so we don't start
+  /// another of the same right on top of it.
+  void NoteLoopPlaying(bool roll, SoundT* sound, float x, float y, float z) {
+    loop_playing_.push_back({roll, sound, x, y, z});
+  }
+
+  auto IsLoopPlaying(const LoopStart& start) const -> bool {
+    for (auto&& i : loop_playing_) {
+      if (i.roll == start.roll && i.sound == start.sound.Get()
+          && Near_(start.x, start.y, start.z, i.x, i.y, i.z)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  auto impacts() const -> const std::vector<Impact>& { return impacts_; }
+  auto loop_starts() const -> const std::vector<LoopStart>& {
+    return loop_starts_;
+  }
+
+  void Clear() {
+    impacts_.clear();
+    loop_starts_.clear();
+    loop_playing_.clear();
+  }
+
+ private:
+  struct LoopPlaying_ {
+    bool roll{};
+    SoundT* sound{};
+    float x{};
+    float y{};
+    float z{};
+  };
+
+  auto Near_(float x1, float y1, float z1, float x2, float y2, float z2) const
+      -> bool {
+    float dx = x2 - x1;
+    float dy = y2 - y1;
+    float dz = z2 - z1;
+    return dx * dx + dy * dy + dz * dz < merge_distance_ * merge_distance_;
+  }
+
+  float merge_distance_{};
+  std::vector<Impact> impacts_;
+  std::vector<LoopStart> loop_starts_;
+  std::vector<LoopPlaying_> loop_playing_;
+};
+
+}  // namespace ballistica::scene_v1
+
+#endif  // BALLISTICA_SCENE_V1_DYNAMICS_COLLISION_SOUND_MERGER_H_
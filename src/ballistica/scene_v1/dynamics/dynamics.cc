@@ -2,16 +2,22 @@
 
 #include "ballistica/scene_v1/dynamics/dynamics.h"
 
+#include <algorithm>
+
 #include "ballistica/base/audio/audio.h"
 #include "ballistica/base/audio/audio_source.h"
 #include "ballistica/base/dynamics/collision_cache.h"
 #include "ballistica/base/graphics/renderer/renderer.h"
 #include "ballistica/core/core.h"
+#include "ballistica/core/platform/core_platform.h"
 #include "ballistica/scene_v1/assets/scene_sound.h"
 #include "ballistica/scene_v1/dynamics/collision.h"
+#include "ballistica/scene_v1/dynamics/collision_sound_merger.h"
 #include "ballistica/scene_v1/dynamics/material/material_action.h"
 #include "ballistica/scene_v1/dynamics/part.h"
 #include "ballistica/scene_v1/support/scene.h"
+#include "ballistica/scene_v1/support/scene_v1_app_mode.h"
+#include "ballistica/shared/generic/worker_pool.h"
 #include "ode/ode_collision_kernel.h"
 #include "ode/ode_collision_util.h"
 
@@ -23,6 +29,13 @@ namespace ballistica::scene_v1 {
 //  we may get contacts only at one end of an object, etc.
 #define MAX_CONTACTS 20
 
+// Below this many narrow-phase tests we don't bother with other threads.
+const int kMinParallelCollidePairs = 16;
+
+// Collision sound events closer together than this in a single step get
+// merged into one sound.
+const float kCollisionSoundMergeDistance = 1.0f;
+
 // Given two parts, returns true if part1 is major in
 // the storage order.
 static auto IsInStoreOrder(int64_t node1, int part1, int64_t node2,
@@ -91,6 +104,22 @@ class Dynamics::CollisionEvent_ {
         collision(collision_in) {}
 };
 
+// A candidate pair from the broad phase. We run narrow-phase tests for
+// these ahead of time (possibly in parallel) and then handle them one by
+// one in the order the broad phase produced them.
+class Dynamics::CollidePair_ {
+ public:
+  dGeomID o1{};
+  dGeomID o2{};
+
+  // Whether this pair looked worth testing when it was gathered, and
+  // whether we've since tested it.
+  bool test_ahead{};
+  bool tested{};
+  int contact_count{};
+  dContactGeom contacts[MAX_CONTACTS];
+};
+
 class Dynamics::SrcPartCollideMap_ {
  public:
   std::unordered_map<int, Object::Ref<Collision> > dst_part_collisions;
@@ -126,6 +155,9 @@ class Dynamics::Impl_ {
       const std::unordered_map<int, Object::Ref<Collision> >::iterator& l);
 
  private:
+  // Collision sounds gathered during a step; see EmitCollisionSounds_().
+  CollisionSoundMerger<SceneSound> collision_sounds_{
+      kCollisionSoundMergeDistance};
   Dynamics* dynamics_{};
   // Contains in-progress collisions for current nodes.
   std::unordered_map<int64_t, SrcNodeCollideMap_> node_collisions_;
@@ -440,14 +472,26 @@ void Dynamics::ProcessCollision_() {
     }
   }
 
-  // Process all standard collisions. This will trigger our callback which
-  // do the real work (add collisions to list, store commands to be
-  // called, etc).
+  // Gather all candidate pairs from standard collisions.
+  assert(collide_pairs_.empty());
   dSpaceCollide(ode_space_, this, &DoCollideCallback_);
 
   // Collide our trimeshes against everything.
   collision_cache_->CollideAgainstSpace(ode_space_, this, &DoCollideCallback_);
 
+  // Generate contacts for everything we can ahead of time and then do the
+  // real work for each pair (add collisions to list, store commands to be
+  // called, etc.) in the same order we'd have done it in directly.
+  RunNarrowPhase_();
+  for (auto&& pair : collide_pairs_) {
+    HandleCollidePair_(&pair);
+  }
+  collide_pairs_.clear();
+
+  // Play what the contacts asked for (while the collisions holding the
+  // sound entries are all still around).
+  EmitCollisionSounds_();
+
   // Do a bit of precalc each cycle.
   collision_cache_->Precalc();
 
@@ -515,6 +559,11 @@ void Dynamics::Process() {
   real_time_ = g_core->GetAppTimeMillisecs();
   ProcessCollision_();
   dWorldQuickStep(ode_world_, kGameStepSeconds);
+  dWorldGetQuickStepStats(ode_world_, &solver_stats_);
+  solver_step_count_++;
+  solver_iterations_total_ += solver_stats_.iterations_total;
+  solver_rows_total_ += solver_stats_.rows;
+  solver_warm_started_rows_total_ += solver_stats_.warm_started_rows;
   dJointGroupEmpty(ode_contact_group_);
   in_process_ = false;
 }
@@ -529,6 +578,74 @@ void Dynamics::DoCollideCallback_(void* data, dGeomID o1, dGeomID o2) {
 // This way we know all bodies and their associated nodes, etc are valid
 // throughout collision processing.
 void Dynamics::CollideCallback_(dGeomID o1, dGeomID o2) {
+  collide_pairs_.emplace_back();
+  CollidePair_& pair{collide_pairs_.back()};
+  pair.o1 = o1;
+  pair.o2 = o2;
+
+  // Note whether this looks to be worth testing based on the same checks
+  // HandleCollidePair_() starts with. Handling earlier pairs can change
+  // things (waking bodies, etc.) so we re-check when handling it and test
+  // anything we skipped then if need be.
+  dBodyID b1 = dGeomGetBody(o1);
+  dBodyID b2 = dGeomGetBody(o2);
+  if ((dGeomGetClass(o1) == dTriMeshClass && b2 && !dBodyIsEnabled(b2))
+      || (dGeomGetClass(o2) == dTriMeshClass && b1 && !dBodyIsEnabled(b1))) {
+    return;
+  }
+
+  // Geom-transforms temporarily modify the geom they wrap while colliding,
+  // so they can't be tested alongside other pairs.
+  if (dGeomGetClass(o1) == dGeomTransformClass
+      || dGeomGetClass(o2) == dGeomTransformClass) {
+    return;
+  }
+  auto* r1 = static_cast<RigidBody*>(dGeomGetData(o1));
+  auto* r2 = static_cast<RigidBody*>(dGeomGetData(o2));
+  assert(r1 && r2);
+  if (!((r1->collide_type() & r2->collide_mask())
+        && (r2->collide_type() & r1->collide_mask()))) {  // NOLINT
+    return;
+  }
+  pair.test_ahead = r1->part()->node()->PreFilterCollision(r1, r2)
+                    && r2->part()->node()->PreFilterCollision(r2, r1);
+}
+
+void Dynamics::RunNarrowPhase_() {
+  // Not worth spinning up threads for just a few tests.
+  int test_count{};
+  for (auto&& pair : collide_pairs_) {
+    test_count += pair.test_ahead;
+  }
+  if (test_count < kMinParallelCollidePairs) {
+    return;
+  }
+  auto* appmode = SceneV1AppMode::GetActive();
+  WorkerPool* pool = appmode ? appmode->GetNarrowPhasePool() : nullptr;
+  if (!pool) {
+    return;
+  }
+
+  // dCollide() only reads geom state here: the broad phase has already
+  // brought every geom's transform and AABB up to date, trimesh colliders
+  // and the capsule-trimesh scratch globals are per-thread, we never turn
+  // on per-mesh temporal coherence, and geom-transforms (which do write)
+  // are kept out of this batch. Each pair writes only its own results. The
+  // narrow_phase_parallel native test checks that results match running
+  // serially.
+  pool->ParallelFor(static_cast<int>(collide_pairs_.size()), [this](int i) {
+    CollidePair_& pair{collide_pairs_[i]};
+    if (pair.test_ahead) {
+      pair.contact_count = dCollide(pair.o1, pair.o2, MAX_CONTACTS,
+                                    pair.contacts, sizeof(dContactGeom));
+      pair.tested = true;
+    }
+  });
+}
+
+void Dynamics::HandleCollidePair_(CollidePair_* pair) {
+  dGeomID o1 = pair->o1;
+  dGeomID o2 = pair->o2;
   dBodyID b1 = dGeomGetBody(o1);
   dBodyID b2 = dGeomGetBody(o2);
 
@@ -598,8 +715,16 @@ void Dynamics::CollideCallback_(dGeomID o1, dGeomID o2) {
   // detection test would be economical but if there's a simple way to know
   // they'll never collide.
   dContact contact[MAX_CONTACTS];  // up to MAX_CONTACTS contacts per pair
-  if (int numc =
-          dCollide(o1, o2, MAX_CONTACTS, &contact[0].geom, sizeof(dContact))) {
+  int numc;
+  if (pair->tested) {
+    numc = pair->contact_count;
+    for (int i = 0; i < numc; i++) {
+      contact[i].geom = pair->contacts[i];
+    }
+  } else {
+    numc = dCollide(o1, o2, MAX_CONTACTS, &contact[0].geom, sizeof(dContact));
+  }
+  if (numc) {
     MaterialContext* cc1;
     MaterialContext* cc2;
 
@@ -873,16 +998,10 @@ void Dynamics::CollideCallback_(dGeomID o1, dGeomID o2) {
 
                 if (volume > 1) volume = 1;
                 assert(i.sound.Exists());
-                if (base::AudioSource* source =
-                        g_base->audio->SourceBeginNew()) {
-                  source->SetGain(volume * i.volume);
-                  source->SetPosition(apx, apy, apz);
-                  source->Play(i.sound->GetSoundData());
-                  p1->set_last_impact_sound_time(real_time);
-                  p2->set_last_impact_sound_time(real_time);
-                  last_impact_sound_time_ = real_time;
-                  source->End();
-                }
+                QueueImpactSound_(i.sound.Get(), volume * i.volume, apx, apy,
+                                  apz);
+                p1->set_last_impact_sound_time(real_time);
+                p2->set_last_impact_sound_time(real_time);
               }
             }
           }
@@ -910,6 +1029,7 @@ void Dynamics::CollideCallback_(dGeomID o1, dGeomID o2) {
                     s->SetGain(volume * i.volume);
                     s->SetPosition(apx, apy, apz);
                     s->End();
+                    NoteLoopSoundPlaying_(false, i.sound.Get(), apx, apy, apz);
                   } else {
                     // Spare ourself some trouble next time.
                     i.playing = false;
@@ -917,17 +1037,9 @@ void Dynamics::CollideCallback_(dGeomID o1, dGeomID o2) {
                 } else if (real_time - p1->last_skid_sound_time() >= 250
                            || real_time - p2->last_skid_sound_time() > 250) {
                   assert(i.sound.Exists());
-                  if (base::AudioSource* source =
-                          g_base->audio->SourceBeginNew()) {
-                    source->SetLooping(true);
-                    source->SetGain(volume * i.volume);
-                    source->SetPosition(apx, apy, apz);
-                    i.play_id = source->Play(i.sound->GetSoundData());
-                    i.playing = true;
-                    p1->set_last_skid_sound_time(real_time);
-                    p2->set_last_skid_sound_time(real_time);
-                    source->End();
-                  }
+                  QueueLoopSoundStart_(false, i.sound.Get(), volume * i.volume,
+                                       apx, apy, apz, &i.play_id, &i.playing,
+                                       p1, p2);
                 }
               } else {
                 // Skid values are low - stop any playing skid sounds.
@@ -962,6 +1074,7 @@ void Dynamics::CollideCallback_(dGeomID o1, dGeomID o2) {
                     s->SetGain(volume * i.volume);
                     s->SetPosition(apx, apy, apz);
                     s->End();
+                    NoteLoopSoundPlaying_(true, i.sound.Get(), apx, apy, apz);
                   } else {
                     // spare ourself some trouble next time
                     i.playing = false;
@@ -969,17 +1082,9 @@ void Dynamics::CollideCallback_(dGeomID o1, dGeomID o2) {
                 } else if (real_time - p1->last_roll_sound_time() >= 250
                            || real_time - p2->last_roll_sound_time() > 250) {
                   assert(i.sound.Exists());
-                  if (base::AudioSource* source =
-                          g_base->audio->SourceBeginNew()) {
-                    source->SetLooping(true);
-                    source->SetGain(volume * i.volume);
-                    source->SetPosition(apx, apy, apz);
-                    i.play_id = source->Play(i.sound->GetSoundData());
-                    i.playing = true;
-                    p1->set_last_roll_sound_time(real_time);
-                    p2->set_last_roll_sound_time(real_time);
-                    source->End();
-                  }
+                  QueueLoopSoundStart_(true, i.sound.Get(), volume * i.volume,
+                                       apx, apy, apz, &i.play_id, &i.playing,
+                                       p1, p2);
                 }
               } else {
                 // roll values are low - stop any playing roll sounds
@@ -1105,6 +1210,81 @@ void Dynamics::CollideCallback_(dGeomID o1, dGeomID o2) {
   }
 }
 
+// Impacts from a pile of props hitting the ground at once all land in the
+// same step and can't be told apart by ear, so rather than playing one
+// sound per contact we merge everything close together into a single
+// sound.
+void Dynamics::QueueImpactSound_(SceneSound* sound, float gain, float x,
+                                 float y, float z) {
+  collision_sound_stats_.impact_events++;
+
+  // Note the time now rather than when the merged sound goes out so
+  // impact-sound actions can skip the rest of this step's contacts.
+  last_impact_sound_time_ = real_time_;
+  impl_->collision_sounds_.AddImpact(sound, gain, x, y, z);
+}
+
+// Skids and rolls are looping sounds that stick around while a collision
+// lasts, so here we just avoid starting new ones right on top of others
+// of the same sound.
+void Dynamics::QueueLoopSoundStart_(bool roll, SceneSound* sound, float gain,
+                                    float x, float y, float z,
+                                    uint32_t* play_id, bool* playing, Part* p1,
+                                    Part* p2) {
+  // Throttle the parts whether or not this event survives merging;
+  // otherwise ones merged away would be re-queued every step.
+  if (roll) {
+    collision_sound_stats_.roll_events++;
+    p1->set_last_roll_sound_time(real_time_);
+    p2->set_last_roll_sound_time(real_time_);
+  } else {
+    collision_sound_stats_.skid_events++;
+    p1->set_last_skid_sound_time(real_time_);
+    p2->set_last_skid_sound_time(real_time_);
+  }
+  impl_->collision_sounds_.AddLoopStart(roll, sound, gain, x, y, z, play_id,
+                                        playing, p1, p2);
+}
+
+void Dynamics::NoteLoopSoundPlaying_(bool roll, SceneSound* sound, float x,
+                                     float y, float z) {
+  impl_->collision_sounds_.NoteLoopPlaying(roll, sound, x, y, z);
+}
+
+void Dynamics::EmitCollisionSounds_() {
+  auto& sounds{impl_->collision_sounds_};
+  for (auto&& i : sounds.impacts()) {
+    if (base::AudioSource* source = g_base->audio->SourceBeginNew()) {
+      source->SetGain(std::min(1.0f, sqrtf(i.gain_squared_sum)));
+      source->SetPosition(i.x / i.weight, i.y / i.weight, i.z / i.weight);
+      source->Play(i.sound->GetSoundData());
+      collision_sound_stats_.impact_sounds++;
+      source->End();
+    }
+  }
+
+  for (auto&& i : sounds.loop_starts()) {
+    // Already have one of these going right here.
+    if (sounds.IsLoopPlaying(i)) {
+      continue;
+    }
+    if (base::AudioSource* source = g_base->audio->SourceBeginNew()) {
+      source->SetLooping(true);
+      source->SetGain(i.gain);
+      source->SetPosition(i.x, i.y, i.z);
+      *i.play_id = source->Play(i.sound->GetSoundData());
+      *i.playing = true;
+      if (i.roll) {
+        collision_sound_stats_.roll_sounds++;
+      } else {
+        collision_sound_stats_.skid_sounds++;
+      }
+      source->End();
+    }
+  }
+  sounds.Clear();
+}
+
 void Dynamics::ShutdownODE_() {
   if (ode_space_) {
     dSpaceDestroy(ode_space_);
@@ -1133,6 +1313,14 @@ void Dynamics::ResetODE_() {
   dWorldSetAutoDisableSteps(ode_world_, 10);
   dWorldSetAutoDisableTime(ode_world_, 0);
   dWorldSetQuickStepNumIterations(ode_world_, 10);
+
+  // Optionally carry contact impulses over between steps and let settled
+  // islands stop iterating early. This changes how every scene plays out,
+  // so it stays opt-in until it has been shown to feel the same.
+  if (g_core->platform->GetEnv("BA_DYNAMICS_WARM_START") == "1") {
+    dWorldSetQuickStepWarmStarting(ode_world_, true);
+    dWorldSetQuickStepTolerance(ode_world_, 0.01f, 3);
+  }
   ode_space_ = dHashSpaceCreate(nullptr);
   assert(ode_space_);
   ode_contact_group_ = dJointGroupCreate(0);
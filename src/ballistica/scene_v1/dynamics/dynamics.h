@@ -74,6 +74,32 @@ class Dynamics : public Object {
   auto last_impact_sound_time() const { return last_impact_sound_time_; }
   auto in_process() const { return in_process_; }
 
+  /// Solver stats for the most recent step.
+  auto solver_stats() const -> const dQuickStepStats& { return solver_stats_; }
+
+  /// Solver totals since the dynamics were created.
+  auto solver_step_count() const { return solver_step_count_; }
+  auto solver_iterations_total() const { return solver_iterations_total_; }
+  auto solver_rows_total() const { return solver_rows_total_; }
+  auto solver_warm_started_rows_total() const {
+    return solver_warm_started_rows_total_;
+  }
+
+  /// Collision sound totals since the dynamics were created. Contacts
+  /// generate sound events, which are merged per step by location before
+  /// being emitted as sounds.
+  struct CollisionSoundStats {
+    int64_t impact_events{};
+    int64_t impact_sounds{};
+    int64_t skid_events{};
+    int64_t skid_sounds{};
+    int64_t roll_events{};
+    int64_t roll_sounds{};
+  };
+  auto collision_sound_stats() const -> const CollisionSoundStats& {
+    return collision_sound_stats_;
+  }
+
  private:
   auto AreColliding_(const Part& p1, const Part& p2) -> bool;
   class SrcNodeCollideMap_;
@@ -81,6 +107,7 @@ class Dynamics : public Object {
   class SrcPartCollideMap_;
   class CollisionEvent_;
   class CollisionReset_;
+  class CollidePair_;
   class Impl_;
   std::vector<CollisionReset_> collision_resets_;
 
@@ -95,10 +122,27 @@ class Dynamics : public Object {
   static void DoCollideCallback_(void* data, dGeomID o1, dGeomID o2);
   void CollideCallback_(dGeomID o1, dGeomID o2);
   void ProcessCollision_();
+  void RunNarrowPhase_();
+  void HandleCollidePair_(CollidePair_* pair);
+  void QueueImpactSound_(SceneSound* sound, float gain, float x, float y,
+                         float z);
+  void QueueLoopSoundStart_(bool roll, SceneSound* sound, float gain, float x,
+                            float y, float z, uint32_t* play_id,
+                            bool* playing, Part* p1, Part* p2);
+  void NoteLoopSoundPlaying_(bool roll, SceneSound* sound, float x, float y,
+                             float z);
+  void EmitCollisionSounds_();
+  std::vector<CollidePair_> collide_pairs_;
 
   int skid_sound_count_{};
   int roll_sound_count_{};
   int collision_count_{};
+  dQuickStepStats solver_stats_{};
+  int64_t solver_step_count_{};
+  int64_t solver_iterations_total_{};
+  int64_t solver_rows_total_{};
+  int64_t solver_warm_started_rows_total_{};
+  CollisionSoundStats collision_sound_stats_;
   bool in_process_{};
   bool in_collide_message_{};
   bool collide_message_reverse_order_{};
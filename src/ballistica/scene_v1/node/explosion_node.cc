@@ -40,7 +40,9 @@ auto ExplosionNode::InitType() -> NodeType* {
 ExplosionNode* g_explosion_distort_lock{};
 
 ExplosionNode::ExplosionNode(Scene* scene)
-    : Node(scene, node_type), birth_time_(scene->time()) {}
+    : Node(scene, node_type), birth_time_(scene->time()) {
+  SetWantsStep(true);
+}
 
 ExplosionNode::~ExplosionNode() {
   if (draw_distortion_ && have_distortion_lock_) {
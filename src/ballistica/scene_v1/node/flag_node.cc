@@ -88,6 +88,7 @@ auto FlagNode::InitType() -> NodeType* {
 enum FlagBodyType { kPoleBodyID };
 
 FlagNode::FlagNode(Scene* scene) : Node(scene, node_type), part_(this) {
+  SetWantsStep(true);
   body_ = Object::New<RigidBody>(
       kPoleBodyID, &part_, RigidBody::Type::kBody, RigidBody::Shape::kCapsule,
       RigidBody::kCollideActive, RigidBody::kCollideAll);
@@ -22,7 +22,12 @@ class FlashNodeType : public NodeType {
       : NodeType("flash", CreateFlash),
         position(this),
         size(this),
-        color(this) {}
+        color(this) {
+    // Wire precision for float attrs (see SetQuantization()).
+    position.SetQuantization(-256.0f, 256.0f, 0.01f);
+    size.SetQuantization(0.0f, 32.0f, 0.001f);
+    color.SetQuantization(0.0f, 2.0f, 2.0f / 255.0f);
+  }
 };
 static NodeType* node_type{};
 
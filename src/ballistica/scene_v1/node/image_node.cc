@@ -59,7 +59,16 @@ class ImageNodeType : public NodeType {
         mesh_transparent(this),
         vr_depth(this),
         host_only(this),
-        front(this) {}
+        front(this) {
+    // Wire precision for float attrs (see SetQuantization()).
+    scale.SetQuantization(-2048.0f, 2048.0f, 0.1f);
+    position.SetQuantization(-2048.0f, 2048.0f, 0.1f);
+    opacity.SetQuantization(0.0f, 1.0f, 1.0f / 255.0f);
+    color.SetQuantization(0.0f, 2.0f, 2.0f / 255.0f);
+    tint_color.SetQuantization(0.0f, 2.0f, 2.0f / 255.0f);
+    tint2_color.SetQuantization(0.0f, 2.0f, 2.0f / 255.0f);
+    rotate.SetQuantization(-720.0f, 720.0f, 0.05f);
+  }
 };
 static NodeType* node_type{};
 
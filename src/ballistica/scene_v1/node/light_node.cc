@@ -19,7 +19,7 @@ class LightNodeType : public NodeType {
                 SetVolumeIntensityScale);
   BA_FLOAT_ARRAY_ATTR(color, color, SetColor);
   BA_FLOAT_ATTR(radius, radius, SetRadius);
-  BA_BOOL_ATTR(lights_volumes, lights_volumes, set_lights_volumes);
+  BA_BOOL_ATTR(lights_volumes, lights_volumes, SetLightsVolumes);
   BA_BOOL_ATTR(height_attenuated, height_attenuated, set_height_attenuated);
 #undef BA_NODE_TYPE_CLASS
   LightNodeType()
@@ -30,7 +30,13 @@ class LightNodeType : public NodeType {
         color(this),
         radius(this),
         lights_volumes(this),
-        height_attenuated(this) {}
+        height_attenuated(this) {
+    // Wire precision for float attrs (see SetQuantization()).
+    position.SetQuantization(-256.0f, 256.0f, 0.01f);
+    intensity.SetQuantization(0.0f, 16.0f, 0.001f);
+    color.SetQuantization(0.0f, 2.0f, 2.0f / 255.0f);
+    radius.SetQuantization(0.0f, 32.0f, 0.001f);
+  }
 };
 static NodeType* node_type{};
 
@@ -39,7 +45,11 @@ auto LightNode::InitType() -> NodeType* {
   return node_type;
 }
 
-LightNode::LightNode(Scene* scene) : Node(scene, node_type) {}
+LightNode::LightNode(Scene* scene) : Node(scene, node_type) {
+  // We only need stepping while our volume-light needs creating or
+  // destroying.
+  SetWantsStep(true);
+}
 
 auto LightNode::GetVolumeLightIntensity() -> float {
   return intensity_ * volume_intensity_scale_ * 0.02f;
@@ -59,6 +69,15 @@ void LightNode::Step() {
     volume_light_.Clear();
   }
 #endif  // BA_HEADLESS_BUILD
+  SetWantsStep(false);
+}
+
+void LightNode::SetLightsVolumes(bool val) {
+  if (val == lights_volumes_) {
+    return;
+  }
+  lights_volumes_ = val;
+  SetWantsStep(true);
 }
 
 void LightNode::SetRadius(float val) {
@@ -30,7 +30,7 @@ class LightNode : public Node {
   auto radius() const -> float { return radius_; }
   void SetRadius(float val);
   auto lights_volumes() const -> bool { return lights_volumes_; }
-  void set_lights_volumes(bool val) { lights_volumes_ = val; }
+  void SetLightsVolumes(bool val);
   auto height_attenuated() const -> bool { return height_attenuated_; }
   void set_height_attenuated(bool val) { height_attenuated_ = val; }
 
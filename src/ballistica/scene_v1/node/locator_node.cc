@@ -32,7 +32,13 @@ class LocatorNodeType : public NodeType {
         draw_beauty(this),
         drawShadow(this),
         shape(this),
-        additive(this) {}
+        additive(this) {
+    // Wire precision for float attrs (see SetQuantization()).
+    position.SetQuantization(-256.0f, 256.0f, 0.01f);
+    size.SetQuantization(0.0f, 32.0f, 0.001f);
+    color.SetQuantization(0.0f, 2.0f, 2.0f / 255.0f);
+    opacity.SetQuantization(0.0f, 1.0f, 1.0f / 255.0f);
+  }
 };
 static NodeType* node_type{};
 
@@ -38,6 +38,10 @@ void Node::AddToScene(Scene* scene) {
 }
 
 Node::~Node() {
+  if (step_slot_ != -1) {
+    scene_->UnscheduleNodeStep(this);
+  }
+
   // Kill any incoming/outgoing attr connections.
   for (auto& i : attribute_connections_incoming_) {
     NodeAttributeConnection* a = i.second.Get();
@@ -78,6 +82,26 @@ Node::~Node() {
   }
 }
 
+void Node::SetWantsStep(bool val) {
+  if (val == wants_step_) {
+    return;
+  }
+  wants_step_ = val;
+  UpdateStepScheduling();
+}
+
+void Node::UpdateStepScheduling() {
+  // Note that nodes that simply lose their last connection don't come
+  // through here; the scene drops them after their next step.
+  bool scheduled = step_slot_ != -1;
+  bool needs_step = wants_step_ || !attribute_connections_.empty();
+  if (needs_step && !scheduled) {
+    scene_->ScheduleNodeStep(this);
+  } else if (!needs_step && scheduled) {
+    scene_->UnscheduleNodeStep(this);
+  }
+}
+
 auto Node::GetResyncDataSize() -> int { return 0; }
 auto Node::GetResyncData() -> std::vector<uint8_t> { return {}; }
 
@@ -178,6 +202,9 @@ void Node::ConnectAttribute(NodeAttributeUnbound* src_attr, Node* dst_node,
   a->dst_node = dst_node;
   a->dst_attr_index = dst_attr->index();
   a->Update();
+
+  // We need stepping now to keep the connection updated.
+  UpdateStepScheduling();
 }
 
 void Node::UpdateConnections() {
@@ -32,9 +32,22 @@ class Node : public Object {
   /// Return the node's id in its scene.
   auto id() const -> int64_t { return id_; }
 
-  /// Called for each step of the sim.
+  /// Called for each step of the sim (only while scheduled; see
+  /// SetWantsStep()).
   virtual void Step() {}
 
+  /// Nodes only get stepped while they want to be (or while they have
+  /// outgoing attribute connections to pump). Node types with per-step
+  /// work should turn this on when created, and can turn it back off
+  /// while they have nothing to do.
+  void SetWantsStep(bool val);
+  auto wants_step() const -> bool { return wants_step_; }
+
+  /// Our position in our scene's step schedule (-1 if not scheduled).
+  /// Managed by the scene.
+  auto step_slot() const -> int { return step_slot_; }
+  void set_step_slot(int val) { step_slot_ = val; }
+
   /// Called when screen size changes.
   virtual void OnScreenSizeChange() {}
 
@@ -200,7 +213,11 @@ class Node : public Object {
   virtual void HandleMessage(const char* buffer);
 
  private:
+  void UpdateStepScheduling();
+
   int64_t stream_id_{-1};
+  int step_slot_{-1};
+  bool wants_step_{};
   NodeType* node_type_ = nullptr;
 
   PyObject* py_ref_ = nullptr;
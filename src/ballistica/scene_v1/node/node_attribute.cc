@@ -2,6 +2,9 @@
 
 #include "ballistica/scene_v1/node/node_attribute.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "ballistica/scene_v1/node/node.h"
 #include "ballistica/scene_v1/node/node_attribute_connection.h"
 #include "ballistica/scene_v1/node/node_type.h"
@@ -67,6 +70,44 @@ NodeAttributeUnbound::NodeAttributeUnbound(NodeType* node_type,
   node_type->attributes_by_index_.push_back(this);
 }
 
+void NodeAttributeUnbound::SetQuantization(float min_value, float max_value,
+                                           float precision) {
+  BA_PRECONDITION(type_ == NodeAttributeType::kFloat
+                  || type_ == NodeAttributeType::kFloatArray);
+  BA_PRECONDITION(max_value > min_value && precision > 0.0f);
+  // (Small fudge so float error doesn't bump us up a step).
+  auto steps = static_cast<int64_t>(
+      std::ceil((max_value - min_value) / precision - 0.001f));
+  BA_PRECONDITION(steps <= 65535);
+  quantize_steps_ = static_cast<int>(steps);
+  quantized_size_ = steps <= 255 ? 1 : 2;
+  quantize_min_ = min_value;
+  quantize_max_ = max_value;
+}
+
+auto NodeAttributeUnbound::QuantizeFloat(float value, uint16_t* out) const
+    -> bool {
+  assert(quantized_size_ != 0);
+
+  // Note: written so that NaNs fail too.
+  if (!(value >= quantize_min_ && value <= quantize_max_)) {
+    return false;
+  }
+  *out = static_cast<uint16_t>(
+      std::lround((value - quantize_min_) / (quantize_max_ - quantize_min_)
+                  * static_cast<float>(quantize_steps_)));
+  return true;
+}
+
+auto NodeAttributeUnbound::DequantizeFloat(uint16_t value) const -> float {
+  assert(quantized_size_ != 0);
+  return quantize_min_
+         + (quantize_max_ - quantize_min_)
+               * (static_cast<float>(std::min(static_cast<int>(value),
+                                              quantize_steps_))
+                  / static_cast<float>(quantize_steps_));
+}
+
 void NodeAttributeUnbound::NotReadableError(Node* node) {
   throw Exception("Attribute '" + name() + "' on " + node->type()->name()
                   + " node is not readable");
@@ -97,6 +97,19 @@ class NodeAttributeUnbound {
   auto index() const -> int { return index_; }
   void DisconnectIncoming(Node* node);
 
+  // Declare the range and precision a float or float-array attr's values
+  // need when sent to clients. Session streams then send in-range values
+  // in 1 or 2 bytes instead of 4. Clients decode using their own copy of
+  // this, so changing it requires a protocol version bump.
+  void SetQuantization(float min_value, float max_value, float precision);
+
+  // Bytes per quantized value, or 0 if this attr is not quantized.
+  auto quantized_size() const -> int { return quantized_size_; }
+
+  // Returns false if the value falls outside of our range.
+  auto QuantizeFloat(float value, uint16_t* out) const -> bool;
+  auto DequantizeFloat(uint16_t value) const -> float;
+
  protected:
   void NotReadableError(Node* node);
   void NotWritableError(Node* node);
@@ -107,6 +120,10 @@ class NodeAttributeUnbound {
   std::string name_;
   uint32_t flags_;
   int index_;
+  int quantized_size_{};
+  int quantize_steps_{};
+  float quantize_min_{};
+  float quantize_max_{};
 };
 
 // Simple node-attribute pair; used as a convenience measure.
@@ -34,7 +34,9 @@ auto PropNode::InitType() -> NodeType* {
 
 PropNode::PropNode(Scene* scene, NodeType* override_node_type)
     : Node(scene, override_node_type ? override_node_type : node_type),
-      part_(this) {}
+      part_(this) {
+  SetWantsStep(true);
+}
 
 PropNode::~PropNode() {
   if (area_of_interest_) {
@@ -35,7 +35,10 @@ auto RegionNode::InitType() -> NodeType* {
 }
 
 RegionNode::RegionNode(Scene* scene)
-    : Node(scene, node_type), part_(this, false) {}
+    : Node(scene, node_type), part_(this, false) {
+  // We only need stepping while our body needs creating or updating.
+  SetWantsStep(true);
+}
 
 void RegionNode::Draw(base::FrameDef* frame_def) {
   if (g_base->graphics_server->renderer()->debug_draw_mode()) {
@@ -52,6 +55,7 @@ void RegionNode::SetRegionType(const std::string& val) {
   }
   region_type_ = val;
   body_.Clear();  // will be recreated next step
+  SetWantsStep(true);
 }
 
 auto RegionNode::GetMaterials() const -> std::vector<Material*> {
@@ -69,6 +73,7 @@ void RegionNode::SetPosition(const std::vector<float>& vals) {
   }
   position_ = vals;
   size_or_pos_dirty_ = true;
+  SetWantsStep(true);
 }
 
 void RegionNode::SetScale(const std::vector<float>& vals) {
@@ -78,6 +83,7 @@ void RegionNode::SetScale(const std::vector<float>& vals) {
   }
   scale_ = vals;
   size_or_pos_dirty_ = true;
+  SetWantsStep(true);
 }
 
 void RegionNode::Step() {
@@ -103,6 +109,7 @@ void RegionNode::Step() {
     body_->SetDimensions(scale_[0], scale_[1], scale_[2]);
     size_or_pos_dirty_ = false;
   }
+  SetWantsStep(false);
 }
 
 }  // namespace ballistica::scene_v1
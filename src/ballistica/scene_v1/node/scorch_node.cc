@@ -26,7 +26,13 @@ class ScorchNodeType : public NodeType {
         presence(this),
         size(this),
         big(this),
-        color(this) {}
+        color(this) {
+    // Wire precision for float attrs (see SetQuantization()).
+    position.SetQuantization(-256.0f, 256.0f, 0.01f);
+    presence.SetQuantization(0.0f, 1.0f, 1.0f / 255.0f);
+    size.SetQuantization(0.0f, 32.0f, 0.001f);
+    color.SetQuantization(0.0f, 2.0f, 2.0f / 255.0f);
+  }
 };
 
 static NodeType* node_type{};
@@ -33,7 +33,13 @@ class ShieldNodeType : public NodeType {
         radius(this),
         hurt(this),
         color(this),
-        always_show_health_bar(this) {}
+        always_show_health_bar(this) {
+    // Wire precision for float attrs (see SetQuantization()).
+    position.SetQuantization(-256.0f, 256.0f, 0.01f);
+    radius.SetQuantization(0.0f, 16.0f, 0.001f);
+    hurt.SetQuantization(0.0f, 1.0f, 1.0f / 255.0f);
+    color.SetQuantization(0.0f, 2.0f, 2.0f / 255.0f);
+  }
 };
 static NodeType* node_type{};
 
@@ -50,6 +56,7 @@ ShieldNode::ShieldNode(Scene* scene)
 #endif  // !BA_HEADLESS_BUILD
 {
   last_hurt_change_time_ = scene->time();
+  SetWantsStep(true);
 }
 
 ShieldNode::~ShieldNode() = default;
@@ -37,7 +37,9 @@ auto SoundNode::InitType() -> NodeType* {
   return node_type;
 }
 
-SoundNode::SoundNode(Scene* scene) : Node(scene, node_type) {}
+SoundNode::SoundNode(Scene* scene) : Node(scene, node_type) {
+  SetWantsStep(true);
+}
 
 SoundNode::~SoundNode() {
   if (playing_) {
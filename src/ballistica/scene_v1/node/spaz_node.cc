@@ -605,6 +605,8 @@ SpazNode::SpazNode(Scene* scene)
       roller_part_(this, true),
       limbs_part_upper_(this, true),
       limbs_part_lower_(this, true) {
+  SetWantsStep(true);
+
   // Head
   body_head_ =
       Object::New<RigidBody>(kHeadBodyID, &spaz_part_, RigidBody::Type::kBody,
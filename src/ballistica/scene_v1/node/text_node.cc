@@ -72,7 +72,16 @@ class TextNodeType : public NodeType {
         host_only(this),
         vr_depth(this),
         rotate(this),
-        front(this) {}
+        front(this) {
+    // Wire precision for float attrs (see SetQuantization()).
+    opacity.SetQuantization(0.0f, 1.0f, 1.0f / 255.0f);
+    trail_opacity.SetQuantization(0.0f, 1.0f, 1.0f / 255.0f);
+    scale.SetQuantization(0.0f, 16.0f, 0.001f);
+    position.SetQuantization(-1600.0f, 1600.0f, 0.05f);
+    color.SetQuantization(0.0f, 2.0f, 2.0f / 255.0f);
+    trailcolor.SetQuantization(0.0f, 2.0f, 2.0f / 255.0f);
+    rotate.SetQuantization(-720.0f, 720.0f, 0.05f);
+  }
 };
 static NodeType* node_type{};
 
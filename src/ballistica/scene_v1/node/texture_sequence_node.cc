@@ -31,7 +31,9 @@ auto TextureSequenceNode::InitType() -> NodeType* {
 }
 
 TextureSequenceNode::TextureSequenceNode(Scene* scene)
-    : Node(scene, node_type), index_(0), rate_(1000), sleep_count_(0) {}
+    : Node(scene, node_type), index_(0), rate_(1000), sleep_count_(0) {
+  SetWantsStep(true);
+}
 
 auto TextureSequenceNode::input_textures() const -> std::vector<SceneTexture*> {
   return RefsToPointers(input_textures_);
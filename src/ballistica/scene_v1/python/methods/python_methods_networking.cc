@@ -5,6 +5,7 @@
 #include "ballistica/base/assets/assets.h"
 #include "ballistica/base/networking/network_reader.h"
 #include "ballistica/base/python/base_python.h"
+#include "ballistica/base/support/huffman.h"
 #include "ballistica/core/python/core_python.h"
 #include "ballistica/scene_v1/connection/connection_set.h"
 #include "ballistica/scene_v1/connection/connection_to_client.h"
@@ -886,6 +887,58 @@ static PyMethodDef PyGetChatMessagesDef = {
     "(internal)",
 };
 
+// --------------------------- get_huffman_stats -------------------------------
+
+static auto PyGetHuffmanStats(PyObject* self, PyObject* args,
+                              PyObject* keywds) -> PyObject* {
+  BA_PYTHON_TRY;
+  BA_PRECONDITION(g_base->InLogicThread());
+  static const char* kwlist[] = {nullptr};
+  if (!PyArg_ParseTupleAndKeywords(args, keywds, "",
+                                   const_cast<char**>(kwlist))) {
+    return nullptr;
+  }
+  auto* huffman = g_base->huffman;
+  PythonRef dict(PyDict_New(), PythonRef::kSteal);
+  for (int i = 0; i < static_cast<int>(base::HuffmanChannel::kLast); ++i) {
+    auto channel = static_cast<base::HuffmanChannel>(i);
+    auto raw_bytes = huffman->GetChannelRawBytes(channel);
+    auto compressed_bytes = huffman->GetChannelCompressedBytes(channel);
+    auto* table = huffman->GetChannelTable(channel);
+    uint32_t version = table ? table->version()
+                                      : huffman->generic_table()->version();
+    PythonRef entry(
+        Py_BuildValue(
+            "{sLsLsdsk}", "raw_bytes",
+            static_cast<long long>(raw_bytes),  // NOLINT
+            "compressed_bytes",
+            static_cast<long long>(compressed_bytes),  // NOLINT
+            "ratio",
+            raw_bytes > 0 ? static_cast<double>(compressed_bytes)
+                                / static_cast<double>(raw_bytes)
+                          : 1.0,
+            "version", static_cast<unsigned long>(version)),  // NOLINT
+        PythonRef::kSteal);
+    PyDict_SetItemString(dict.Get(), base::Huffman::ChannelName(channel),
+                         entry.Get());
+  }
+  return dict.NewRef();
+  BA_PYTHON_CATCH;
+}
+
+static PyMethodDef PyGetHuffmanStatsDef = {
+    "get_huffman_stats",             // name
+    (PyCFunction)PyGetHuffmanStats,  // method
+    METH_VARARGS | METH_KEYWORDS,    // flags
+
+    "get_huffman_stats() -> dict[str, dict[str, Any]]\n"
+    "\n"
+    "(internal)\n"
+    "\n"
+    "Return per-channel bytes sent before and after huffman compression\n"
+    "along with the version of each channel's table.",
+};
+
 // -----------------------------------------------------------------------------
 
 auto PythonMethodsNetworking::GetMethods() -> std::vector<PyMethodDef> {
@@ -916,6 +969,7 @@ auto PythonMethodsNetworking::GetMethods() -> std::vector<PyMethodDef> {
       PyGetPublicPartyEnabledDef,
       PyChatMessageDef,
       PyGetChatMessagesDef,
+      PyGetHuffmanStatsDef,
   };
 }
 
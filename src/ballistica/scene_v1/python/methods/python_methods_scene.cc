@@ -259,6 +259,134 @@ static PyMethodDef PyBaseTimerDef = {
     "...                       'hello from the future 2!'))\n",
 };
 
+// ------------------------------ get_timer_stats ------------------------------
+
+static auto TimerListStats(TimerList* timers) -> PyObject* {
+  return Py_BuildValue(
+      "{sisisisLsLsL}", "active", timers->ActiveTimerCount(), "inactive",
+      timers->InactiveTimerCount(), "total", timers->TotalTimerCount(),
+      "fire_count", static_cast<long long>(timers->fire_count()),  // NOLINT
+      "fire_time_total_us",
+      static_cast<long long>(timers->fire_time_total()),  // NOLINT
+      "fire_time_max_us",
+      static_cast<long long>(timers->fire_time_max()));  // NOLINT
+}
+
+static auto PyGetTimerStats(PyObject* self, PyObject* args,
+                            PyObject* keywds) -> PyObject* {
+  BA_PYTHON_TRY;
+  BA_PRECONDITION(g_base->InLogicThread());
+  static const char* kwlist[] = {nullptr};
+  if (!PyArg_ParseTupleAndKeywords(args, keywds, "",
+                                   const_cast<char**>(kwlist))) {
+    return nullptr;
+  }
+  auto context{ContextRefSceneV1::FromCurrent()};
+  TimerList* sim_timers{};
+  TimerList* base_timers{};
+  if (HostActivity* activity = context.GetHostActivity()) {
+    sim_timers = activity->scene_timers();
+    base_timers = activity->base_timers();
+  } else if (HostSession* session = context.GetHostSession()) {
+    sim_timers = session->sim_timers();
+    base_timers = session->base_timers();
+  } else {
+    throw Exception(PyExcType::kContext);
+  }
+  PythonRef sim_stats(TimerListStats(sim_timers), PythonRef::kSteal);
+  PythonRef base_stats(TimerListStats(base_timers), PythonRef::kSteal);
+  return Py_BuildValue("{sOsO}", "sim", sim_stats.Get(), "base",
+                       base_stats.Get());
+  BA_PYTHON_CATCH;
+}
+
+static PyMethodDef PyGetTimerStatsDef = {
+    "get_timer_stats",             // name
+    (PyCFunction)PyGetTimerStats,  // method
+    METH_VARARGS | METH_KEYWORDS,  // flags
+
+    "get_timer_stats() -> dict[str, dict[str, int]]\n"
+    "\n"
+    "(internal)\n"
+    "\n"
+    "Return timer counts and firing-time stats for the current context.\n"
+    "\n"
+    "Stats are returned separately for the 'sim' and 'base' timelines of\n"
+    "the current Activity (or Session if there is no current Activity).\n"
+    "Base-timeline stats for a Session include time spent in the timers\n"
+    "of its Activities.",
+};
+
+// --------------------------- get_dynamics_stats ------------------------------
+
+static auto PyGetDynamicsStats(PyObject* self, PyObject* args,
+                               PyObject* keywds) -> PyObject* {
+  BA_PYTHON_TRY;
+  BA_PRECONDITION(g_base->InLogicThread());
+  static const char* kwlist[] = {nullptr};
+  if (!PyArg_ParseTupleAndKeywords(args, keywds, "",
+                                   const_cast<char**>(kwlist))) {
+    return nullptr;
+  }
+  HostActivity* host_activity =
+      ContextRefSceneV1::FromCurrent().GetHostActivity();
+  if (!host_activity) {
+    throw Exception(PyExcType::kContext);
+  }
+  Dynamics* dynamics = host_activity->scene()->dynamics();
+  assert(dynamics);
+  const dQuickStepStats& stats{dynamics->solver_stats()};
+  const Dynamics::CollisionSoundStats& sound_stats{
+      dynamics->collision_sound_stats()};
+  return Py_BuildValue(
+      "{sisisisisisdsLsLsLsLsLsLsLsLsLsL}", "islands", stats.islands,
+      "rows", stats.rows, "warm_started_rows", stats.warm_started_rows,
+      "iterations", stats.iterations_total, "iterations_max",
+      stats.iterations_max, "residual_max",
+      static_cast<double>(stats.residual_max), "steps_total",
+      static_cast<long long>(dynamics->solver_step_count()),  // NOLINT
+      "iterations_total",
+      static_cast<long long>(dynamics->solver_iterations_total()),  // NOLINT
+      "rows_total",
+      static_cast<long long>(dynamics->solver_rows_total()),  // NOLINT
+      "warm_started_rows_total",
+      static_cast<long long>(  // NOLINT
+          dynamics->solver_warm_started_rows_total()),
+      "impact_sound_events_total",
+      static_cast<long long>(sound_stats.impact_events),  // NOLINT
+      "impact_sounds_total",
+      static_cast<long long>(sound_stats.impact_sounds),  // NOLINT
+      "skid_sound_events_total",
+      static_cast<long long>(sound_stats.skid_events),  // NOLINT
+      "skid_sounds_total",
+      static_cast<long long>(sound_stats.skid_sounds),  // NOLINT
+      "roll_sound_events_total",
+      static_cast<long long>(sound_stats.roll_events),  // NOLINT
+      "roll_sounds_total",
+      static_cast<long long>(sound_stats.roll_sounds));  // NOLINT
+  BA_PYTHON_CATCH;
+}
+
+static PyMethodDef PyGetDynamicsStatsDef = {
+    "get_dynamics_stats",             // name
+    (PyCFunction)PyGetDynamicsStats,  // method
+    METH_VARARGS | METH_KEYWORDS,     // flags
+
+    "get_dynamics_stats() -> dict[str, Any]\n"
+    "\n"
+    "(internal)\n"
+    "\n"
+    "Return physics solver stats for the current Activity.\n"
+    "\n"
+    "Values without a '_total' suffix describe the most recent step:\n"
+    "islands solved, constraint rows, rows warm-started from the previous\n"
+    "step, iterations (summed over islands and the most used by any\n"
+    "island) and the worst final residual. Totals accumulate over the\n"
+    "Activity's lifetime; these include collision sound events generated\n"
+    "by contacts and the sounds actually played after merging events\n"
+    "that land close together in the same step.",
+};
+
 // ------------------------------- getsession ----------------------------------
 
 static auto PyGetSession(PyObject* self, PyObject* args,
@@ -1601,6 +1729,68 @@ static PyMethodDef PySeekReplayDef = {
     "Rewind or fast-forward replay.",
 };
 
+// ------------------------ get_replay_seek_stats ------------------------------
+
+static auto PyGetReplaySeekStats(PyObject* self) -> PyObject* {
+  BA_PYTHON_TRY;
+  auto* appmode = SceneV1AppMode::GetActiveOrThrow();
+  auto* session =
+      dynamic_cast<ClientSessionReplay*>(appmode->GetForegroundSession());
+  if (session == nullptr) {
+    Py_RETURN_NONE;
+  }
+  return Py_BuildValue(
+      "{sisLsLsL}", "states", static_cast<int>(session->seek_state_count()),
+      "bytes", static_cast<long long>(session->seek_state_bytes()),
+      "budget_bytes", static_cast<long long>(session->seek_state_budget()),
+      "thinned", static_cast<long long>(session->seek_states_thinned()));
+  BA_PYTHON_CATCH;
+}
+
+static PyMethodDef PyGetReplaySeekStatsDef = {
+    "get_replay_seek_stats",            // name
+    (PyCFunction)PyGetReplaySeekStats,  // method
+    METH_NOARGS,                        // flags
+
+    "get_replay_seek_stats() -> dict[str, int] | None\n"
+    "\n"
+    "(internal)\n"
+    "\n"
+    "Return how many seek states the current replay holds, the memory\n"
+    "they use against their budget, and how many have been thinned out.\n"
+    "Returns None when no replay is running.",
+};
+
+// ------------------------- get_scene_step_stats ------------------------------
+
+static auto PyGetSceneStepStats(PyObject* self) -> PyObject* {
+  BA_PYTHON_TRY;
+  auto* appmode = SceneV1AppMode::GetActiveOrThrow();
+  Scene* scene = appmode->GetForegroundScene();
+  if (scene == nullptr) {
+    Py_RETURN_NONE;
+  }
+  return Py_BuildValue("{sisi}", "stepped",
+                       scene->last_step_stepped_node_count(), "skipped",
+                       scene->last_step_skipped_node_count());
+  BA_PYTHON_CATCH;
+}
+
+static PyMethodDef PyGetSceneStepStatsDef = {
+    "get_scene_step_stats",            // name
+    (PyCFunction)PyGetSceneStepStats,  // method
+    METH_NOARGS,                       // flags
+
+    "get_scene_step_stats() -> dict[str, int] | None\n"
+    "\n"
+    "(internal)\n"
+    "\n"
+    "Return how many nodes in the foreground scene were stepped in its\n"
+    "last step and how many of the nodes existing at the start of it\n"
+    "were skipped for having nothing to do.\n"
+    "Returns None if there is no foreground scene.",
+};
+
 // ----------------------- reset_random_player_names ---------------------------
 
 static auto PyResetRandomPlayerNames(PyObject* self, PyObject* args,
@@ -1881,6 +2071,8 @@ auto PythonMethodsScene::GetMethods() -> std::vector<PyMethodDef> {
       PyGetReplaySpeedExponentDef,
       PyIsReplayPausedDef,
       PySeekReplayDef,
+      PyGetReplaySeekStatsDef,
+      PyGetSceneStepStatsDef,
       PyPauseReplayDef,
       PyResumeReplayDef,
       PySetDebugSpeedExponentDef,
@@ -1899,6 +2091,8 @@ auto PythonMethodsScene::GetMethods() -> std::vector<PyMethodDef> {
       PyTimerDef,
       PyBaseTimeDef,
       PyBaseTimerDef,
+      PyGetTimerStatsDef,
+      PyGetDynamicsStatsDef,
       PyLsInputDevicesDef,
       PyOnAppModeActivateDef,
       PyOnAppModeDeactivateDef,
@@ -26,6 +26,7 @@
 #include "ballistica/scene_v1/node/texture_sequence_node.h"
 #include "ballistica/scene_v1/node/time_display_node.h"
 #include "ballistica/scene_v1/python/scene_v1_python.h"
+#include "ballistica/scene_v1/support/scene_v1_native_tests.h"
 #include "ballistica/shared/generic/utils.h"
 
 namespace ballistica::scene_v1 {
@@ -64,6 +65,8 @@ void SceneV1FeatureSet::OnModuleExec(PyObject* module) {
   assert(g_base == nullptr);
   g_base = base::BaseFeatureSet::Import();
 
+  SceneV1NativeTests::AddTests();
+
   g_core->LifecycleLog("_bascenev1 exec end");
 }
 
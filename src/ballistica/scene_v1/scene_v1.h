@@ -43,7 +43,12 @@ const int kProtocolVersionHostMin = 33;
 const int kProtocolVersionClientMin = 24;
 
 // Newest protocol version we can act as a client OR host for.
-const int kProtocolVersionMax = 35;
+const int kProtocolVersionMax = 36;
+
+// Replays are written as this version unless they may contain commands
+// added after it, so builds that don't know about those can still play
+// them back.
+const int kProtocolVersionReplayBase = 35;
 
 // The protocol version we actually host is now read as a setting; see
 // kSceneV1HostProtocol in ballistica/base/support/app_config.h.
@@ -75,6 +80,9 @@ const int kProtocolVersionMax = 35;
 // 34: New image_node enums, data assets.
 //
 // 35: Camera shake in netplay. how did I apparently miss this for 10 years!?!
+//
+// 36: Quantized float node-attr commands for attrs declaring a range and
+//     precision. Replays only get written as 36 when hosting 36.
 
 // Sim step size in milliseconds.
 const int kGameStepMilliseconds = 8;
@@ -251,7 +259,9 @@ enum class SessionCommand {
   kScreenMessageTop,
   kAddData,
   kRemoveData,
-  kCameraShake
+  kCameraShake,
+  kSetNodeAttrFloatQuantized,
+  kSetNodeAttrFloatsQuantized
 };
 
 enum class NodeCollideAttr {
@@ -109,6 +109,29 @@ void ClientSession::ReadFloats(int count, float* vals) {
   current_cmd_ptr_ += size;
 }
 
+void ClientSession::ReadQuantizedFloats(const NodeAttribute& attr, int count,
+                                        float* vals) {
+  int value_size = attr.attr->quantized_size();
+  if (value_size == 0) {
+    throw Exception("got quantized values for non-quantized attr '"
+                    + attr.name() + "'");
+  }
+  int size = value_size * count;
+  if (current_cmd_ptr_ > &(current_cmd_[0]) + current_cmd_.size() - size) {
+    throw Exception("state read error");
+  }
+  for (int i = 0; i < count; ++i) {
+    uint16_t val;
+    if (value_size == 1) {
+      val = *current_cmd_ptr_;
+    } else {
+      memcpy(&val, current_cmd_ptr_, sizeof(val));
+    }
+    current_cmd_ptr_ += value_size;
+    vals[i] = attr.attr->DequantizeFloat(val);
+  }
+}
+
 void ClientSession::ReadInt32s(int count, int32_t* vals) {
   int size = 4 * count;
   if (current_cmd_ptr_ > &(current_cmd_[0]) + current_cmd_.size() - size) {
@@ -556,6 +579,29 @@ void ClientSession::Update(int time_advance_millisecs, double time_advance) {
           GetNode(vals[0])->GetAttribute(vals[1]).Set(ReadFloat());
           break;
         }
+        case SessionCommand::kSetNodeAttrFloatQuantized: {
+          int vals[2];
+          ReadInt32_2(vals);
+          NodeAttribute attr = GetNode(vals[0])->GetAttribute(vals[1]);
+          float val;
+          ReadQuantizedFloats(attr, 1, &val);
+          attr.Set(val);
+          break;
+        }
+        case SessionCommand::kSetNodeAttrFloatsQuantized: {
+          int cmdvals[3];
+          ReadInt32_3(cmdvals);
+          int count = cmdvals[2];
+          if (count < 1 || count > 1000) {
+            throw Exception("invalid array size (" + std::to_string(count)
+                            + ")");
+          }
+          NodeAttribute attr = GetNode(cmdvals[0])->GetAttribute(cmdvals[1]);
+          std::vector<float> vals(static_cast<size_t>(count));
+          ReadQuantizedFloats(attr, count, &(vals[0]));
+          attr.Set(vals);
+          break;
+        }
         case SessionCommand::kSetNodeAttrInt32: {
           int32_t vals[3];
           ReadInt32_3(vals);
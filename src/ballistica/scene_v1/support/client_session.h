@@ -114,6 +114,7 @@ class ClientSession : public Session {
   auto ReadString() -> std::string;
   auto ReadFloat() -> float;
   void ReadFloats(int count, float* vals);
+  void ReadQuantizedFloats(const NodeAttribute& attr, int count, float* vals);
   void ReadInt32s(int count, int32_t* vals);
   void ReadChars(int count, char* vals);
 
@@ -6,6 +6,7 @@
 #include "ballistica/base/graphics/graphics.h"
 #include "ballistica/base/graphics/support/net_graph.h"
 #include "ballistica/base/logic/logic.h"
+#include "ballistica/scene_v1/connection/connection_set.h"
 #include "ballistica/scene_v1/connection/connection_to_host.h"
 #include "ballistica/scene_v1/support/scene_v1_app_mode.h"
 
@@ -20,8 +21,15 @@ ClientSessionNet::ClientSessionNet() {
   }
   assert(g_base->assets_server);
 
-  // We always write replays as the highest protocol version we support.
-  g_base->assets_server->PushBeginWriteReplayCall(kProtocolVersionMax);
+  // We record exactly what our host sends, so our replay only needs the
+  // newest protocol version we support if the host is using it (see
+  // SessionStream).
+  auto* connection =
+      SceneV1AppMode::GetSingleton()->connections()->connection_to_host();
+  g_base->assets_server->PushBeginWriteReplayCall(
+      connection && connection->protocol_version() >= 36
+          ? kProtocolVersionMax
+          : kProtocolVersionReplayBase);
   writing_replay_ = true;
   g_scene_v1->replay_open = true;
 }
@@ -3,6 +3,11 @@
 #include "ballistica/scene_v1/support/client_session_replay.h"
 
 #include <algorithm>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "ballistica/base/assets/assets.h"
 #include "ballistica/base/networking/networking.h"
@@ -18,6 +23,158 @@ namespace ballistica::scene_v1 {
 
 static const millisecs_t kReplayStateDumpIntervalMillisecs = 500;
 
+// Every this many seek states we store a full one (a keyframe); the rest
+// are stored as deltas against the keyframe before them.
+static const int kReplayStateKeyframeInterval = 16;
+
+// How much memory seek states can use before we start thinning out older
+// ones (can be overridden with BA_REPLAY_SEEK_STATE_BUDGET_MB).
+static const size_t kReplayStateDefaultBudgetMB = 64;
+
+// Granularity we match delta-encoded states against keyframes at.
+static const size_t kReplayStateDeltaBlockSize = 16;
+
+// First byte of an encoded seek state.
+static const uint8_t kReplayStateKeyframe = 0;
+static const uint8_t kReplayStateDelta = 1;
+
+static void WriteVarUInt(std::vector<uint8_t>* out, uint64_t val) {
+  while (val >= 0x80) {
+    out->push_back(static_cast<uint8_t>(val | 0x80));
+    val >>= 7;
+  }
+  out->push_back(static_cast<uint8_t>(val));
+}
+
+static auto ReadVarUInt(const std::vector<uint8_t>& src, size_t* pos)
+    -> uint64_t {
+  uint64_t val{};
+  for (int shift = 0; shift < 64; shift += 7) {
+    BA_PRECONDITION(*pos < src.size());
+    uint8_t byte = src[(*pos)++];
+    val |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) {
+      return val;
+    }
+  }
+  throw Exception("Invalid replay seek state.");
+}
+
+static void WriteBytes(std::vector<uint8_t>* out,
+                       const std::vector<uint8_t>& bytes) {
+  WriteVarUInt(out, bytes.size());
+  out->insert(out->end(), bytes.begin(), bytes.end());
+}
+
+static auto ReadBytes(const std::vector<uint8_t>& src, size_t* pos)
+    -> std::vector<uint8_t> {
+  auto size = ReadVarUInt(src, pos);
+  BA_PRECONDITION(size <= src.size() - *pos);
+  std::vector<uint8_t> out(src.begin() + static_cast<ptrdiff_t>(*pos),
+                           src.begin() + static_cast<ptrdiff_t>(*pos + size));
+  *pos += size;
+  return out;
+}
+
+// Encode target as a series of literal runs and copies out of ref.
+// Successive full-state dumps are mostly identical, just shuffled
+// around a bit as nodes come and go, so this tends to shrink them a lot.
+auto ClientSessionReplay::EncodeStateDelta(const std::vector<uint8_t>& ref,
+                                           const std::vector<uint8_t>& target)
+    -> std::vector<uint8_t> {
+  const size_t block_size{kReplayStateDeltaBlockSize};
+  auto hash_block = [block_size](const uint8_t* data) {
+    uint32_t hash{2166136261u};
+    for (size_t i = 0; i < block_size; ++i) {
+      hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+  };
+  std::unordered_map<uint32_t, size_t> blocks;
+  blocks.reserve(ref.size() / block_size);
+  for (size_t i = 0; i + block_size <= ref.size(); i += block_size) {
+    blocks.emplace(hash_block(&ref[i]), i);
+  }
+
+  std::vector<uint8_t> out;
+  out.push_back(kReplayStateDelta);
+  WriteVarUInt(&out, target.size());
+  size_t literal_start{};
+  size_t pos{};
+  size_t next_ref{};
+  while (pos + block_size <= target.size()) {
+    // Unchanged data usually picks up right where our last copy left
+    // off, so check there before going to our block table.
+    size_t match{};
+    bool matched{};
+    if (next_ref + block_size <= ref.size()
+        && !memcmp(&ref[next_ref], &target[pos], block_size)) {
+      match = next_ref;
+      matched = true;
+    } else {
+      auto i = blocks.find(hash_block(&target[pos]));
+      if (i != blocks.end()
+          && !memcmp(&ref[i->second], &target[pos], block_size)) {
+        match = i->second;
+        matched = true;
+      }
+    }
+    if (!matched) {
+      pos++;
+      continue;
+    }
+    size_t length{block_size};
+    while (pos + length < target.size() && match + length < ref.size()
+           && target[pos + length] == ref[match + length]) {
+      length++;
+    }
+    WriteVarUInt(&out, pos - literal_start);
+    out.insert(out.end(),
+               target.begin() + static_cast<ptrdiff_t>(literal_start),
+               target.begin() + static_cast<ptrdiff_t>(pos));
+    WriteVarUInt(&out, length);
+    WriteVarUInt(&out, match);
+    pos += length;
+    literal_start = pos;
+    next_ref = match + length;
+  }
+
+  // Whatever is left goes out as literals followed by a zero-length copy.
+  WriteVarUInt(&out, target.size() - literal_start);
+  out.insert(out.end(), target.begin() + static_cast<ptrdiff_t>(literal_start),
+             target.end());
+  WriteVarUInt(&out, 0);
+  return out;
+}
+
+auto ClientSessionReplay::DecodeStateDelta(const std::vector<uint8_t>& ref,
+                                           const std::vector<uint8_t>& delta)
+    -> std::vector<uint8_t> {
+  BA_PRECONDITION(!delta.empty() && delta[0] == kReplayStateDelta);
+  size_t pos{1};
+  auto size = ReadVarUInt(delta, &pos);
+  std::vector<uint8_t> out;
+  out.reserve(size);
+  while (true) {
+    auto literal_length = ReadVarUInt(delta, &pos);
+    BA_PRECONDITION(literal_length <= delta.size() - pos);
+    out.insert(out.end(), delta.begin() + static_cast<ptrdiff_t>(pos),
+               delta.begin() + static_cast<ptrdiff_t>(pos + literal_length));
+    pos += literal_length;
+    auto copy_length = ReadVarUInt(delta, &pos);
+    if (copy_length == 0) {
+      break;
+    }
+    auto copy_offset = ReadVarUInt(delta, &pos);
+    BA_PRECONDITION(copy_offset <= ref.size()
+                    && copy_length <= ref.size() - copy_offset);
+    out.insert(out.end(), ref.begin() + static_cast<ptrdiff_t>(copy_offset),
+               ref.begin() + static_cast<ptrdiff_t>(copy_offset + copy_length));
+  }
+  BA_PRECONDITION(out.size() == size);
+  return out;
+}
+
 auto ClientSessionReplay::GetActualTimeAdvanceMillisecs(
     double base_advance_millisecs) -> double {
   if (is_fast_forwarding_) {
@@ -40,6 +197,12 @@ ClientSessionReplay::ClientSessionReplay(std::string filename)
     : file_name_(std::move(filename)) {
   auto* appmode = SceneV1AppMode::GetActiveOrThrow();
 
+  size_t budget_mb{kReplayStateDefaultBudgetMB};
+  if (auto env = g_core->platform->GetEnv("BA_REPLAY_SEEK_STATE_BUDGET_MB")) {
+    budget_mb = static_cast<size_t>(std::max(1, atoi(env->c_str())));
+  }
+  states_budget_ = budget_mb * 1024 * 1024;
+
   // take responsibility for feeding all clients to this device..
   appmode->connections()->RegisterClientController(this);
 
@@ -161,7 +324,7 @@ void ClientSessionReplay::FetchMessages() {
       fflush(file_);
       current_state_.file_position_ = ftell(file_);
       current_state_.message_ = out.GetOutMessage();
-      states_.push_back(current_state_);
+      StoreCurrentState();
     }
 
     std::vector<uint8_t> buffer;
@@ -303,24 +466,24 @@ void ClientSessionReplay::SeekTo(millisecs_t to_base_time) {
   if (to_base_time < base_time()) {
     auto it = std::lower_bound(
         states_.rbegin(), states_.rend(), to_base_time,
-        [&](const IntermediateState& state, millisecs_t time) -> bool {
+        [&](const StoredState& state, millisecs_t time) -> bool {
           return state.base_time_ > time;
         });
     if (it == states_.rend()) {
       Reset(true);
     } else {
-      current_state_ = *it;
+      LoadCurrentState(*it);
       RestoreFromCurrentState();
     }
   } else {
     auto it = std::lower_bound(
         states_.begin(), states_.end(), to_base_time,
-        [&](const IntermediateState& state, millisecs_t time) -> bool {
+        [&](const StoredState& state, millisecs_t time) -> bool {
           return state.base_time_ < time;
         });
     if (it == states_.end()) {
       if (!states_.empty()) {
-        current_state_ = states_.back();
+        LoadCurrentState(states_.back());
         RestoreFromCurrentState();
       }
       // Let's speed up replay a bit
@@ -328,12 +491,132 @@ void ClientSessionReplay::SeekTo(millisecs_t to_base_time) {
       is_fast_forwarding_ = true;
       fast_forward_base_time_ = to_base_time;
     } else {
-      current_state_ = *it;
+      LoadCurrentState(*it);
       RestoreFromCurrentState();
     }
   }
 }
 
+void ClientSessionReplay::StoreCurrentState() {
+  std::vector<uint8_t> flattened;
+  WriteBytes(&flattened, current_state_.message_);
+  WriteVarUInt(&flattened, current_state_.correction_messages_.size());
+  for (auto&& msg : current_state_.correction_messages_) {
+    WriteBytes(&flattened, msg);
+  }
+
+  StoredState state{};
+  state.file_position_ = current_state_.file_position_;
+  state.base_time_ = current_state_.base_time_;
+  std::vector<uint8_t> encoded;
+  if (keyframe_data_.empty()
+      || states_since_keyframe_ >= kReplayStateKeyframeInterval) {
+    encoded.reserve(flattened.size() + 1);
+    encoded.push_back(kReplayStateKeyframe);
+    encoded.insert(encoded.end(), flattened.begin(), flattened.end());
+    keyframe_data_ = std::move(flattened);
+    keyframe_time_ = state.base_time_;
+    states_since_keyframe_ = 0;
+  } else {
+    encoded = EncodeStateDelta(keyframe_data_, flattened);
+    states_since_keyframe_++;
+  }
+  state.keyframe_time_ = keyframe_time_;
+  state.data_ = g_base->huffman->compress(encoded);
+  state.data_.shrink_to_fit();
+  states_bytes_ += state.data_.size();
+  states_.push_back(std::move(state));
+
+  if (states_bytes_ > states_budget_) {
+    ThinStates();
+  }
+}
+
+void ClientSessionReplay::LoadCurrentState(const StoredState& state) {
+  auto encoded = g_base->huffman->decompress(state.data_);
+  BA_PRECONDITION(!encoded.empty());
+  std::vector<uint8_t> flattened;
+  if (encoded[0] == kReplayStateKeyframe) {
+    flattened.assign(encoded.begin() + 1, encoded.end());
+  } else {
+    auto* keyframe = FindState(state.keyframe_time_);
+    BA_PRECONDITION(keyframe);
+    auto keyframe_encoded = g_base->huffman->decompress(keyframe->data_);
+    BA_PRECONDITION(!keyframe_encoded.empty()
+                    && keyframe_encoded[0] == kReplayStateKeyframe);
+    keyframe_encoded.erase(keyframe_encoded.begin());
+    flattened = DecodeStateDelta(keyframe_encoded, encoded);
+  }
+
+  size_t pos{};
+  current_state_.message_ = ReadBytes(flattened, &pos);
+  auto correction_count = ReadVarUInt(flattened, &pos);
+  current_state_.correction_messages_.clear();
+  for (uint64_t i = 0; i < correction_count; ++i) {
+    current_state_.correction_messages_.push_back(ReadBytes(flattened, &pos));
+  }
+  current_state_.file_position_ = state.file_position_;
+  current_state_.base_time_ = state.base_time_;
+}
+
+auto ClientSessionReplay::FindState(millisecs_t base_time) const
+    -> const StoredState* {
+  auto it = std::lower_bound(
+      states_.begin(), states_.end(), base_time,
+      [](const StoredState& state, millisecs_t time) -> bool {
+        return state.base_time_ < time;
+      });
+  if (it == states_.end() || it->base_time_ != base_time) {
+    return nullptr;
+  }
+  return &(*it);
+}
+
+void ClientSessionReplay::ThinStates() {
+  // We thin out the older half of our states, since seeking way back is
+  // less common and can live with coarser steps. Drop every other delta
+  // state there first, and once we're out of those, every other keyframe
+  // (along with anything encoded against it). We never touch the group
+  // we're currently encoding new states against.
+  auto thin = [this](bool keyframes) -> bool {
+    size_t thin_end = states_.size() / 2;
+    millisecs_t dropped_keyframe{-1};
+    bool drop_next{};
+    std::vector<StoredState> kept;
+    kept.reserve(states_.size());
+    for (size_t i = 0; i < states_.size(); ++i) {
+      auto& state = states_[i];
+      bool is_keyframe = state.keyframe_time_ == state.base_time_;
+      bool drop{};
+      if (!is_keyframe && state.keyframe_time_ == dropped_keyframe) {
+        drop = true;
+      } else if (i < thin_end && state.keyframe_time_ != keyframe_time_
+                 && is_keyframe == keyframes) {
+        drop = drop_next;
+        drop_next = !drop_next;
+        if (drop && is_keyframe) {
+          dropped_keyframe = state.base_time_;
+        }
+      }
+      if (drop) {
+        states_bytes_ -= state.data_.size();
+        states_thinned_++;
+      } else {
+        kept.push_back(std::move(state));
+      }
+    }
+    bool dropped_any = kept.size() != states_.size();
+    states_ = std::move(kept);
+    return dropped_any;
+  };
+
+  while (states_bytes_ > states_budget_) {
+    if (!thin(false) && !thin(true)) {
+      break;
+    }
+  }
+}
+
 void ClientSessionReplay::RestoreFromCurrentState() {
   // FIXME: calling reset here causes background music to start over
   Reset(true);
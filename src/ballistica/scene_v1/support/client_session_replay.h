@@ -31,6 +31,28 @@ class ClientSessionReplay : public ClientSession,
 
   void SeekTo(millisecs_t to_base_time);
 
+  /// Number of seek states currently held.
+  auto seek_state_count() const { return states_.size(); }
+
+  /// Total memory used by held seek states.
+  auto seek_state_bytes() const { return states_bytes_; }
+
+  /// Memory we allow seek states to use before thinning them out.
+  auto seek_state_budget() const { return states_budget_; }
+
+  /// Number of seek states dropped to stay within our budget.
+  auto seek_states_thinned() const { return states_thinned_; }
+
+  /// Encode target as a delta against ref, as we do for seek states.
+  static auto EncodeStateDelta(const std::vector<uint8_t>& ref,
+                               const std::vector<uint8_t>& target)
+      -> std::vector<uint8_t>;
+
+  /// Rebuild data encoded by EncodeStateDelta() against the same ref.
+  static auto DecodeStateDelta(const std::vector<uint8_t>& ref,
+                               const std::vector<uint8_t>& delta)
+      -> std::vector<uint8_t>;
+
  private:
   struct IntermediateState {
     // Message containing full scene state at the moment.
@@ -43,11 +65,35 @@ class ClientSessionReplay : public ClientSession,
     millisecs_t base_time_;
   };
 
+  // An IntermediateState as we hold it in memory: flattened, compressed
+  // and (unless it is a keyframe) delta-encoded against a keyframe.
+  struct StoredState {
+    std::vector<uint8_t> data_;
+    int64_t file_position_;
+    millisecs_t base_time_;
+
+    // Base time of the keyframe this state is encoded against (its own
+    // base time if it is a keyframe itself).
+    millisecs_t keyframe_time_;
+  };
+
   void RestoreFromCurrentState();
+  void StoreCurrentState();
+  void LoadCurrentState(const StoredState& state);
+  void ThinStates();
+  auto FindState(millisecs_t base_time) const -> const StoredState*;
 
   // List of passed states which we can rewind to.
-  std::vector<IntermediateState> states_;
+  std::vector<StoredState> states_;
   IntermediateState current_state_;
+  size_t states_bytes_{};
+  size_t states_budget_{};
+  int64_t states_thinned_{};
+
+  // The most recent keyframe in its flattened form, for encoding deltas.
+  std::vector<uint8_t> keyframe_data_;
+  millisecs_t keyframe_time_{};
+  int states_since_keyframe_{};
 
   bool is_fast_forwarding_{};
   millisecs_t fast_forward_base_time_{};
@@ -3,6 +3,7 @@
 #include "ballistica/scene_v1/support/host_activity.h"
 
 #include "ballistica/base/python/support/python_context_call.h"
+#include "ballistica/base/support/context_accounting.h"
 #include "ballistica/scene_v1/assets/scene_collision_mesh.h"
 #include "ballistica/scene_v1/assets/scene_data_asset.h"
 #include "ballistica/scene_v1/assets/scene_mesh.h"
@@ -34,6 +35,9 @@ HostActivity::HostActivity(HostSession* host_session) {
       out->AddScene(scene_.Get());
     }
   }
+  base_timers_.AttachToParent(host_session->base_timers(),
+                              host_session->base_time(),
+                              host_session->base_time());
 }
 
 HostActivity::~HostActivity() {
@@ -79,16 +83,12 @@ HostActivity::~HostActivity() {
     }
   }
 
-  // If the host-session is outliving us, kill all the base-timers we created
-  // in it.
-  if (auto* host_session = host_session_.Get()) {
-    for (auto timer_id : session_base_timer_ids_) {
-      host_session->DeleteTimer(TimeType::kBase, timer_id);
-    }
-  }
+  // If the host-session is outliving us, pull our base-timers out of it.
+  base_timers_.DetachFromParent();
+
   // Clear our timers and scene; this should wipe out any remaining refs to our
   // Python activity, allowing it to die.
-  // base_timers_.Clear();
+  base_timers_.Clear();
   scene_timers_.Clear();
   scene_.Clear();
 
@@ -119,6 +119,10 @@ auto HostActivity::GetSceneStream() const -> SessionStream* {
 void HostActivity::SetGlobalsNode(GlobalsNode* node) { globals_node_ = node; }
 
 void HostActivity::StepScene() {
+  // Our sim is run straight from a timer without setting our context, but
+  // it's very much work done on our behalf.
+  base::ContextAccounting::ScopedCharge charge(this);
+
   int cycle_count = 1;
   if (host_session_->benchmark_type() == base::BenchmarkType::kCPU) {
     cycle_count = 100;
@@ -177,9 +181,8 @@ void HostActivity::Start() {
   }
   // Create our step timer - gets called whenever scene should step.
   step_scene_timer_id_ =
-      host_session->NewTimer(TimeType::kBase, kGameStepMilliseconds, true,
-                             NewLambdaRunnable([this] { StepScene(); }).Get());
-  session_base_timer_ids_.push_back(step_scene_timer_id_);
+      NewBaseTimer(kGameStepMilliseconds, true,
+                   NewLambdaRunnable([this] { StepScene(); }).Get());
   UpdateStepTimerLength();
 }
 
@@ -264,14 +267,20 @@ void HostActivity::UpdateStepTimerLength() {
   if (!host_session) {
     return;
   }
+  auto* timer = base_timers_.GetTimer(step_scene_timer_id_);
+  assert(timer);
+  if (!timer) {
+    return;
+  }
+  auto now = base_timers_.LocalTime(host_session->base_time());
   if (game_speed_ == 0.0f || paused_) {
-    host_session->SetBaseTimerLength(step_scene_timer_id_, -1);
+    timer->SetLength(-1, true, now);
   } else {
-    host_session->SetBaseTimerLength(
-        step_scene_timer_id_,
+    timer->SetLength(
         std::max(1, static_cast<int>(
                         round(static_cast<float>(kGameStepMilliseconds)
-                              / (game_speed_ * appmode->debug_speed_mult())))));
+                              / (game_speed_ * appmode->debug_speed_mult())))),
+        true, now);
   }
 }
 
@@ -402,12 +411,10 @@ auto HostActivity::NewBaseTimer(millisecs_t length, bool repeat,
         "WARNING: Creating session-time timer in activity but host is dead.");
     return 123;  // dummy...
   }
-
-  int timer_id =
-      host_session->NewTimer(TimeType::kBase, length, repeat, runnable);
-
-  session_base_timer_ids_.push_back(timer_id);
-  return timer_id;
+  Timer* t = base_timers_.NewTimer(
+      base_timers_.LocalTime(host_session->base_time()), length, 0,
+      repeat ? -1 : 0, runnable);
+  return t->id();
 }
 
 void HostActivity::DeleteSimTimer(int timer_id) {
@@ -423,9 +430,7 @@ void HostActivity::DeleteBaseTimer(int timer_id) {
   if (shutting_down_) {
     return;
   }
-  if (auto* host_session = host_session_.Get()) {
-    host_session->DeleteTimer(TimeType::kBase, timer_id);
-  }
+  base_timers_.DeleteTimer(timer_id);
 }
 
 void HostActivity::StepDisplayTime(millisecs_t time_advance) {
@@ -446,40 +451,10 @@ void HostActivity::StepDisplayTime(millisecs_t time_advance) {
     PruneDeadMapRefs(&meshes_);
     PruneDeadRefs(&materials_);
     PruneDeadRefs(&context_calls_);
-    PruneSessionBaseTimers();
     next_prune_time_ = base_time_ + 5379;
   }
 }
 
-void HostActivity::PruneSessionBaseTimers() {
-  auto* host_session = host_session_.Get();
-  if (!host_session) {
-    return;
-  }
-
-  // Quick-out; if all timers still exist, do nothing. This will usually
-  // be the case.
-  bool found_dead{};
-  for (auto timer_id : session_base_timer_ids_) {
-    if (!host_session->BaseTimerExists(timer_id)) {
-      found_dead = true;
-      break;
-    }
-  }
-  if (!found_dead) {
-    return;
-  }
-
-  // Ok, something died. Rebuild the list.
-  std::vector<int> remaining_timer_ids;
-  for (auto timer_id : session_base_timer_ids_) {
-    if (host_session->BaseTimerExists(timer_id)) {
-      remaining_timer_ids.push_back(timer_id);
-    }
-  }
-  remaining_timer_ids.swap(session_base_timer_ids_);
-}
-
 void HostActivity::OnScreenSizeChange() { scene()->OnScreenSizeChange(); }
 void HostActivity::LanguageChanged() { scene()->LanguageChanged(); }
 void HostActivity::DebugSpeedMultChanged() { UpdateStepTimerLength(); }
@@ -548,6 +523,8 @@ auto HostActivity::NewTimer(TimeType timetype, TimerMedium length, bool repeat,
   // (we may not add an initial reference ourself)
   assert(Object::IsValidManagedObject(runnable));
 
+  g_base->context_accounting->AddTimer();
+
   // We currently support game and base timers.
   switch (timetype) {
     case TimeType::kSim:
@@ -70,6 +70,8 @@ class HostActivity : public SceneV1Context {
     return allow_kick_idle_players_;
   }
   auto GetSceneStream() const -> SessionStream*;
+  auto scene_timers() -> TimerList* { return &scene_timers_; }
+  auto base_timers() -> TimerList* { return &base_timers_; }
   void DumpFullState(SessionStream* out);
   void SetGlobalsNode(GlobalsNode* node);
   void SetIsForeground(bool val);
@@ -83,10 +85,6 @@ class HostActivity : public SceneV1Context {
   void DeleteBaseTimer(int timer_id);
   void UpdateStepTimerLength();
   void StepScene();
-  void PruneSessionBaseTimers();
-
-  /// Keep track of timers we've created in our session's base-timeline.
-  std::vector<int> session_base_timer_ids_;
   Object::WeakRef<GlobalsNode> globals_node_;
   bool allow_kick_idle_players_{};
   int step_scene_timer_id_{};
@@ -113,6 +111,11 @@ class HostActivity : public SceneV1Context {
   Object::WeakRef<HostSession> host_session_;
   PythonRef py_activity_weak_ref_;
   TimerList scene_timers_;
+
+  // Our timers on our session's base-timeline. These live in a group
+  // hanging off of the session's base timer list so we can tear them all
+  // down at once without disturbing the session's other timers.
+  TimerList base_timers_;
 };
 
 }  // namespace ballistica::scene_v1
@@ -5,6 +5,7 @@
 #include "ballistica/base/graphics/graphics.h"
 #include "ballistica/base/python/base_python.h"
 #include "ballistica/base/python/support/python_context_call.h"
+#include "ballistica/base/support/context_accounting.h"
 #include "ballistica/scene_v1/assets/scene_data_asset.h"
 #include "ballistica/scene_v1/assets/scene_mesh.h"
 #include "ballistica/scene_v1/assets/scene_sound.h"
@@ -471,6 +472,8 @@ void HostSession::ProcessPlayerTimeOuts() {
 }
 
 void HostSession::StepScene() {
+  base::ContextAccounting::ScopedCharge charge(this);
+
   // Run up our game-time timers.
   sim_timers_.Run(scene()->time());
 
@@ -480,6 +483,7 @@ void HostSession::StepScene() {
 
 void HostSession::Update(int time_advance_millisecs, double time_advance) {
   assert(g_base->InLogicThread());
+  base::ContextAccounting::ScopedCharge charge(this);
 
   millisecs_t update_time_start = core::CorePlatform::GetCurrentMillisecs();
 
@@ -618,7 +622,6 @@ HostSession::~HostSession() {
 
     // Clear our timers and scene; this should wipe out any remaining refs
     // to our session scene.
-    base_timers_.Clear();
     sim_timers_.Clear();
     scene_.Clear();
 
@@ -636,6 +639,11 @@ HostSession::~HostSession() {
       i.Clear();
     }
 
+    // Activities hang their base-timer groups off of our base-timers, so
+    // only clear those once the activities are gone (anything they do on
+    // the way down still has a live timeline to work with).
+    base_timers_.Clear();
+
     // Report outstanding calls. There shouldn't be any at this point. Actually
     // it turns out there's generally 1; whichever call was responsible for
     // killing this activity will still be in progress.. so let's report on 2 or
@@ -680,6 +688,19 @@ void HostSession::RegisterContextCall(base::PythonContextCall* call) {
   }
 }
 
+auto HostSession::GetNodeCount() const -> size_t {
+  size_t count{};
+  if (scene_.Exists()) {
+    count += scene_->nodes().size();
+  }
+  for (auto&& activity : host_activities_) {
+    if (activity.Exists()) {
+      count += activity->GetMutableScene()->nodes().size();
+    }
+  }
+  return count;
+}
+
 auto HostSession::GetUnusedPlayerName(Player* p, const std::string& base_name)
     -> std::string {
   // Now find the first non-taken variation.
@@ -769,6 +790,8 @@ auto HostSession::NewTimer(TimeType timetype, TimerMedium length, bool repeat,
                            Runnable* runnable) -> int {
   assert(Object::IsValidManagedObject(runnable));
 
+  g_base->context_accounting->AddTimer();
+
   // We currently support game and base timers.
   switch (timetype) {
     case TimeType::kSim:
@@ -42,20 +42,11 @@ class HostSession : public Session {
   void DeleteTimer(TimeType timetype, int timer_id) override;
   auto GetTime(TimeType timetype) -> millisecs_t override;
 
-  void SetBaseTimerLength(int timer_id, int length) {
-    if (shutting_down_) {
-      return;
-    }
-    auto* timer = base_timers_.GetTimer(timer_id);
-    assert(timer);
-    if (!timer) {
-      return;
-    }
-    timer->SetLength(length, true, base_time_millisecs_);
-  }
-  auto BaseTimerExists(int timer_id) -> bool {
-    return base_timers_.GetTimer(timer_id) != nullptr;
-  }
+  /// Our base-time timer list; activities hang their own timer groups
+  /// off of this.
+  auto base_timers() -> TimerList* { return &base_timers_; }
+  auto sim_timers() -> TimerList* { return &sim_timers_; }
+
   // Given an activity python type, instantiate a new activity
   // and return a new reference.
   auto NewHostActivity(PyObject* activity_type_obj,
@@ -99,6 +90,9 @@ class HostSession : public Session {
   // New HostActivities should call this in their constructors.
   void AddHostActivity(HostActivity* sgc);
 
+  /// Total number of nodes in our scene and our activities' scenes.
+  auto GetNodeCount() const -> size_t;
+
   auto GetUnusedPlayerName(Player* p,
                            const std::string& base_name) -> std::string;
   auto ContextAllowsDefaultTimerTypes() -> bool override;
@@ -2,14 +2,18 @@
 
 #include "ballistica/scene_v1/support/scene.h"
 
+#include <algorithm>
+
 #include "ballistica/base/audio/audio.h"
 #include "ballistica/base/graphics/support/camera.h"
 #include "ballistica/base/networking/networking.h"
 #include "ballistica/base/python/support/python_context_call.h"
+#include "ballistica/base/support/context_accounting.h"
 #include "ballistica/scene_v1/assets/scene_sound.h"
 #include "ballistica/scene_v1/dynamics/dynamics.h"
 #include "ballistica/scene_v1/node/bomb_node.h"
 #include "ballistica/scene_v1/node/node_attribute_connection.h"
+#include "ballistica/scene_v1/node/node_type.h"
 #include "ballistica/scene_v1/node/player_node.h"
 #include "ballistica/scene_v1/node/text_node.h"
 #include "ballistica/scene_v1/support/scene_v1_app_mode.h"
@@ -135,18 +139,43 @@ void Scene::Step() {
 
   auto* appmode = SceneV1AppMode::GetActiveOrFatal();
 
-  // Step all our nodes.
+  // Step all our nodes that have something to do.
   {
+    if (step_groups_dirty_) {
+      CompactStepGroups();
+    }
     in_step_ = true;
     last_step_real_time_ = g_core->GetAppTimeMillisecs();
-    for (auto&& i : nodes_) {
-      Node* node = i.Get();
-      node->Step();
+    int stepped_count{};
+
+    // Measure skips against what existed going in; anything showing up
+    // mid-step is just waiting for the next one.
+    auto node_count = static_cast<int>(nodes_.size());
+
+    // Nodes can get scheduled or unscheduled as we go, so stick with
+    // indices here.
+    for (size_t group = 0; group < step_groups_.size(); ++group) {
+      for (size_t slot = 0; slot < step_groups_[group].size(); ++slot) {
+        Node* node = step_groups_[group][slot];
+        if (node == nullptr) {
+          continue;
+        }
+        node->Step();
 
-      // Now that it's stepped, pump new values to any nodes it's connected to.
-      node->UpdateConnections();
+        // Now that it's stepped, pump new values to any nodes it's
+        // connected to.
+        node->UpdateConnections();
+        stepped_count++;
+
+        // Drop anything that's gone idle and has nothing to pump.
+        if (!node->wants_step() && node->attribute_connections().empty()) {
+          UnscheduleNodeStep(node);
+        }
+      }
     }
     in_step_ = false;
+    last_step_stepped_node_count_ = stepped_count;
+    last_step_skipped_node_count_ = std::max(0, node_count - stepped_count);
   }
   bool is_foreground = (appmode->GetForegroundScene() == this);
 
@@ -172,6 +201,43 @@ void Scene::Step() {
   stepnum_++;
 }
 
+void Scene::ScheduleNodeStep(Node* node) {
+  assert(node && node->step_slot() == -1);
+  auto group = static_cast<size_t>(node->type()->id());
+  if (group >= step_groups_.size()) {
+    step_groups_.resize(group + 1);
+  }
+  node->set_step_slot(static_cast<int>(step_groups_[group].size()));
+  step_groups_[group].push_back(node);
+}
+
+void Scene::UnscheduleNodeStep(Node* node) {
+  assert(node);
+  if (node->step_slot() == -1) {
+    return;
+  }
+  auto& group = step_groups_[node->type()->id()];
+  assert(group[node->step_slot()] == node);
+  group[node->step_slot()] = nullptr;
+  node->set_step_slot(-1);
+  step_groups_dirty_ = true;
+}
+
+void Scene::CompactStepGroups() {
+  assert(!in_step_);
+  for (auto&& group : step_groups_) {
+    size_t count{};
+    for (auto* node : group) {
+      if (node) {
+        node->set_step_slot(static_cast<int>(count));
+        group[count++] = node;
+      }
+    }
+    group.resize(count);
+  }
+  step_groups_dirty_ = false;
+}
+
 void Scene::DeleteNode(Node* node) {
   assert(node);
 
@@ -273,6 +339,7 @@ auto Scene::NewNode(const std::string& type_string, const std::string& name,
   }
   auto node = Object::CompleteDeferred<Node>(i->second->Create(this));
   assert(node.Exists());
+  g_base->context_accounting->AddNode();
   node->AddToScene(this);
   node->set_label(name);
   node->SetDelegate(delegate);
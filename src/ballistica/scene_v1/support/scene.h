@@ -78,7 +78,25 @@ class Scene : public Object {
   auto globals_node() const -> GlobalsNode* { return globals_node_; }
   void set_globals_node(GlobalsNode* node) { globals_node_ = node; }
 
+  /// Add/remove a node from our step schedule. Nodes handle this
+  /// themselves; see Node::SetWantsStep().
+  void ScheduleNodeStep(Node* node);
+  void UnscheduleNodeStep(Node* node);
+
+  /// Number of nodes stepped during our last step.
+  auto last_step_stepped_node_count() const -> int {
+    return last_step_stepped_node_count_;
+  }
+
+  /// Number of nodes existing at the start of our last step that had
+  /// nothing to do in it.
+  auto last_step_skipped_node_count() const -> int {
+    return last_step_skipped_node_count_;
+  }
+
  private:
+  void CompactStepGroups();
+
   GlobalsNode* globals_node_{};  // Current globals node (if any).
   std::unordered_map<int, Object::WeakRef<PlayerNode> > player_nodes_;
   int64_t stream_id_{-1};
@@ -98,6 +116,14 @@ class Scene : public Object {
   float bounds_max_[3]{};
   std::vector<Object::WeakRef<Node> > out_of_bounds_nodes_;
   NodeList nodes_;
+
+  // Nodes scheduled for stepping, grouped by node-type id (so we run
+  // through all nodes of a type at once) and in creation order within
+  // each group. Unscheduled nodes leave a nullptr behind until we compact.
+  std::vector<std::vector<Node*> > step_groups_;
+  bool step_groups_dirty_{};
+  int last_step_stepped_node_count_{};
+  int last_step_skipped_node_count_{};
   Object::Ref<Dynamics> dynamics_;
 };
 
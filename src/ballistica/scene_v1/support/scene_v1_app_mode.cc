@@ -2,6 +2,9 @@
 
 #include "ballistica/scene_v1/support/scene_v1_app_mode.h"
 
+#include <algorithm>
+#include <cstdlib>
+
 #include "ballistica/base/audio/audio.h"
 #include "ballistica/base/audio/audio_source.h"
 #include "ballistica/base/graphics/graphics.h"
@@ -10,6 +13,7 @@
 #include "ballistica/base/python/base_python.h"
 #include "ballistica/base/support/app_config.h"
 #include "ballistica/base/support/plus_soft.h"
+#include "ballistica/core/platform/core_platform.h"
 #include "ballistica/scene_v1/connection/connection_set.h"
 #include "ballistica/scene_v1/connection/connection_to_client_udp.h"
 #include "ballistica/scene_v1/connection/connection_to_host.h"
@@ -23,6 +27,7 @@
 #include "ballistica/shared/foundation/event_loop.h"
 #include "ballistica/shared/generic/json.h"
 #include "ballistica/shared/generic/utils.h"
+#include "ballistica/shared/generic/worker_pool.h"
 #include "ballistica/ui_v1/ui_v1.h"
 
 namespace ballistica::scene_v1 {
@@ -105,6 +110,30 @@ void SceneV1AppMode::OnAppShutdown() {
   connections_->Shutdown();
 }
 
+void SceneV1AppMode::OnAppShutdownComplete() {
+  assert(g_base->InLogicThread());
+
+  // Scenes only use the pool from within a logic thread step, so nothing
+  // can be mid-batch here; this joins its threads.
+  narrow_phase_pool_.reset();
+}
+
+auto SceneV1AppMode::GetNarrowPhasePool() -> WorkerPool* {
+  assert(g_base->InLogicThread());
+  if (!narrow_phase_pool_inited_) {
+    narrow_phase_pool_inited_ = true;
+    int thread_count = WorkerPool::DefaultThreadCount(3);
+    if (auto env = g_core->platform->GetEnv("BA_NARROW_PHASE_THREADS")) {
+      thread_count = std::max(0, atoi(env->c_str()));
+    }
+    if (thread_count > 0) {
+      narrow_phase_pool_ =
+          std::make_unique<WorkerPool>("narrowphase", thread_count);
+    }
+  }
+  return narrow_phase_pool_.get();
+}
+
 void SceneV1AppMode::OnAppSuspend() {
   assert(g_base->InLogicThread());
 
@@ -480,21 +509,6 @@ void SceneV1AppMode::StepDisplayTime() {
 
   HandleQuitOnIdle_();
 
-  // Send the game roster to our clients if it's changed recently.
-  if (game_roster_dirty_) {
-    if (app_time > last_game_roster_send_time_ + 2500) {
-      // Now send it to all connected clients.
-      std::vector<uint8_t> msg = GetGameRosterMessage_();
-      for (auto&& c : connections()->GetConnectionsToClients()) {
-        c->SendReliableMessage(msg);
-      }
-      game_roster_dirty_ = false;
-      last_game_roster_send_time_ = app_time;
-    }
-  }
-
-  connections_->Update();
-
   // Update all of our sessions.
   for (auto&& i : sessions_) {
     if (!i.Exists()) {
@@ -511,6 +525,24 @@ void SceneV1AppMode::StepDisplayTime() {
   // Go ahead and prune dead ones.
   PruneSessions_();
 
+  // Housekeeping comes after stepping sessions so it doesn't delay
+  // gameplay, and gets put off entirely if we're running out of time.
+  // Send the game roster to our clients if it's changed recently.
+  if (game_roster_dirty_ && app_time > last_game_roster_send_time_ + 2500
+      && !g_base->logic->ShouldDeferWork(&roster_send_deferred_since_)) {
+    // Now send it to all connected clients.
+    std::vector<uint8_t> msg = GetGameRosterMessage_();
+    for (auto&& c : connections()->GetConnectionsToClients()) {
+      c->SendReliableMessage(msg);
+    }
+    game_roster_dirty_ = false;
+    last_game_roster_send_time_ = app_time;
+  }
+
+  if (!g_base->logic->ShouldDeferWork(&connections_update_deferred_since_)) {
+    connections_->Update();
+  }
+
   in_update_ = false;
 
   // Report excessively long updates.
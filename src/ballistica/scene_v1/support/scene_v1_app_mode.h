@@ -49,6 +49,13 @@ class SceneV1AppMode : public base::AppMode {
                                const SockAddr& addr) override;
   void StepDisplayTime() override;
   void OnAppShutdown() override;
+  void OnAppShutdownComplete() override;
+
+  /// Worker threads for running collision tests in parallel; shared by
+  /// all scenes. Returns nullptr if narrow-phase threading is disabled or
+  /// the app has shut down. Logic thread only.
+  auto GetNarrowPhasePool() -> WorkerPool*;
+
   auto game_roster() const -> cJSON* { return game_roster_; }
   void UpdateGameRoster();
   void MarkGameRosterDirty() { game_roster_dirty_ = true; }
@@ -246,7 +253,11 @@ class SceneV1AppMode : public base::AppMode {
 
   cJSON* game_roster_{};
   millisecs_t last_game_roster_send_time_{};
+  microsecs_t roster_send_deferred_since_{};
+  microsecs_t connections_update_deferred_since_{};
   std::unique_ptr<ConnectionSet> connections_;
+  std::unique_ptr<WorkerPool> narrow_phase_pool_;
+  bool narrow_phase_pool_inited_{};
   Object::WeakRef<ConnectionToClient> kick_vote_starter_;
   Object::WeakRef<ConnectionToClient> kick_vote_target_;
   millisecs_t kick_vote_end_time_{};
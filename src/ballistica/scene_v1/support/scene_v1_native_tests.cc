@@ -0,0 +1,211 @@
+// Released under the MIT License. See LICENSE for details.
+
+#include "ballistica/scene_v1/support/scene_v1_native_tests.h"
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "ballistica/base/support/native_tests.h"
+#include "ballistica/scene_v1/dynamics/collision_sound_merger.h"
+#include "ballistica/scene_v1/node/node_attribute.h"
+#include "ballistica/scene_v1/node/node_type.h"
+#include "ballistica/scene_v1/support/client_session_replay.h"
+#include "ballistica/shared/foundation/exception.h"
+
+namespace ballistica::scene_v1 {
+
+// Seek states delta-encoded against a keyframe must decode back exactly,
+// and should come out much smaller when most of the data is shared.
+static void TestReplayStateDelta() {
+  // Stand-in for a flattened scene state: mostly noise, so all the
+  // savings come from matching against the keyframe.
+  uint32_t seed{12345};
+  auto next_byte = [&seed] {
+    seed = seed * 1664525u + 1013904223u;
+    return static_cast<uint8_t>(seed >> 24);
+  };
+  std::vector<uint8_t> keyframe(8000);
+  for (auto&& i : keyframe) {
+    i = next_byte();
+  }
+
+  // Later states have values changed in place, nodes removed and nodes
+  // added, which shifts everything after them around.
+  std::vector<uint8_t> later{keyframe};
+  for (size_t i = 100; i < later.size(); i += 997) {
+    later[i] = next_byte();
+  }
+  later.erase(later.begin() + 2000, later.begin() + 2300);
+  std::vector<uint8_t> added(150);
+  for (auto&& i : added) {
+    i = next_byte();
+  }
+  later.insert(later.begin() + 5000, added.begin(), added.end());
+  std::vector<uint8_t> moved(keyframe.begin() + 100, keyframe.begin() + 600);
+  later.insert(later.end(), moved.begin(), moved.end());
+
+  std::vector<uint8_t> unrelated(3000);
+  for (auto&& i : unrelated) {
+    i = next_byte();
+  }
+
+  struct Case {
+    const char* name;
+    std::vector<uint8_t> ref;
+    std::vector<uint8_t> target;
+  };
+  std::vector<Case> cases{
+      {"later state", keyframe, later},
+      {"identical state", keyframe, keyframe},
+      {"unrelated state", keyframe, unrelated},
+      {"empty state", keyframe, {}},
+      {"tiny state", keyframe, {1, 2, 3}},
+      {"empty keyframe", {}, later},
+  };
+  for (auto&& c : cases) {
+    auto delta = ClientSessionReplay::EncodeStateDelta(c.ref, c.target);
+    if (ClientSessionReplay::DecodeStateDelta(c.ref, delta) != c.target) {
+      throw Exception(std::string("State delta round trip failed for ")
+                      + c.name + ".");
+    }
+  }
+
+  // The edits above touch a few percent of the data; the delta should
+  // reflect that.
+  auto delta = ClientSessionReplay::EncodeStateDelta(keyframe, later);
+  if (delta.size() * 10 > later.size()) {
+    throw Exception("State delta is " + std::to_string(delta.size())
+                    + " bytes for a " + std::to_string(later.size())
+                    + " byte state; expected far less.");
+  }
+
+  // Damaged deltas should be rejected rather than decoding to garbage.
+  delta.resize(delta.size() / 2);
+  bool rejected{};
+  try {
+    ClientSessionReplay::DecodeStateDelta(keyframe, delta);
+  } catch (const Exception&) {
+    rejected = true;
+  }
+  BA_PRECONDITION(rejected);
+}
+
+// Stands in for a SceneSound, which needs real assets.
+class TestSound_ : public Object {
+ public:
+  auto GetDefaultOwnerThread() const -> EventLoopID override {
+    return EventLoopID::kMain;
+  }
+};
+
+// Collision sound events close together in a step should come out as a
+// single sound each, with everything else kept apart.
+static void TestCollisionSoundMerging() {
+  auto thud{Object::New<TestSound_>()};
+  auto crack{Object::New<TestSound_>()};
+  CollisionSoundMerger<TestSound_> merger{1.0f};
+
+  // A pile of props landing together (centered on x=0.3 by gain), one
+  // more landing off on its own, and a silent contact which should never
+  // make a sound by itself.
+  merger.AddImpact(thud.Get(), 0.2f, 0.0f, 0.0f, 0.0f);
+  merger.AddImpact(crack.Get(), 0.6f, 0.3f, 0.0f, 0.0f);
+  merger.AddImpact(thud.Get(), 0.4f, 0.45f, 0.2f, 0.0f);
+  merger.AddImpact(thud.Get(), 0.5f, 5.0f, 0.0f, 0.0f);
+  merger.AddImpact(thud.Get(), 0.0f, 20.0f, 0.0f, 0.0f);
+  auto& impacts{merger.impacts()};
+  BA_PRECONDITION(impacts.size() == 2);
+  BA_PRECONDITION(impacts[0].event_count == 3 && impacts[1].event_count == 1);
+  BA_PRECONDITION(impacts[0].sound.Get() == crack.Get());
+  BA_PRECONDITION(impacts[0].gain == 0.6f);
+  BA_PRECONDITION(std::abs(impacts[0].x / impacts[0].weight - 0.3f) < 0.001f);
+
+  // Skids from every contact of one collision, wherever they land, start
+  // one sound, as do same-sound skids close together. Rolls and other
+  // sounds stay separate.
+  uint32_t play_ids[4]{};
+  bool playing[4]{};
+  merger.AddLoopStart(false, thud.Get(), 0.3f, 0, 0, 0, &play_ids[0],
+                      &playing[0], nullptr, nullptr);
+  merger.AddLoopStart(false, thud.Get(), 0.5f, 3, 0, 0, &play_ids[0],
+                      &playing[0], nullptr, nullptr);
+  merger.AddLoopStart(false, thud.Get(), 0.1f, 3.5f, 0, 0, &play_ids[1],
+                      &playing[1], nullptr, nullptr);
+  merger.AddLoopStart(true, thud.Get(), 0.1f, 3, 0, 0, &play_ids[2],
+                      &playing[2], nullptr, nullptr);
+  merger.AddLoopStart(false, crack.Get(), 0.1f, 3, 0, 0, &play_ids[3],
+                      &playing[3], nullptr, nullptr);
+  auto& starts{merger.loop_starts()};
+  BA_PRECONDITION(starts.size() == 3);
+  BA_PRECONDITION(starts[0].event_count == 3 && starts[0].gain == 0.5f
+                  && starts[0].x == 3.0f);
+  BA_PRECONDITION(starts[1].roll && starts[2].sound.Get() == crack.Get());
+
+  // Starts right on top of the same sound already playing get skipped.
+  merger.NoteLoopPlaying(false, crack.Get(), 3.2f, 0, 0);
+  BA_PRECONDITION(!merger.IsLoopPlaying(starts[0]));
+  BA_PRECONDITION(!merger.IsLoopPlaying(starts[1]));
+  BA_PRECONDITION(merger.IsLoopPlaying(starts[2]));
+
+  merger.Clear();
+  BA_PRECONDITION(merger.impacts().empty() && merger.loop_starts().empty());
+}
+
+// Quantized float attrs should come back within half a step of what was
+// sent, and values they can't represent should be refused.
+static void TestNodeAttrQuantization() {
+  auto* image_type = g_scene_v1->node_types().at("image");
+  struct Case {
+    const char* attr;
+    int size;
+    float min_value;
+    float max_value;
+    float precision;
+  };
+  for (auto&& c : std::vector<Case>{{"opacity", 1, 0.0f, 1.0f, 1.0f / 255.0f},
+                                    {"position", 2, -2048.0f, 2048.0f, 0.1f},
+                                    {"rotate", 2, -720.0f, 720.0f, 0.05f}}) {
+    auto* attr = image_type->GetAttribute(c.attr);
+    BA_PRECONDITION(attr->quantized_size() == c.size);
+    uint16_t quantized;
+    for (int i = 0; i <= 1000; ++i) {
+      float value = c.min_value
+                    + (c.max_value - c.min_value) * static_cast<float>(i)
+                          / 1000.0f;
+      BA_PRECONDITION(attr->QuantizeFloat(value, &quantized));
+      float error = std::abs(attr->DequantizeFloat(quantized) - value);
+      if (error > c.precision * 0.51f) {
+        throw Exception(std::string("Quantizing ") + c.attr + " value "
+                        + std::to_string(value) + " is off by "
+                        + std::to_string(error) + ".");
+      }
+    }
+
+    // The ends of the range should be exact.
+    BA_PRECONDITION(attr->QuantizeFloat(c.min_value, &quantized)
+                    && attr->DequantizeFloat(quantized) == c.min_value);
+    BA_PRECONDITION(attr->QuantizeFloat(c.max_value, &quantized)
+                    && attr->DequantizeFloat(quantized) == c.max_value);
+
+    BA_PRECONDITION(!attr->QuantizeFloat(c.max_value + c.precision,
+                                         &quantized));
+    BA_PRECONDITION(!attr->QuantizeFloat(c.min_value - c.precision,
+                                         &quantized));
+    BA_PRECONDITION(!attr->QuantizeFloat(
+        std::numeric_limits<float>::quiet_NaN(), &quantized));
+  }
+
+  // Attrs without declared ranges are always sent as full floats.
+  BA_PRECONDITION(image_type->GetAttribute("vr_depth")->quantized_size()
+                  == 0);
+}
+
+void SceneV1NativeTests::AddTests() {
+  base::NativeTests::Add("replay_state_delta", TestReplayStateDelta);
+  base::NativeTests::Add("collision_sound_merging", TestCollisionSoundMerging);
+  base::NativeTests::Add("node_attr_quantization", TestNodeAttrQuantization);
+}
+
+}  // namespace ballistica::scene_v1
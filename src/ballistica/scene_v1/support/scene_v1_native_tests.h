@@ -0,0 +1,18 @@
+// Released under the MIT License. See LICENSE for details.
+
+#ifndef BALLISTICA_SCENE_V1_SUPPORT_SCENE_V1_NATIVE_TESTS_H_
+#define BALLISTICA_SCENE_V1_SUPPORT_SCENE_V1_NATIVE_TESTS_H_
+
+namespace ballistica::scene_v1 {
+
+/// Native tests for scene-v1 internals; these run through the same
+/// _babase.run_native_test() call as the base ones.
+class SceneV1NativeTests {
+ public:
+  /// Make our tests available to base::NativeTests.
+  static void AddTests();
+};
+
+}  // namespace ballistica::scene_v1
+
+#endif  // BALLISTICA_SCENE_V1_SUPPORT_SCENE_V1_NATIVE_TESTS_H_
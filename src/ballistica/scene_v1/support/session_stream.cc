@@ -5,6 +5,7 @@
 #include "ballistica/base/assets/assets_server.h"
 #include "ballistica/base/dynamics/bg/bg_dynamics.h"
 #include "ballistica/base/networking/networking.h"
+#include "ballistica/base/support/context_accounting.h"
 #include "ballistica/scene_v1/assets/scene_collision_mesh.h"
 #include "ballistica/scene_v1/assets/scene_data_asset.h"
 #include "ballistica/scene_v1/assets/scene_mesh.h"
@@ -25,6 +26,12 @@ namespace ballistica::scene_v1 {
 SessionStream::SessionStream(HostSession* host_session, bool save_replay)
     : app_mode_{SceneV1AppMode::GetActiveOrThrow()},
       host_session_{host_session} {
+  // Live host-session streams can send quantized float attrs if we're
+  // hosting protocol 36+. (Other streams are local state dumps which we
+  // keep at full precision).
+  quantize_floats_ =
+      host_session_ && app_mode_->host_protocol_version() >= 36;
+
   if (save_replay) {
     // Sanity check - we should only ever be writing one replay at once.
     if (g_scene_v1->replay_open) {
@@ -32,9 +39,12 @@ SessionStream::SessionStream(HostSession* host_session, bool save_replay)
           "g_scene_v1->replay_open true at replay start;"
           " shouldn't happen.");
     }
-    // We always write replays as the max protocol version we support.
+    // Our replays only need the newest protocol version we support if
+    // they can contain quantized floats; otherwise stay readable by
+    // older builds.
     assert(g_base->assets_server);
-    g_base->assets_server->PushBeginWriteReplayCall(kProtocolVersionMax);
+    g_base->assets_server->PushBeginWriteReplayCall(
+        quantize_floats_ ? kProtocolVersionMax : kProtocolVersionReplayBase);
     writing_replay_ = true;
     g_scene_v1->replay_open = true;
   }
@@ -328,6 +338,22 @@ void SessionStream::WriteFloats(size_t count, const float* vals) {
   memcpy(&(out_command_[size]), vals, vals_size);
 }
 
+void SessionStream::WriteQuantizedFloats(int size, size_t count,
+                                         const uint16_t* vals) {
+  assert(count > 0);
+  assert(size == 1 || size == 2);
+  auto offset = out_command_.size();
+  out_command_.resize(offset + count * size);
+  uint8_t* ptr = &out_command_[offset];
+  if (size == 1) {
+    for (size_t i = 0; i < count; ++i) {
+      *(ptr++) = static_cast<uint8_t>(vals[i]);
+    }
+  } else {
+    memcpy(ptr, vals, count * 2);
+  }
+}
+
 void SessionStream::WriteInts32(size_t count, const int32_t* vals) {
   assert(count > 0);
   auto size = out_command_.size();
@@ -427,6 +453,7 @@ void SessionStream::EndCommand(bool is_time_set) {
   memcpy(&(out_message_[out_message_size]), &val, 2);
   memcpy(&(out_message_[out_message_size + 2]), &(out_command_[0]),
          out_command_.size());
+  g_base->context_accounting->AddStreamBytes(out_command_.size() + 2);
 
   // When attached to a host-session, send this message to clients if it's been
   // long enough. Also send off occasional correction packets.
@@ -777,6 +804,15 @@ void SessionStream::NodeMessage(Node* node, const char* buffer, size_t size) {
 
 void SessionStream::SetNodeAttr(const NodeAttribute& attr, float val) {
   assert(IsValidNode(attr.node));
+  uint16_t quantized;
+  if (quantize_floats_ && attr.attr->quantized_size()
+      && attr.attr->QuantizeFloat(val, &quantized)) {
+    WriteCommandInt64_2(SessionCommand::kSetNodeAttrFloatQuantized,
+                        attr.node->stream_id(), attr.index());
+    WriteQuantizedFloats(attr.attr->quantized_size(), 1, &quantized);
+    EndCommand();
+    return;
+  }
   WriteCommandInt64_2(SessionCommand::kSetNodeAttrFloat, attr.node->stream_id(),
                       attr.index());
   WriteFloat(val);
@@ -801,6 +837,28 @@ void SessionStream::SetNodeAttr(const NodeAttribute& attr,
                                 const std::vector<float>& vals) {
   assert(IsValidNode(attr.node));
   size_t count{vals.size()};
+
+  // Send quantized values if the attr supports it and every value fits;
+  // otherwise fall back to full floats.
+  if (quantize_floats_ && attr.attr->quantized_size() && count > 0) {
+    quantized_scratch_.resize(count);
+    bool all_fit{true};
+    for (size_t i = 0; i < count; ++i) {
+      if (!attr.attr->QuantizeFloat(vals[i], &quantized_scratch_[i])) {
+        all_fit = false;
+        break;
+      }
+    }
+    if (all_fit) {
+      WriteCommandInt64_3(SessionCommand::kSetNodeAttrFloatsQuantized,
+                          attr.node->stream_id(), attr.index(),
+                          static_cast_check_fit<int64_t>(count));
+      WriteQuantizedFloats(attr.attr->quantized_size(), count,
+                           quantized_scratch_.data());
+      EndCommand();
+      return;
+    }
+  }
   WriteCommandInt64_3(SessionCommand::kSetNodeAttrFloats,
                       attr.node->stream_id(), attr.index(),
                       static_cast_check_fit<int64_t>(count));
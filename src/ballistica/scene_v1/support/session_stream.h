@@ -102,6 +102,7 @@ class SessionStream : public Object, public ClientControllerInterface {
   void WriteString(const std::string& s);
   void WriteFloat(float val);
   void WriteFloats(size_t count, const float* vals);
+  void WriteQuantizedFloats(int size, size_t count, const uint16_t* vals);
   void WriteInts32(size_t count, const int32_t* vals);
   void WriteInts64(size_t count, const int64_t* vals);
   void WriteChars(size_t count, const char* vals);
@@ -140,6 +141,8 @@ class SessionStream : public Object, public ClientControllerInterface {
   std::vector<ConnectionToClient*> connections_to_clients_ignored_;
   SceneV1AppMode* app_mode_;
   bool writing_replay_{};
+  bool quantize_floats_{};
+  std::vector<uint16_t> quantized_scratch_;
   millisecs_t last_physics_correction_time_{};
   millisecs_t last_send_time_{};
   millisecs_t time_{};
@@ -6,6 +6,7 @@
 #include "ballistica/core/platform/support/min_sdl.h"
 #include "ballistica/core/python/core_python.h"
 #include "ballistica/core/support/base_soft.h"
+#include "ballistica/core/support/prefork_server.h"
 #include "ballistica/shared/foundation/event_loop.h"
 #include "ballistica/shared/foundation/fatal_error.h"
 #include "ballistica/shared/foundation/logging.h"
@@ -107,6 +108,20 @@ auto MonolithicMain(const core::CoreConfig& core_config) -> int {
       FatalError("Base module unavailable; can't run app.");
     }
 
+    // In prefork mode, this is where we split into a set of servers that
+    // share everything we've loaded so far. The parent stays here
+    // supervising while workers continue on to start their apps.
+    if (l_core->core_config().prefork_workers > 0) {
+      if (!l_core->HeadlessMode()) {
+        FatalError("Prefork mode is only available in headless builds.");
+      }
+      core::PreforkServer prefork(l_core->core_config().prefork_workers);
+      if (auto exit_code = prefork.Run()) {
+        l_core->set_engine_done();
+        exit(*exit_code);
+      }
+    }
+
     auto time4 = core::CorePlatform::GetCurrentMillisecs();
 
     // -------------------------------------------------------------------------
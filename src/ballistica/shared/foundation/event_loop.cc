@@ -2,6 +2,11 @@
 
 #include "ballistica/shared/foundation/event_loop.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
 #include "ballistica/core/platform/core_platform.h"
 #include "ballistica/core/python/core_python.h"
 #include "ballistica/core/support/base_soft.h"
@@ -16,6 +21,10 @@ namespace ballistica {
 using core::g_base_soft;
 using core::g_core;
 
+// All bootstrapped event loops (for stats reporting).
+static std::mutex g_event_loops_mutex;
+static std::vector<EventLoop*> g_event_loops;
+
 EventLoop::EventLoop(EventLoopID identifier_in, ThreadSource source)
     : source_(source), identifier_(identifier_in) {
   switch (source_) {
@@ -359,6 +368,11 @@ void EventLoop::BootstrapThread_() {
   }
   assert(!name_.empty());
   g_core->RegisterThread(name_);
+  RunnablePool::SetThreadStats(&runnable_alloc_stats_);
+  {
+    std::scoped_lock lock(g_event_loops_mutex);
+    g_event_loops.push_back(this);
+  }
   bootstrapped_ = true;
 }
 
@@ -381,6 +395,7 @@ auto EventLoop::ThreadMain_() -> int {
 
     RunToCompletion();
 
+    RunnablePool::SetThreadStats(nullptr);
     g_core->UnregisterThread();
     return 0;
   } catch (const std::exception& e) {
@@ -426,7 +441,39 @@ void EventLoop::SetAcquiresPythonGIL() {
 // Explicitly kill the main thread.
 void EventLoop::Exit() { done_ = true; }
 
-EventLoop::~EventLoop() = default;
+EventLoop::~EventLoop() {
+  std::scoped_lock lock(g_event_loops_mutex);
+  g_event_loops.erase(
+      std::remove(g_event_loops.begin(), g_event_loops.end(), this),
+      g_event_loops.end());
+}
+
+void EventLoop::LogRunnableAllocStats() {
+  std::string out{"Runnable allocations by event loop:"};
+  std::scoped_lock lock(g_event_loops_mutex);
+  for (auto* loop : g_event_loops) {
+    auto& stats = loop->runnable_alloc_stats_;
+    auto allocs = stats.allocs.load(std::memory_order_relaxed);
+    auto pooled = stats.local_hits.load(std::memory_order_relaxed)
+                  + stats.depot_refills.load(std::memory_order_relaxed);
+    char buffer[256];
+    snprintf(buffer, sizeof(buffer),
+             "\n  %s: %llu allocs (%.1f%% pooled, %llu depot refills,"
+             " %llu heap), %llu frees",
+             loop->name_.c_str(), static_cast<unsigned long long>(allocs),
+             allocs ? 100.0 * static_cast<double>(pooled)
+                          / static_cast<double>(allocs)
+                    : 0.0,
+             static_cast<unsigned long long>(
+                 stats.depot_refills.load(std::memory_order_relaxed)),
+             static_cast<unsigned long long>(
+                 stats.heap_allocs.load(std::memory_order_relaxed)),
+             static_cast<unsigned long long>(
+                 stats.frees.load(std::memory_order_relaxed)));
+    out += buffer;
+  }
+  Log(LogLevel::kInfo, out);
+}
 
 void EventLoop::LogThreadMessageTally_(
     std::vector<std::pair<LogLevel, std::string>>* log_entries) {
@@ -13,6 +13,7 @@
 #include "ballistica/core/core.h"
 #include "ballistica/shared/ballistica.h"
 #include "ballistica/shared/generic/lambda_runnable.h"
+#include "ballistica/shared/generic/runnable_pool.h"
 #include "ballistica/shared/generic/timer_list.h"
 
 namespace ballistica {
@@ -96,6 +97,15 @@ class EventLoop {
 
   auto name() const { return name_; }
 
+  /// Counters for Runnables allocated by code running in this loop's
+  /// thread (which includes calls pushed *to* other loops from here).
+  auto runnable_alloc_stats() const -> const RunnablePool::Stats& {
+    return runnable_alloc_stats_;
+  }
+
+  /// Log runnable allocation counters for all running event loops.
+  static void LogRunnableAllocStats();
+
  private:
   struct ThreadMessage_ {
     enum class Type { kShutdown = 999, kRunnable, kSuspend, kUnsuspend };
@@ -167,6 +177,7 @@ class EventLoop {
   std::string name_;
   PyThreadState* py_thread_state_{};
   TimerList timers_;
+  RunnablePool::Stats runnable_alloc_stats_;
 };
 
 }  // namespace ballistica
@@ -58,6 +58,7 @@ class Utils;
 class Vector2f;
 class Vector3f;
 class Vector4f;
+class WorkerPool;
 
 // FIXME: remove this - a few base things we need.
 namespace base {
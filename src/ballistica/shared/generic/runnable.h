@@ -6,6 +6,7 @@
 #include <string>
 
 #include "ballistica/shared/foundation/object.h"
+#include "ballistica/shared/generic/runnable_pool.h"
 
 namespace ballistica {
 
@@ -13,6 +14,15 @@ class Runnable : public Object {
  public:
   virtual void Run() = 0;
 
+  // We create and destroy these constantly (one for most every PushCall,
+  // timer, etc.) so they come out of a pool instead of the general heap.
+  static auto operator new(size_t size) -> void* {
+    return RunnablePool::Allocate(size);
+  }
+  static void operator delete(void* ptr, size_t size) {
+    RunnablePool::Free(ptr, size);
+  }
+
   void RunAndLogErrors();
 
   // These are used on lots of threads; we lock to whichever thread first
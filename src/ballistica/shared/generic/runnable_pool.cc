@@ -0,0 +1,223 @@
+// Released under the MIT License. See LICENSE for details.
+
+#include "ballistica/shared/generic/runnable_pool.h"
+
+#include <mutex>
+#include <new>
+
+namespace ballistica {
+
+const int kRunnablePoolClassCount{4};
+const size_t kRunnablePoolBlockSizes[kRunnablePoolClassCount] = {64, 128, 256,
+                                                                 512};
+
+// Blocks move between threads and the depot this many at a time.
+const int kRunnablePoolBatchSize{32};
+
+// Past this, a thread hands a batch of its free blocks back to the depot.
+const int kRunnablePoolMaxLocalBlocks{kRunnablePoolBatchSize * 4};
+
+// Past this (per size class), freed blocks go back to the heap.
+const int kRunnablePoolMaxDepotBlocks{4096};
+
+namespace {
+
+struct FreeBlock {
+  FreeBlock* next;
+};
+
+struct Depot {
+  std::mutex mutex;
+  FreeBlock* head{};
+  int count{};
+};
+
+// Kept trivially destructible so it stays usable while other thread-local
+// destructors (which may well free runnables) run at thread exit.
+struct ThreadCache {
+  FreeBlock* heads[kRunnablePoolClassCount];
+  int counts[kRunnablePoolClassCount];
+  RunnablePool::Stats* stats;
+  bool flusher_created;
+  bool dead;
+};
+
+struct ThreadCacheFlusher {
+  ~ThreadCacheFlusher();
+};
+
+thread_local ThreadCache g_runnable_pool_cache{};
+thread_local ThreadCacheFlusher g_runnable_pool_flusher;
+
+// Intentionally leaked; runnables can be freed very late in shutdown.
+auto GetDepots() -> Depot* {
+  static auto* depots = new Depot[kRunnablePoolClassCount];
+  return depots;
+}
+
+auto SizeClass(size_t size) -> int {
+  for (int i = 0; i < kRunnablePoolClassCount; ++i) {
+    if (size <= kRunnablePoolBlockSizes[i]) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+// Hand a chain of blocks to the depot (or the heap if the depot is full).
+void ReturnToDepot(int size_class, FreeBlock* head, FreeBlock* tail,
+                   int count) {
+  auto& depot = GetDepots()[size_class];
+  {
+    std::scoped_lock lock(depot.mutex);
+    if (depot.count + count <= kRunnablePoolMaxDepotBlocks) {
+      tail->next = depot.head;
+      depot.head = head;
+      depot.count += count;
+      return;
+    }
+  }
+  while (head) {
+    auto* next = head->next;
+    ::operator delete(head);
+    head = next;
+  }
+}
+
+ThreadCacheFlusher::~ThreadCacheFlusher() {
+  auto& cache = g_runnable_pool_cache;
+  for (int i = 0; i < kRunnablePoolClassCount; ++i) {
+    if (cache.heads[i]) {
+      auto* tail = cache.heads[i];
+      while (tail->next) {
+        tail = tail->next;
+      }
+      ReturnToDepot(i, cache.heads[i], tail, cache.counts[i]);
+      cache.heads[i] = nullptr;
+      cache.counts[i] = 0;
+    }
+  }
+  cache.dead = true;
+}
+
+}  // namespace
+
+auto RunnablePool::BlockSize(size_t size) -> size_t {
+  auto size_class = SizeClass(size);
+  return size_class < 0 ? 0 : kRunnablePoolBlockSizes[size_class];
+}
+
+void RunnablePool::SetThreadStats(Stats* stats) {
+  g_runnable_pool_cache.stats = stats;
+}
+
+auto RunnablePool::Allocate(size_t size) -> void* {
+  auto& cache = g_runnable_pool_cache;
+  auto* stats = cache.stats;
+  if (stats) {
+    stats->allocs.fetch_add(1, std::memory_order_relaxed);
+  }
+  auto size_class = SizeClass(size);
+  if (size_class < 0) {
+    if (stats) {
+      stats->heap_allocs.fetch_add(1, std::memory_order_relaxed);
+    }
+    return ::operator new(size);
+  }
+
+  if (auto* block = cache.heads[size_class]) {
+    cache.heads[size_class] = block->next;
+    cache.counts[size_class]--;
+    if (stats) {
+      stats->local_hits.fetch_add(1, std::memory_order_relaxed);
+    }
+    return block;
+  }
+
+  // Our list is empty; grab a batch from the depot.
+  auto& depot = GetDepots()[size_class];
+  FreeBlock* block{};
+  {
+    std::scoped_lock lock(depot.mutex);
+    if (depot.head) {
+      block = depot.head;
+      if (cache.dead) {
+        depot.head = block->next;
+        depot.count--;
+      } else {
+        auto* tail = block;
+        int count = 1;
+        while (count < kRunnablePoolBatchSize && tail->next) {
+          tail = tail->next;
+          count++;
+        }
+        depot.head = tail->next;
+        depot.count -= count;
+        tail->next = nullptr;
+        cache.heads[size_class] = block->next;
+        cache.counts[size_class] = count - 1;
+      }
+    }
+  }
+  if (block) {
+    if (!cache.flusher_created && !cache.dead) {
+      // Touching this creates it, so our blocks get returned when the
+      // thread exits.
+      cache.flusher_created = true;
+      static_cast<void>(&g_runnable_pool_flusher);
+    }
+    if (stats) {
+      stats->depot_refills.fetch_add(1, std::memory_order_relaxed);
+    }
+    return block;
+  }
+
+  if (stats) {
+    stats->heap_allocs.fetch_add(1, std::memory_order_relaxed);
+  }
+  return ::operator new(kRunnablePoolBlockSizes[size_class]);
+}
+
+void RunnablePool::Free(void* ptr, size_t size) {
+  if (ptr == nullptr) {
+    return;
+  }
+  auto& cache = g_runnable_pool_cache;
+  if (cache.stats) {
+    cache.stats->frees.fetch_add(1, std::memory_order_relaxed);
+  }
+  auto size_class = SizeClass(size);
+  if (size_class < 0) {
+    ::operator delete(ptr);
+    return;
+  }
+  auto* block = static_cast<FreeBlock*>(ptr);
+  if (cache.dead) {
+    block->next = nullptr;
+    ReturnToDepot(size_class, block, block, 1);
+    return;
+  }
+  if (!cache.flusher_created) {
+    cache.flusher_created = true;
+    static_cast<void>(&g_runnable_pool_flusher);
+  }
+  block->next = cache.heads[size_class];
+  cache.heads[size_class] = block;
+  cache.counts[size_class]++;
+
+  // Threads that mostly consume runnables made elsewhere pile up blocks;
+  // pass a batch back for the producers.
+  if (cache.counts[size_class] > kRunnablePoolMaxLocalBlocks) {
+    auto* head = cache.heads[size_class];
+    auto* tail = head;
+    for (int i = 1; i < kRunnablePoolBatchSize; ++i) {
+      tail = tail->next;
+    }
+    cache.heads[size_class] = tail->next;
+    cache.counts[size_class] -= kRunnablePoolBatchSize;
+    tail->next = nullptr;
+    ReturnToDepot(size_class, head, tail, kRunnablePoolBatchSize);
+  }
+}
+
+}  // namespace ballistica
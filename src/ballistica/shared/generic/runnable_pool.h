@@ -0,0 +1,54 @@
+// Released under the MIT License. See LICENSE for details.
+
+#ifndef BALLISTICA_SHARED_GENERIC_RUNNABLE_POOL_H_
+#define BALLISTICA_SHARED_GENERIC_RUNNABLE_POOL_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace ballistica {
+
+/// Size-classed memory pool backing Runnable allocations.
+///
+/// Runnables are tiny and extremely short lived (most are freed right
+/// after running, often on a different thread than the one that created
+/// them), so going to the general heap for each one leads to allocator
+/// contention and fragmentation in long-running processes. Each thread
+/// keeps a small free list per size class and trades blocks with a shared
+/// depot in batches, so most allocations and frees take no locks. Blocks
+/// too large for any size class go straight to the heap.
+class RunnablePool {
+ public:
+  /// Allocation counters for a thread. EventLoops own one of these and
+  /// point their thread at it (see SetThreadStats()); allocations on other
+  /// threads are not counted. Values are updated with relaxed atomics and
+  /// can be read from any thread.
+  struct Stats {
+    std::atomic<uint64_t> allocs{};
+    std::atomic<uint64_t> frees{};
+
+    /// Allocations served from the calling thread's free list.
+    std::atomic<uint64_t> local_hits{};
+
+    /// Allocations that refilled from the shared depot.
+    std::atomic<uint64_t> depot_refills{};
+
+    /// Allocations that went to the heap (empty pool or oversized).
+    std::atomic<uint64_t> heap_allocs{};
+  };
+
+  static auto Allocate(size_t size) -> void*;
+  static void Free(void* ptr, size_t size);
+
+  /// Set where the calling thread's allocation counters go (or nullptr).
+  static void SetThreadStats(Stats* stats);
+
+  /// Return the block size used for a given allocation size, or 0 if it
+  /// is too large to be pooled.
+  static auto BlockSize(size_t size) -> size_t;
+};
+
+}  // namespace ballistica
+
+#endif  // BALLISTICA_SHARED_GENERIC_RUNNABLE_POOL_H_
@@ -2,6 +2,10 @@
 
 #include "ballistica/shared/generic/timer_list.h"
 
+#include <algorithm>
+
+#include "ballistica/core/platform/core_platform.h"
+#include "ballistica/shared/generic/lambda_runnable.h"
 #include "ballistica/shared/generic/runnable.h"
 
 namespace ballistica {
@@ -9,6 +13,7 @@ namespace ballistica {
 TimerList::TimerList() = default;
 
 TimerList::~TimerList() {
+  DetachFromParent();
   Clear();
 
   // Don't delete the client timer if one exists; just inform it that the list
@@ -33,66 +38,54 @@ TimerList::~TimerList() {
 
 void TimerList::Clear() {
   assert(!are_clearing_);
+
+  // Any groups hanging off of us go inert.
+  while (!children_.empty()) {
+    children_.back()->DetachFromParent();
+  }
+
   are_clearing_ = true;
-  while (timers_) {
-    Timer* t = timers_;
-    t->on_list_ = false;
-    timer_count_active_--;
-    timers_ = t->next_;
-    delete t;
+
+  // Drop everything out of the heap up front; deleting timers can run
+  // arbitrary code which may in turn delete other timers of ours.
+  for (auto* t : heap_) {
+    t->heap_index_ = -1;
   }
-  while (timers_inactive_) {
-    Timer* t = timers_inactive_;
+  timer_count_inactive_ += timer_count_active_;
+  timer_count_active_ = 0;
+  heap_.clear();
+
+  while (!timers_by_id_.empty()) {
+    auto i = timers_by_id_.begin();
+    Timer* t = i->second;
+    timers_by_id_.erase(i);
     t->on_list_ = false;
     timer_count_inactive_--;
-    timers_inactive_ = t->next_;
     delete t;
   }
   are_clearing_ = false;
+  UpdateParentTimer();
 }
 
 // Pull a timer out of the list.
 auto TimerList::PullTimer(int timer_id, bool remove) -> Timer* {
-  Timer* t = timers_;
-  Timer* p = nullptr;
-  while (t) {
-    if (t->id_ == timer_id) {
-      if (remove) {
-        if (p) {
-          p->next_ = t->next_;
-        } else {
-          timers_ = t->next_;
-        }
-        t->on_list_ = false;
+  auto i = timers_by_id_.find(timer_id);
+  if (i != timers_by_id_.end()) {
+    Timer* t = i->second;
+    if (remove) {
+      timers_by_id_.erase(i);
+      if (t->heap_index_ >= 0) {
+        HeapRemove(static_cast<size_t>(t->heap_index_));
         timer_count_active_--;
-      }
-      return t;
-    }
-    p = t;
-    t = t->next_;
-  }
-
-  // Didn't find it. check the inactive list.
-  t = timers_inactive_;
-  p = nullptr;
-  while (t) {
-    if (t->id_ == timer_id) {
-      if (remove) {
-        if (p) {
-          p->next_ = t->next_;
-        } else {
-          timers_inactive_ = t->next_;
-        }
-        t->on_list_ = false;
+      } else {
         timer_count_inactive_--;
       }
-      return t;
+      t->on_list_ = false;
     }
-    p = t;
-    t = t->next_;
+    return t;
   }
 
-  // Not on either list; only other possibility is the current client timer.
+  // Not on the list; only other possibility is the current client timer.
   if (client_timer_ && client_timer_->id_ == timer_id) {
     return client_timer_;
   }
@@ -100,37 +93,76 @@ auto TimerList::PullTimer(int timer_id, bool remove) -> Timer* {
 }
 
 void TimerList::Run(TimerMedium target_time) {
-  assert(!are_clearing_);
-
   // Limit our runs to whats initially on the list so we don't spin all day if
   // a timer resets itself to run immediately.
   // FIXME - what if this timer kills one or more of the initially-expired ones
   //  ..that means it could potentially run more than once..  does it matter?
-  int expired_count = GetExpiredCount(target_time);
-  for (int timers_to_run = expired_count; timers_to_run > 0; timers_to_run--) {
+  RunTimers(target_time, GetExpiredCount(target_time));
+}
+
+auto TimerList::RunTimers(TimerMedium target_time, int count) -> bool {
+  assert(!are_clearing_);
+  running_ = true;
+  for (int timers_to_run = count; timers_to_run > 0; timers_to_run--) {
     Timer* t = GetExpiredTimer(target_time);
     if (t) {
       assert(!t->dead_);
+      auto start_time = core::CorePlatform::GetCurrentMicrosecs();
       t->runnable_->RunAndLogErrors();
       // If this timer killed the list, stop; otherwise put it back and keep on
       // trucking.
       if (t->list_died_) {
         delete t;  // nothing is left but this timer
-        return;
+        return false;
       } else {
+        // Group proxies just run other lists' timers; those lists keep
+        // their own stats.
+        if (!t->group_) {
+          auto duration =
+              core::CorePlatform::GetCurrentMicrosecs() - start_time;
+          fire_count_++;
+          fire_time_total_ += duration;
+          fire_time_max_ = std::max(fire_time_max_, duration);
+        }
         SubmitTimer(t);
       }
     }
   }
+  running_ = false;
+  return true;
 }
+
 auto TimerList::GetExpiredCount(TimerMedium target_time) -> int {
   assert(!are_clearing_);
 
-  Timer* t = timers_;
+  // Walk the part of the heap that is expired; anything below an
+  // unexpired entry is unexpired too.
   int count = 0;
-  while (t && t->expire_time_ <= target_time) {
-    count++;
-    t = t->next_;
+  auto& pending{expired_scan_};
+  pending.clear();
+  if (!heap_.empty()) {
+    pending.push_back(0);
+  }
+  while (!pending.empty()) {
+    size_t index = pending.back();
+    pending.pop_back();
+    Timer* t = heap_[index];
+    if (t->expire_time_ > target_time) {
+      continue;
+    }
+
+    // A group's proxy runs one of the group's timers each time it fires,
+    // so it counts for however many of those are expired.
+    if (t->group_) {
+      count += t->group_->GetExpiredCount(t->group_->LocalTime(target_time));
+    } else {
+      count++;
+    }
+    for (size_t child = index * 2 + 1; child <= index * 2 + 2; ++child) {
+      if (child < heap_.size()) {
+        pending.push_back(child);
+      }
+    }
   }
   return count;
 }
@@ -141,11 +173,11 @@ auto TimerList::GetExpiredCount(TimerMedium target_time) -> int {
 auto TimerList::GetExpiredTimer(TimerMedium target_time) -> Timer* {
   assert(!are_clearing_);
 
-  Timer* t;
-  if (timers_ != nullptr && timers_->expire_time_ <= target_time) {
-    t = timers_;
+  if (!heap_.empty() && heap_.front()->expire_time_ <= target_time) {
+    Timer* t = heap_.front();
     t->last_run_time_ = target_time;
-    timers_ = timers_->next_;
+    HeapRemove(0);
+    timers_by_id_.erase(t->id_);
     timer_count_active_--;
     t->on_list_ = false;
 
@@ -172,16 +204,17 @@ auto TimerList::NewTimer(TimerMedium current_time, TimerMedium length,
 #pragma clang diagnostic push
 #pragma ide diagnostic ignored "DanglingPointer"
   t = SubmitTimer(t);
+  UpdateParentTimer();
   return t;
 #pragma clang diagnostic pop
 }
 
 auto TimerList::TimeToNextExpire(TimerMedium current_time) -> TimerMedium {
   assert(!are_clearing_);
-  if (!timers_) {
+  if (heap_.empty()) {
     return (TimerMedium)-1;
   }
-  TimerMedium diff = timers_->expire_time_ - current_time;
+  TimerMedium diff = heap_.front()->expire_time_ - current_time;
   return (diff < 0) ? 0 : diff;
 }
 
@@ -208,6 +241,7 @@ void TimerList::DeleteTimer(int timer_id) {
       // Not in the client domain; kill it now.
       delete t;
     }
+    UpdateParentTimer();
   }
 }
 
@@ -247,30 +281,152 @@ auto TimerList::SubmitTimer(Timer* t) -> Timer* {
 
 void TimerList::AddTimer(Timer* t) {
   assert(t && !t->on_list_);
+  timers_by_id_[t->id_] = t;
 
-  // If its set to never go off, throw it on the inactive list.
+  // If its set to never go off, it just sits in our id map; otherwise it
+  // goes in the heap. Submission order breaks ties so that timers with
+  // the same expire time run in the order they were added.
   if (t->length_ == -1) {
-    t->next_ = timers_inactive_;
-    timers_inactive_ = t;
+    t->heap_index_ = -1;
     timer_count_inactive_++;
   } else {
-    Timer** list = &timers_;
-
-    // Go along till we find an expire time later than ourself.
-    while (*list != nullptr) {
-      if ((*list)->expire_time_ > t->expire_time_) {
-        break;
-      }
-      list = &((*list)->next_);
-    }
-    Timer* tmp = (*list);
-    (*list) = t;
-    t->next_ = tmp;
+    t->submit_index_ = next_submit_index_++;
+    t->heap_index_ = static_cast<int64_t>(heap_.size());
+    heap_.push_back(t);
+    HeapSiftUp(heap_.size() - 1);
     timer_count_active_++;
   }
   t->on_list_ = true;
 }
 
+auto TimerList::HeapLess(const Timer* a, const Timer* b) const -> bool {
+  if (a->expire_time_ != b->expire_time_) {
+    return a->expire_time_ < b->expire_time_;
+  }
+  return a->submit_index_ < b->submit_index_;
+}
+
+void TimerList::HeapSiftUp(size_t index) {
+  Timer* t = heap_[index];
+  while (index > 0) {
+    size_t parent = (index - 1) / 2;
+    if (!HeapLess(t, heap_[parent])) {
+      break;
+    }
+    heap_[index] = heap_[parent];
+    heap_[index]->heap_index_ = static_cast<int64_t>(index);
+    index = parent;
+  }
+  heap_[index] = t;
+  t->heap_index_ = static_cast<int64_t>(index);
+}
+
+void TimerList::HeapSiftDown(size_t index) {
+  Timer* t = heap_[index];
+  size_t size = heap_.size();
+  while (true) {
+    size_t child = index * 2 + 1;
+    if (child >= size) {
+      break;
+    }
+    if (child + 1 < size && HeapLess(heap_[child + 1], heap_[child])) {
+      child++;
+    }
+    if (!HeapLess(heap_[child], t)) {
+      break;
+    }
+    heap_[index] = heap_[child];
+    heap_[index]->heap_index_ = static_cast<int64_t>(index);
+    index = child;
+  }
+  heap_[index] = t;
+  t->heap_index_ = static_cast<int64_t>(index);
+}
+
+void TimerList::HeapRemove(size_t index) {
+  assert(index < heap_.size());
+  heap_[index]->heap_index_ = -1;
+  Timer* last = heap_.back();
+  heap_.pop_back();
+  if (index < heap_.size()) {
+    heap_[index] = last;
+    last->heap_index_ = static_cast<int64_t>(index);
+    if (index > 0 && HeapLess(last, heap_[(index - 1) / 2])) {
+      HeapSiftUp(index);
+    } else {
+      HeapSiftDown(index);
+    }
+  }
+}
+
+void TimerList::AttachToParent(TimerList* parent, TimerMedium parent_time,
+                               TimerMedium local_time) {
+  assert(parent && parent != this);
+  assert(parent_ == nullptr);
+  parent_ = parent;
+  parent_anchor_time_ = parent_time;
+  local_anchor_time_ = local_time;
+  parent_->children_.push_back(this);
+
+  // Our proxy starts out inactive; we'll schedule it as needed.
+  parent_timer_ =
+      parent_->NewTimer(parent_time, -1, 0, -1,
+                        NewLambdaRunnable([this] { RunFromParent(); }).Get());
+  parent_timer_->group_ = this;
+  UpdateParentTimer();
+}
+
+void TimerList::DetachFromParent() {
+  if (!parent_) {
+    return;
+  }
+  auto& siblings = parent_->children_;
+  siblings.erase(std::remove(siblings.begin(), siblings.end(), this),
+                 siblings.end());
+  TimerList* parent = parent_;
+  int parent_timer_id = parent_timer_->id();
+  parent_ = nullptr;
+  parent_timer_ = nullptr;
+  parent->DeleteTimer(parent_timer_id);
+}
+
+auto TimerList::LocalTime(TimerMedium parent_time) const -> TimerMedium {
+  // A detached group's clock stands still; it has nothing to follow.
+  if (!parent_) {
+    return local_anchor_time_;
+  }
+  return local_anchor_time_ + (parent_time - parent_anchor_time_);
+}
+
+auto TimerList::ParentTime(TimerMedium local_time) const -> TimerMedium {
+  assert(parent_);
+  return parent_anchor_time_ + (local_time - local_anchor_time_);
+}
+
+void TimerList::RunFromParent() {
+  assert(parent_ && parent_timer_);
+
+  // Run just our next timer; our proxy then gets rescheduled for the one
+  // after that, so our timers interleave with our parent's (and our
+  // siblings') in expire order. Bail immediately if that timer killed us.
+  if (!RunTimers(LocalTime(parent_timer_->last_run_time_), 1)) {
+    return;
+  }
+  UpdateParentTimer();
+}
+
+void TimerList::UpdateParentTimer() {
+  // While running, our proxy gets updated once we're done.
+  if (!parent_timer_ || running_ || are_clearing_) {
+    return;
+  }
+  if (heap_.empty()) {
+    parent_timer_->SetLength(-1);
+  } else {
+    parent_timer_->SetLength(0, true, ParentTime(heap_.front()->expire_time_));
+  }
+}
+
 Timer::Timer(TimerList* list, int id, TimerMedium current_time,
              TimerMedium length, TimerMedium offset, int repeat_count)
     : list_(list),
@@ -313,6 +469,7 @@ void Timer::SetLength(TimerMedium l, bool set_start_time,
     }
     expire_time_ = last_run_time_ + length_;
     list_->AddTimer(this);
+    list_->UpdateParentTimer();
   } else {
     length_ = l;
     if (set_start_time) {
@@ -4,6 +4,7 @@
 #define BALLISTICA_SHARED_GENERIC_TIMER_LIST_H_
 
 #include <cstdio>
+#include <unordered_map>
 #include <vector>
 
 #include "ballistica/shared/ballistica.h"
@@ -11,6 +12,19 @@
 
 namespace ballistica {
 
+/// A set of timers sharing a timeline.
+///
+/// Active timers are kept in a binary heap ordered by expire time (ties
+/// run in submission order) with an id lookup table alongside, so adding,
+/// finding, and deleting timers stays cheap as lists grow to hundreds of
+/// timers.
+///
+/// A list can also be attached as a group under a parent list. In that
+/// case the whole group is represented in the parent by a single proxy
+/// timer and runs on its own local clock (offset from the parent's), and
+/// the group can be detached and cleared without the parent ever touching
+/// the group's individual timers. Group timers still run interleaved with
+/// the parent's in expire order.
 class TimerList {
  public:
   TimerList();
@@ -38,11 +52,34 @@ class TimerList {
   // Return the active timer count. Note that this does not include the client
   // timer (a timer returned via GetExpiredTimer() but not yet re-submitted).
   auto ActiveTimerCount() const -> int { return timer_count_active_; }
+  auto InactiveTimerCount() const -> int { return timer_count_inactive_; }
+  auto TotalTimerCount() const -> int { return timer_count_total_; }
 
-  auto Empty() -> bool { return (timers_ == nullptr); }
+  auto Empty() -> bool { return heap_.empty(); }
 
   void Clear();
 
+  /// Attach this list as a group under a parent list. Our local time
+  /// starts at the provided value, corresponding to the parent's
+  /// provided current time.
+  void AttachToParent(TimerList* parent, TimerMedium parent_time,
+                      TimerMedium local_time);
+
+  /// Detach from our parent list (if attached).
+  void DetachFromParent();
+
+  /// Return our local time corresponding to a time on our parent's
+  /// timeline. Once detached, this stays at the time we were attached
+  /// at (timers can still be created and deleted but will never fire).
+  auto LocalTime(TimerMedium parent_time) const -> TimerMedium;
+
+  /// Total number of timer fires since this list was created.
+  auto fire_count() const -> int64_t { return fire_count_; }
+
+  /// Total and max wall-clock time spent in timer callbacks.
+  auto fire_time_total() const -> microsecs_t { return fire_time_total_; }
+  auto fire_time_max() const -> microsecs_t { return fire_time_max_; }
+
  private:
   // Returns the next expired timer. When finished with the timer,
   // return it to the list with Timer::submit()
@@ -52,16 +89,36 @@ class TimerList {
   auto PullTimer(int timer_id, bool remove = true) -> Timer*;
   auto SubmitTimer(Timer* t) -> Timer*;
   void AddTimer(Timer* t);
+  void HeapRemove(size_t index);
+  void HeapSiftUp(size_t index);
+  void HeapSiftDown(size_t index);
+  auto HeapLess(const Timer* a, const Timer* b) const -> bool;
+  auto RunTimers(TimerMedium target_time, int count) -> bool;
+  auto ParentTime(TimerMedium local_time) const -> TimerMedium;
+  void RunFromParent();
+  void UpdateParentTimer();
 
   int timer_count_active_{};
   int timer_count_inactive_{};
   int timer_count_total_{};
   Timer* client_timer_{};
-  Timer* timers_{};
-  Timer* timers_inactive_{};
+  std::vector<Timer*> heap_;
+  std::unordered_map<int, Timer*> timers_by_id_;
+  std::vector<size_t> expired_scan_;
   int next_timer_id_{1};
+  uint64_t next_submit_index_{};
   bool running_{};
   bool are_clearing_{};
+  int64_t fire_count_{};
+  microsecs_t fire_time_total_{};
+  microsecs_t fire_time_max_{};
+
+  // Group state (when attached to a parent list).
+  TimerList* parent_{};
+  Timer* parent_timer_{};
+  std::vector<TimerList*> children_;
+  TimerMedium parent_anchor_time_{};
+  TimerMedium local_anchor_time_{};
   friend class Timer;
 };
 
@@ -78,7 +135,6 @@ class Timer {
   virtual ~Timer();
   TimerList* list_{};
   bool on_list_{};
-  Timer* next_{};
   bool initial_{};
   bool dead_{};
   bool list_died_{};
@@ -87,6 +143,13 @@ class Timer {
   int id_{};
   TimerMedium length_{};
   int repeat_count_{};
+
+  // Our position in our list's heap, or -1 if we're inactive.
+  int64_t heap_index_{-1};
+  uint64_t submit_index_{};
+
+  // If we're the proxy for a group attached to our list, the group.
+  TimerList* group_{};
   Object::Ref<Runnable> runnable_;
   friend class TimerList;
 };
@@ -0,0 +1,113 @@
+// Released under the MIT License. See LICENSE for details.
+
+#include "ballistica/shared/generic/worker_pool.h"
+
+#include <algorithm>
+#include <string>
+
+#include "ballistica/core/core.h"
+
+namespace ballistica {
+
+// Note: implicitly using core here so will fail if we use this before core
+// is up.
+using core::g_core;
+
+WorkerPool::WorkerPool(const std::string& name, int thread_count)
+    : name_(name) {
+  assert(thread_count >= 0);
+  threads_.reserve(static_cast<size_t>(thread_count));
+  for (int i = 0; i < thread_count; ++i) {
+    threads_.emplace_back(&WorkerPool::ThreadMain_, this, i);
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    std::scoped_lock lock(mutex_);
+    shutting_down_ = true;
+  }
+  work_cv_.notify_all();
+  for (auto&& thread : threads_) {
+    thread.join();
+  }
+}
+
+auto WorkerPool::DefaultThreadCount(int max) -> int {
+  auto hardware_threads = static_cast<int>(std::thread::hardware_concurrency());
+  return std::clamp(hardware_threads - 1, 0, max);
+}
+
+void WorkerPool::ThreadMain_(int index) {
+  g_core->RegisterThread(name_ + std::to_string(index + 1));
+  uint32_t last_generation{};
+  while (true) {
+    const std::function<void(int)>* call;
+    int count;
+    {
+      std::unique_lock lock(mutex_);
+      work_cv_.wait(lock, [this, last_generation] {
+        return shutting_down_ || generation_ != last_generation;
+      });
+      if (shutting_down_) {
+        break;
+      }
+      last_generation = generation_;
+      call = call_;
+      count = count_;
+    }
+    RunItems_(call, last_generation, count);
+  }
+  g_core->UnregisterThread();
+}
+
+void WorkerPool::RunItems_(const std::function<void(int)>* call,
+                           uint32_t generation, int count) {
+  uint64_t item = next_item_.load();
+  while (true) {
+    if (static_cast<uint32_t>(item >> 32) != generation
+        || static_cast<int>(item & 0xFFFFFFFF) >= count) {
+      return;
+    }
+    if (!next_item_.compare_exchange_weak(item, item + 1)) {
+      continue;
+    }
+    // Once we've claimed an item, our batch can't finish until we're done
+    // with it, so the call is still valid here.
+    (*call)(static_cast<int>(item & 0xFFFFFFFF));
+    if (done_count_.fetch_add(1) + 1 == count) {
+      // Grab the lock so we can't notify between the caller checking
+      // and going to sleep.
+      std::scoped_lock lock(mutex_);
+      done_cv_.notify_one();
+    }
+    item = next_item_.load();
+  }
+}
+
+void WorkerPool::ParallelFor(int count, const std::function<void(int)>& call) {
+  // Not worth waking anyone up for a single item.
+  if (threads_.empty() || count <= 1) {
+    for (int i = 0; i < count; ++i) {
+      call(i);
+    }
+    return;
+  }
+  uint32_t generation;
+  {
+    std::scoped_lock lock(mutex_);
+    generation = ++generation_;
+    call_ = &call;
+    count_ = count;
+    done_count_ = 0;
+    next_item_ = static_cast<uint64_t>(generation) << 32;
+  }
+  work_cv_.notify_all();
+  RunItems_(&call, generation, count);
+
+  std::unique_lock lock(mutex_);
+  done_cv_.wait(lock, [this, count] { return done_count_ == count; });
+  call_ = nullptr;
+}
+
+}  // namespace ballistica
@@ -0,0 +1,68 @@
+// Released under the MIT License. See LICENSE for details.
+
+#ifndef BALLISTICA_SHARED_GENERIC_WORKER_POOL_H_
+#define BALLISTICA_SHARED_GENERIC_WORKER_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ballistica/shared/ballistica.h"
+
+namespace ballistica {
+
+/// A small set of threads for splitting a batch of independent work items
+/// across cores. Unlike EventLoops these have no message queues; the
+/// calling thread hands out a batch, works on it alongside the pool, and
+/// blocks until the whole batch is done.
+class WorkerPool {
+ public:
+  /// Create a pool with the provided number of worker threads (in addition
+  /// to whichever thread calls ParallelFor()).
+  WorkerPool(const std::string& name, int thread_count);
+  ~WorkerPool();
+
+  /// Run call(i) for each i in [0, count) across the pool and the calling
+  /// thread, returning once all calls have completed. Items may run in any
+  /// order on any thread, so calls must only touch state of their own.
+  /// Exceptions must not escape calls. Only one thread should use a pool
+  /// at a time.
+  void ParallelFor(int count, const std::function<void(int)>& call);
+
+  auto thread_count() const -> int {
+    return static_cast<int>(threads_.size());
+  }
+
+  /// A sensible worker count for this machine: one less than the number
+  /// of hardware threads (leaving one for the caller), capped at max.
+  static auto DefaultThreadCount(int max) -> int;
+
+ private:
+  void ThreadMain_(int index);
+  void RunItems_(const std::function<void(int)>* call, uint32_t generation,
+                 int count);
+
+  std::string name_;
+  std::vector<std::thread> threads_;
+  std::mutex mutex_;
+  std::condition_variable work_cv_;
+  std::condition_variable done_cv_;
+  const std::function<void(int)>* call_{};
+  int count_{};
+  uint32_t generation_{};
+
+  // Batch generation in the high 32 bits and next unclaimed item in the
+  // low 32, so a worker still holding a finished batch can never claim
+  // items from the next one.
+  std::atomic<uint64_t> next_item_{};
+  std::atomic<int> done_count_{};
+  bool shutting_down_{};
+};
+
+}  // namespace ballistica
+
+#endif  // BALLISTICA_SHARED_GENERIC_WORKER_POOL_H_
@@ -2285,6 +2285,239 @@ static PyMethodDef PyTextWidgetDef = {
     "are applied to the Widget.",
 };
 
+// ----------------------------- editwidgets -----------------------------------
+
+static auto GetColor3(PyObject* obj, const char* name) -> std::vector<float> {
+  std::vector<float> c = Python::GetPyFloats(obj);
+  if (c.size() != 3) {
+    throw Exception(std::string("Expected 3 floats for ") + name + ".",
+                    PyExcType::kValue);
+  }
+  return c;
+}
+
+static auto GetColor3or4(PyObject* obj, const char* name)
+    -> std::vector<float> {
+  std::vector<float> c = Python::GetPyFloats(obj);
+  if (c.size() == 3) {
+    c.push_back(1.0f);
+  } else if (c.size() != 4) {
+    throw Exception(std::string("Expected 3 or 4 floats for ") + name + ".",
+                    PyExcType::kValue);
+  }
+  return c;
+}
+
+static void ThrowUnsupportedEditProperty(Widget* widget, const char* name) {
+  throw Exception("Unsupported property '" + std::string(name)
+                      + "' for editwidgets() on " + widget->GetWidgetTypeName()
+                      + " widget.",
+                  PyExcType::kValue);
+}
+
+// These mirror the equivalent keyword args to textwidget() & co.
+static void EditTextWidget(TextWidget* widget, const char* name,
+                           PyObject* value) {
+  if (!strcmp(name, "text")) {
+    widget->SetText(g_base->python->GetPyLString(value));
+  } else if (!strcmp(name, "color")) {
+    auto c = GetColor3or4(value, "color");
+    widget->set_color(c[0], c[1], c[2], c[3]);
+  } else if (!strcmp(name, "position")) {
+    Point2D p = Python::GetPyPoint2D(value);
+    widget->set_translate(p.x, p.y);
+  } else if (!strcmp(name, "size")) {
+    Point2D p = Python::GetPyPoint2D(value);
+    widget->SetWidth(p.x);
+    widget->SetHeight(p.y);
+  } else if (!strcmp(name, "scale")) {
+    widget->set_center_scale(Python::GetPyFloat(value));
+  } else if (!strcmp(name, "maxwidth")) {
+    widget->set_max_width(Python::GetPyFloat(value));
+  } else if (!strcmp(name, "max_height")) {
+    widget->set_max_height(Python::GetPyFloat(value));
+  } else if (!strcmp(name, "flatness")) {
+    widget->set_flatness(Python::GetPyFloat(value));
+  } else if (!strcmp(name, "shadow")) {
+    widget->set_shadow(Python::GetPyFloat(value));
+  } else if (!strcmp(name, "rotate")) {
+    widget->set_rotate(Python::GetPyFloat(value));
+  } else if (!strcmp(name, "enabled")) {
+    widget->SetEnabled(Python::GetPyBool(value));
+  } else {
+    ThrowUnsupportedEditProperty(widget, name);
+  }
+}
+
+static void EditButtonWidget(ButtonWidget* widget, const char* name,
+                             PyObject* value) {
+  if (!strcmp(name, "label")) {
+    widget->set_text(g_base->python->GetPyLString(value));
+  } else if (!strcmp(name, "color")) {
+    auto c = GetColor3(value, "color");
+    widget->SetColor(c[0], c[1], c[2]);
+  } else if (!strcmp(name, "textcolor")) {
+    auto c = GetColor3or4(value, "textcolor");
+    widget->set_text_color(c[0], c[1], c[2], c[3]);
+  } else if (!strcmp(name, "position")) {
+    Point2D p = Python::GetPyPoint2D(value);
+    widget->set_translate(p.x, p.y);
+  } else if (!strcmp(name, "size")) {
+    Point2D p = Python::GetPyPoint2D(value);
+    widget->set_width(p.x);
+    widget->set_height(p.y);
+  } else if (!strcmp(name, "scale")) {
+    widget->set_scale(Python::GetPyFloat(value));
+  } else if (!strcmp(name, "text_scale")) {
+    widget->set_text_scale(Python::GetPyFloat(value));
+  } else if (!strcmp(name, "texture")) {
+    widget->SetTexture(&PythonClassUITexture::FromPyObj(value).texture());
+  } else {
+    ThrowUnsupportedEditProperty(widget, name);
+  }
+}
+
+static void EditImageWidget(ImageWidget* widget, const char* name,
+                            PyObject* value) {
+  if (!strcmp(name, "texture")) {
+    widget->SetTexture(&PythonClassUITexture::FromPyObj(value).texture());
+  } else if (!strcmp(name, "color")) {
+    auto c = GetColor3(value, "color");
+    widget->set_color(c[0], c[1], c[2]);
+  } else if (!strcmp(name, "opacity")) {
+    widget->set_opacity(Python::GetPyFloat(value));
+  } else if (!strcmp(name, "position")) {
+    Point2D p = Python::GetPyPoint2D(value);
+    widget->set_translate(p.x, p.y);
+  } else if (!strcmp(name, "size")) {
+    Point2D p = Python::GetPyPoint2D(value);
+    widget->set_width(p.x);
+    widget->set_height(p.y);
+  } else if (!strcmp(name, "tint_color")) {
+    auto c = GetColor3(value, "tint_color");
+    widget->set_tint_color(c[0], c[1], c[2]);
+  } else if (!strcmp(name, "tint2_color")) {
+    auto c = GetColor3(value, "tint2_color");
+    widget->set_tint2_color(c[0], c[1], c[2]);
+  } else if (!strcmp(name, "radial_amount")) {
+    widget->set_radial_amount(Python::GetPyFloat(value));
+  } else if (!strcmp(name, "tilt_scale")) {
+    widget->set_tilt_scale(Python::GetPyFloat(value));
+  } else {
+    ThrowUnsupportedEditProperty(widget, name);
+  }
+}
+
+static auto PyEditWidgets(PyObject* self, PyObject* args,
+                          PyObject* keywds) -> PyObject* {
+  BA_PYTHON_TRY;
+  PyObject* updates_obj;
+  static const char* kwlist[] = {"updates", nullptr};
+  if (!PyArg_ParseTupleAndKeywords(args, keywds, "O",
+                                   const_cast<char**>(kwlist), &updates_obj)) {
+    return nullptr;
+  }
+
+  if (!g_base->CurrentContext().IsEmpty()) {
+    throw Exception("UI functions must be called with no context set.");
+  }
+  if (!PySequence_Check(updates_obj)) {
+    throw Exception("Expected a sequence of (widget, dict) pairs.",
+                    PyExcType::kType);
+  }
+
+  // Gather up any user code triggered by this stuff and run it once the
+  // whole batch has been applied. Layout is already lazy (containers just
+  // get marked for update), so that happens once at the next draw too.
+  base::UI::OperationContext ui_op_context;
+
+  PythonRef updates(PySequence_Fast(updates_obj, "Not a sequence."),
+                    PythonRef::kSteal);
+  assert(updates.Exists());
+  Py_ssize_t update_count = PySequence_Fast_GET_SIZE(updates.Get());
+  PyObject** update_objs = PySequence_Fast_ITEMS(updates.Get());
+  for (Py_ssize_t i = 0; i < update_count; ++i) {
+    PyObject* update = update_objs[i];
+    if (!PyTuple_Check(update) || PyTuple_GET_SIZE(update) != 2
+        || !PyDict_Check(PyTuple_GET_ITEM(update, 1))) {
+      throw Exception("Expected a sequence of (widget, dict) pairs.",
+                      PyExcType::kType);
+    }
+    Widget* widget = UIV1Python::GetPyWidget(PyTuple_GET_ITEM(update, 0));
+    if (widget == nullptr) {
+      throw Exception("Invalid or nonexistent widget.",
+                      PyExcType::kWidgetNotFound);
+    }
+    auto* text_widget = dynamic_cast<TextWidget*>(widget);
+    auto* button_widget =
+        text_widget ? nullptr : dynamic_cast<ButtonWidget*>(widget);
+    auto* image_widget = (text_widget || button_widget)
+                             ? nullptr
+                             : dynamic_cast<ImageWidget*>(widget);
+    if (!text_widget && !button_widget && !image_widget) {
+      throw Exception("editwidgets() only supports text, button, and image"
+                      " widgets; got "
+                          + widget->GetWidgetTypeName() + ".",
+                      PyExcType::kType);
+    }
+    PyObject* key;
+    PyObject* value;
+    Py_ssize_t pos{};
+    while (PyDict_Next(PyTuple_GET_ITEM(update, 1), &pos, &key, &value)) {
+      // As with the individual calls, None means leave as is.
+      if (value == Py_None) {
+        continue;
+      }
+      const char* name = PyUnicode_Check(key) ? PyUnicode_AsUTF8(key) : nullptr;
+      if (name == nullptr) {
+        throw Exception("Property names must be strings.", PyExcType::kType);
+      }
+      if (text_widget) {
+        EditTextWidget(text_widget, name, value);
+      } else if (button_widget) {
+        EditButtonWidget(button_widget, name, value);
+      } else {
+        EditImageWidget(image_widget, name, value);
+      }
+    }
+  }
+
+  // Run any calls built up by UI callbacks.
+  ui_op_context.Finish();
+
+  Py_RETURN_NONE;
+  BA_PYTHON_CATCH;
+}
+
+static PyMethodDef PyEditWidgetsDef = {
+    "editwidgets",                 // name
+    (PyCFunction)PyEditWidgets,    // method
+    METH_VARARGS | METH_KEYWORDS,  // flags
+
+    "editwidgets(updates: Sequence[tuple[bauiv1.Widget, dict[str, Any]]])\n"
+    "  -> None\n"
+    "\n"
+    "Apply property changes to many widgets in a single call.\n"
+    "\n"
+    "Category: **User Interface Functions**\n"
+    "\n"
+    "Each entry pairs a text, button, or image widget with a dict of\n"
+    "property values, which are applied just as the equivalent keyword\n"
+    "arguments to bauiv1.textwidget(), bauiv1.buttonwidget() or\n"
+    "bauiv1.imagewidget() would be (None values are ignored). This is much\n"
+    "cheaper than individual calls when refreshing large numbers of\n"
+    "widgets. Supported properties:\n"
+    "\n"
+    "text: text, color, position, size, scale, maxwidth, max_height,\n"
+    "  flatness, shadow, rotate, enabled\n"
+    "\n"
+    "button: label, color, textcolor, position, size, scale, text_scale,\n"
+    "  texture\n"
+    "\n"
+    "image: texture, color, opacity, position, size, tint_color,\n"
+    "  tint2_color, radial_amount, tilt_scale",
+};
+
 // ------------------------------- widget --------------------------------------
 
 static auto PyWidgetCall(PyObject* self, PyObject* args,
@@ -2667,6 +2900,7 @@ auto PythonMethodsUIV1::GetMethods() -> std::vector<PyMethodDef> {
       PyScrollWidgetDef,
       PyHScrollWidgetDef,
       PyTextWidgetDef,
+      PyEditWidgetsDef,
       PyWidgetDef,
       PyUIBoundsDef,
       PyGetSoundDef,
@@ -64,7 +64,7 @@ OPCODECREATE::OPCODECREATE()
  *	Constructor.
  */
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-BaseModel::BaseModel() : mIMesh(null), mModelCode(0), mSource(null), mTree(null)
+BaseModel::BaseModel() : mIMesh(null), mModelCode(0), mSource(null), mTree(null), mOwnsTree(true)
 {
 }
 
@@ -86,7 +86,24 @@ BaseModel::~BaseModel()
 void BaseModel::ReleaseBase()
 {
 	DELETESINGLE(mSource);
-	DELETESINGLE(mTree);
+	// ballistica addition: shared trees belong to their source model.
+	if(mOwnsTree)	DELETESINGLE(mTree);
+	mTree = null;
+	mOwnsTree = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ *	Uses another model's optimized tree instead of building our own.
+ *	\param		source		[in] model whose tree we share
+ */
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void BaseModel::ShareTree(const BaseModel& source)
+{
+	ReleaseBase();
+	mModelCode	= source.mModelCode;
+	mTree		= source.mTree;
+	mOwnsTree	= false;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -99,7 +116,9 @@ void BaseModel::ReleaseBase()
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 bool BaseModel::CreateTree(bool no_leaf, bool quantized)
 {
-	DELETESINGLE(mTree);
+	if(mOwnsTree)	DELETESINGLE(mTree);
+	mTree = null;
+	mOwnsTree = true;
 
 	// Setup model code
 	if(no_leaf)		mModelCode |= OPC_NO_LEAF;
@@ -134,6 +153,9 @@ bool BaseModel::CreateTree(bool no_leaf, bool quantized)
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 bool BaseModel::Refit()
 {
+	// Shared trees are immutable.
+	if(!mOwnsTree)	return false;
+
 	// Refit the optimized tree
 	return mTree->Refit(mIMesh);
 
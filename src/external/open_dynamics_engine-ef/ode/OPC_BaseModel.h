@@ -162,11 +162,22 @@
 		///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		inline_			void				SetMeshInterface(MeshInterface* imesh)	{ mIMesh = imesh;	}
 
+		// ballistica addition: tree sharing.
+		///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/**
+		 *	Uses another model's optimized tree instead of building our own. The tree is not
+		 *	owned by us and must not be refit; the source model must outlive this one.
+		 *	\param		source		[in] model whose tree we share
+		 */
+		///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+						void				ShareTree(const BaseModel& source);
+
 		protected:
 				MeshInterface*		mIMesh;			//!< User-defined mesh interface
 						udword				mModelCode;		//!< Model code = combination of ModelFlag(s)
 						AABBTree*			mSource;		//!< Original source tree
 						AABBOptimizedTree*	mTree;			//!< Optimized tree owned by the model
+						bool				mOwnsTree;		//!< false if mTree is shared with another model
 		// Internal methods
 						void				ReleaseBase();
 						bool				CreateTree(bool no_leaf, bool quantized);
@@ -217,6 +217,35 @@ bool Model::Build(const OPCODECREATE& create)
 	return true;
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ *	Sets up a no-leaf model from a previously serialized tree.
+ *	\param		imesh		[in] mesh interface
+ *	\param		quantized	[in] whether the serialized tree is quantized
+ *	\param		data		[in] serialized tree data
+ *	\param		size		[in] size of serialized data in bytes
+ *	\return		true if success
+ */
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool Model::Load(MeshInterface* imesh, bool quantized, const void* data, udword size)
+{
+	if(!imesh || !imesh->IsValid() || !data)	return false;
+
+	// Single-triangle meshes have no tree; just build those.
+	udword NbTris = imesh->GetNbTriangles();
+	if(NbTris<2)	return false;
+
+	Release();
+	SetMeshInterface(imesh);
+	if(!CreateTree(true, quantized))	return false;
+	if(!mTree->Deserialize((const ubyte*)data, size, NbTris))
+	{
+		Release();
+		return false;
+	}
+	return true;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /**
  *	Gets the number of bytes used by the tree.
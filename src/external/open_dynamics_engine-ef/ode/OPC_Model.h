@@ -36,6 +36,20 @@
 		///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		override(BaseModel)	bool				Build(const OPCODECREATE& create);
 
+		// ballistica addition: cached trees.
+		///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/**
+		 *	Sets up a no-leaf model from a tree previously written by AABBOptimizedTree::Serialize()
+		 *	instead of building one.
+		 *	\param		imesh		[in] mesh interface (must match the mesh the tree was built for)
+		 *	\param		quantized	[in] whether the serialized tree is quantized
+		 *	\param		data		[in] serialized tree data
+		 *	\param		size		[in] size of serialized data in bytes
+		 *	\return		true if success
+		 */
+		///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+							bool				Load(MeshInterface* imesh, bool quantized, const void* data, udword size);
+
 #ifdef __MESHMERIZER_H__
 		///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/**
@@ -796,3 +796,158 @@ bool AABBQuantizedNoLeafTree::Walk(GenericWalkingCallback callback, void* user_d
 	Local::_Walk(mNodes, callback, user_data);
 	return true;
 }
+
+
+// ballistica addition: (de)serialization of no-leaf trees.
+//
+// Layout: node count, then (for quantized trees) the dequantization
+// coefficients, then per node its raw box followed by two udwords for
+// its children; each is either (primitive<<1)|1 for a leaf or
+// (node_index<<1) for an internal node. Data is native-endian; callers
+// are expected to validate it with their own header.
+
+template<class NodeType, class VolumeType>
+static udword _SerializeNoLeafNodes(const NodeType* nodes, udword nb_nodes, ubyte* buffer)
+{
+	const udword NodeSize = sizeof(VolumeType) + sizeof(udword)*2;
+	if(buffer)
+	{
+		for(udword i=0;i<nb_nodes;i++)
+		{
+			const NodeType& Current = nodes[i];
+			udword Pos = Current.HasPosLeaf() ? udword(Current.mPosData) : udword(Current.GetPos()-nodes)<<1;
+			udword Neg = Current.HasNegLeaf() ? udword(Current.mNegData) : udword(Current.GetNeg()-nodes)<<1;
+			CopyMemory(buffer, &Current.mAABB, sizeof(VolumeType));
+			CopyMemory(buffer+sizeof(VolumeType), &Pos, sizeof(udword));
+			CopyMemory(buffer+sizeof(VolumeType)+sizeof(udword), &Neg, sizeof(udword));
+			buffer += NodeSize;
+		}
+	}
+	return nb_nodes*NodeSize;
+}
+
+template<class NodeType, class VolumeType>
+static bool _DeserializeNoLeafNodes(NodeType* nodes, udword nb_nodes, const ubyte* data, udword nb_primitives)
+{
+	const udword NodeSize = sizeof(VolumeType) + sizeof(udword)*2;
+	for(udword i=0;i<nb_nodes;i++)
+	{
+		NodeType& Current = nodes[i];
+		udword Children[2];
+		CopyMemory(&Current.mAABB, data, sizeof(VolumeType));
+		CopyMemory(Children, data+sizeof(VolumeType), sizeof(udword)*2);
+		data += NodeSize;
+		size_t* Dst[2] = { &Current.mPosData, &Current.mNegData };
+		for(udword j=0;j<2;j++)
+		{
+			udword Index = Children[j]>>1;
+			if(Children[j]&1)
+			{
+				if(Index>=nb_primitives)	return false;
+				*Dst[j] = Children[j];
+			}
+			else
+			{
+				// Children always come after their parents.
+				if(Index<=i || Index>=nb_nodes)	return false;
+				*Dst[j] = size_t(&nodes[Index]);
+			}
+		}
+	}
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ *	Serializes the tree.
+ *	\param		buffer		[out] destination buffer (or null to just compute the size)
+ *	\return		serialized size in bytes
+ */
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+udword AABBNoLeafTree::Serialize(ubyte* buffer) const
+{
+	if(buffer)	CopyMemory(buffer, &mNbNodes, sizeof(udword));
+	return sizeof(udword) + _SerializeNoLeafNodes<AABBNoLeafNode, CollisionAABB>(mNodes, mNbNodes, buffer ? buffer+sizeof(udword) : null);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ *	Sets up the tree from serialized data.
+ *	\param		data			[in] serialized data
+ *	\param		size			[in] size of serialized data in bytes
+ *	\param		nb_primitives	[in] number of primitives in the mesh
+ *	\return		true if success
+ */
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool AABBNoLeafTree::Deserialize(const ubyte* data, udword size, udword nb_primitives)
+{
+	if(!data || size<sizeof(udword))	return false;
+	udword NbNodes;
+	CopyMemory(&NbNodes, data, sizeof(udword));
+	if(NbNodes!=nb_primitives-1)	return false;
+	if(size!=sizeof(udword) + NbNodes*(sizeof(CollisionAABB) + sizeof(udword)*2))	return false;
+
+	DELETEARRAY(mNodes);
+	mNbNodes = NbNodes;
+	mNodes = new AABBNoLeafNode[mNbNodes];
+	CHECKALLOC(mNodes);
+	if(!_DeserializeNoLeafNodes<AABBNoLeafNode, CollisionAABB>(mNodes, mNbNodes, data+sizeof(udword), nb_primitives))
+	{
+		DELETEARRAY(mNodes);
+		mNbNodes = 0;
+		return false;
+	}
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ *	Serializes the tree.
+ *	\param		buffer		[out] destination buffer (or null to just compute the size)
+ *	\return		serialized size in bytes
+ */
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+udword AABBQuantizedNoLeafTree::Serialize(ubyte* buffer) const
+{
+	const udword HeaderSize = sizeof(udword) + sizeof(Point)*2;
+	if(buffer)
+	{
+		CopyMemory(buffer, &mNbNodes, sizeof(udword));
+		CopyMemory(buffer+sizeof(udword), &mCenterCoeff, sizeof(Point));
+		CopyMemory(buffer+sizeof(udword)+sizeof(Point), &mExtentsCoeff, sizeof(Point));
+	}
+	return HeaderSize + _SerializeNoLeafNodes<AABBQuantizedNoLeafNode, QuantizedAABB>(mNodes, mNbNodes, buffer ? buffer+HeaderSize : null);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ *	Sets up the tree from serialized data.
+ *	\param		data			[in] serialized data
+ *	\param		size			[in] size of serialized data in bytes
+ *	\param		nb_primitives	[in] number of primitives in the mesh
+ *	\return		true if success
+ */
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool AABBQuantizedNoLeafTree::Deserialize(const ubyte* data, udword size, udword nb_primitives)
+{
+	const udword HeaderSize = sizeof(udword) + sizeof(Point)*2;
+	if(!data || size<HeaderSize)	return false;
+	udword NbNodes;
+	CopyMemory(&NbNodes, data, sizeof(udword));
+	if(NbNodes!=nb_primitives-1)	return false;
+	if(size!=HeaderSize + NbNodes*(sizeof(QuantizedAABB) + sizeof(udword)*2))	return false;
+
+	DELETEARRAY(mNodes);
+	mNbNodes = NbNodes;
+	CopyMemory(&mCenterCoeff, data+sizeof(udword), sizeof(Point));
+	CopyMemory(&mExtentsCoeff, data+sizeof(udword)+sizeof(Point), sizeof(Point));
+	mNodes = new AABBQuantizedNoLeafNode[mNbNodes];
+	CHECKALLOC(mNodes);
+	if(!_DeserializeNoLeafNodes<AABBQuantizedNoLeafNode, QuantizedAABB>(mNodes, mNbNodes, data+HeaderSize, nb_primitives))
+	{
+		DELETEARRAY(mNodes);
+		mNbNodes = 0;
+		return false;
+	}
+	return true;
+}
@@ -174,6 +174,12 @@
 		virtual			udword				GetUsedBytes()		const										= 0;
 		inline_			udword				GetNbNodes()		const						{ return mNbNodes;	}
 
+		// ballistica addition: raw (de)serialization so built trees can be cached.
+		// Only no-leaf trees support this; others return 0/false.
+		// Serialize() returns the serialized size and writes to buffer if it is non-null.
+		virtual			udword				Serialize(ubyte*)	const								{ return 0;		}
+		virtual			bool				Deserialize(const ubyte*, udword, udword)				{ return false;	}
+
 		protected:
 						udword				mNbNodes;
 	};
@@ -186,6 +192,11 @@
 	class OPCODE_API AABBNoLeafTree : public AABBOptimizedTree
 	{
 		IMPLEMENT_COLLISION_TREE(AABBNoLeafTree, AABBNoLeafNode)
+
+		public:
+		// ballistica addition
+		override(AABBOptimizedTree)	udword			Serialize(ubyte* buffer)	const;
+		override(AABBOptimizedTree)	bool			Deserialize(const ubyte* data, udword size, udword nb_primitives);
 	};
 
 	class OPCODE_API AABBQuantizedTree : public AABBOptimizedTree
@@ -202,6 +213,10 @@
 		IMPLEMENT_COLLISION_TREE(AABBQuantizedNoLeafTree, AABBQuantizedNoLeafNode)
 
 		public:
+		// ballistica addition
+		override(AABBOptimizedTree)	udword			Serialize(ubyte* buffer)	const;
+		override(AABBOptimizedTree)	bool			Deserialize(const ubyte* data, udword size, udword nb_primitives);
+
 						Point				mCenterCoeff;
 						Point				mExtentsCoeff;
 	};
@@ -381,6 +381,7 @@ dxBody *dBodyCreate (dxWorld *w)
   b->invI[0] = 1;
   b->invI[5] = 1;
   b->invI[10] = 1;
+  b->serial = ++w->next_body_serial;
   b->invMass = 1;
   dSetZero (b->pos,4);
   dSetZero (b->q,4);
@@ -1449,6 +1450,12 @@ dxWorld * dWorldCreate()
 
   w->qs.num_iterations = 20;
   w->qs.w = REAL(1.3);
+  w->qs.warm_starting = 0;
+  w->qs.tolerance = 0;
+  w->qs.min_iterations = 0;
+  memset (&w->qs_stats,0,sizeof(w->qs_stats));
+  w->contact_cache = 0;
+  w->next_body_serial = 0;
 
   w->contactp.max_vel = dInfinity;
   w->contactp.min_depth = 0;
@@ -1484,6 +1491,7 @@ void dWorldDestroy (dxWorld *w)
     }
     j = nextj;
   }
+  dxQuickStepDestroyCache (w);
   delete w;
 }
 
@@ -1544,6 +1552,7 @@ void dWorldStep (dWorldID w, dReal stepsize)
 void dWorldQuickStep (dWorldID w, dReal stepsize) {
   dUASSERT (w,"bad world argument");
   dUASSERT (stepsize > 0,"stepsize must be > 0");
+  dxQuickStepBegin (w);
   dxProcessIslands (w,stepsize,&dxQuickStepper);
 }
 
@@ -1690,6 +1699,45 @@ dReal dWorldGetQuickStepW (dWorldID w)
 }
 
 
+void dWorldSetQuickStepWarmStarting (dWorldID w, int enabled)
+{
+	dAASSERT(w);
+	w->qs.warm_starting = (enabled != 0);
+	if (!enabled) dxQuickStepDestroyCache (w);
+}
+
+
+int dWorldGetQuickStepWarmStarting (dWorldID w)
+{
+	dAASSERT(w);
+	return w->qs.warm_starting;
+}
+
+
+void dWorldSetQuickStepTolerance (dWorldID w, dReal tolerance,
+				  int min_iterations)
+{
+	dAASSERT(w);
+	dUASSERT (tolerance >= 0,"tolerance must be >= 0");
+	w->qs.tolerance = tolerance;
+	w->qs.min_iterations = min_iterations;
+}
+
+
+dReal dWorldGetQuickStepTolerance (dWorldID w)
+{
+	dAASSERT(w);
+	return w->qs.tolerance;
+}
+
+
+void dWorldGetQuickStepStats (dWorldID w, dQuickStepStats *stats)
+{
+	dAASSERT(w && stats);
+	*stats = w->qs_stats;
+}
+
+
 void dWorldSetContactMaxCorrectingVel (dWorldID w, dReal vel)
 {
 	dAASSERT(w);
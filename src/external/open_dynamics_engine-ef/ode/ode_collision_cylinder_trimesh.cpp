@@ -942,7 +942,8 @@ int dCollideCylinderTrimesh(dxGeom *o1, dxGeom *o2, int flags, dContactGeom *con
 
 	_InitCylinderTrimeshData(cData);
 
-  OBBCollider& Collider{cData.gTrimesh->_OBBCollider};
+  dxTriMesh::Colliders& Colliders{dxTriMesh::GetColliders()};
+  OBBCollider& Collider{Colliders.OBB};
 
 	Point cCenter(cData.vCylinderPos[0],cData.vCylinderPos[1],cData.vCylinderPos[2]);
 
@@ -1000,7 +1001,7 @@ int dCollideCylinderTrimesh(dxGeom *o1, dxGeom *o2, int flags, dContactGeom *con
 	{
 		Collider.SetTemporalCoherence(false);
 		//Collider.Collide(dxTriMesh::defaultBoxCache, obbCCylinder, cData.gTrimesh->Data->BVTree, null,&MeshMatrix);
-		Collider.Collide(cData.gTrimesh->boxCache, obbCCylinder, cData.gTrimesh->Data->BVTree, null,&MeshMatrix);
+		Collider.Collide(Colliders.DefaultBoxCache, obbCCylinder, cData.gTrimesh->Data->BVTree, null,&MeshMatrix);
 	}
 
 	// Retrieve data
@@ -54,11 +54,25 @@ dxTriMeshData::Build(const void* Vertices, int VertexStide, int VertexCount,
 		     const void* Indices, int IndexCount, int TriStride,
 		     const void* in_Normals,
 		     bool Single){
-	Mesh.SetNbTriangles(IndexCount / 3);
-	Mesh.SetNbVertices(VertexCount);
-	Mesh.SetPointers((IndexedTriangle*)Indices, (Point*)Vertices);
-	Mesh.SetStrides(TriStride, VertexStide);
-	Mesh.Single = Single;
+	Build2(Vertices, VertexStide, VertexCount, Indices, IndexCount, TriStride,
+	       in_Normals, Single, false, NULL, 0);
+}
+
+// ballistica addition: split out of Build() so the tree can be
+// quantized, loaded from a cache, or shared with another data.
+bool
+dxTriMeshData::Build2(const void* Vertices, int VertexStide, int VertexCount,
+		      const void* Indices, int IndexCount, int TriStride,
+		      const void* in_Normals,
+		      bool Single, bool Quantized,
+		      const void* TreeData, int TreeDataSize){
+	SetupMesh(Vertices, VertexStide, VertexCount, Indices, IndexCount,
+		  TriStride, in_Normals, Single);
+
+	if (TreeData && TreeDataSize > 0
+	    && BVTree.Load(&Mesh, Quantized, TreeData, (udword)TreeDataSize)) {
+		return true;
+	}
 
 	// Build tree
 	BuildSettings Settings;
@@ -76,7 +90,7 @@ dxTriMeshData::Build(const void* Vertices, int VertexStide, int VertexCount,
 
 	TreeBuilder.mSettings = Settings;
 	TreeBuilder.mNoLeaf = true;
-	TreeBuilder.mQuantized = false;
+	TreeBuilder.mQuantized = Quantized;
 
 	TreeBuilder.mKeepOriginal = false;
 	TreeBuilder.mCanRemap = false;
@@ -84,6 +98,33 @@ dxTriMeshData::Build(const void* Vertices, int VertexStide, int VertexCount,
 
 
 	BVTree.Build(TreeBuilder);
+	return false;
+}
+
+void
+dxTriMeshData::BuildShared(const dxTriMeshData* Source){
+	Mesh = Source->Mesh;
+	BVTree.ShareTree(Source->BVTree);
+	BVTree.SetMeshInterface(&Mesh);
+	for (int i=0; i<3; i++) {
+		AABBCenter[i] = Source->AABBCenter[i];
+		AABBExtents[i] = Source->AABBExtents[i];
+	}
+	for (int i=0; i<16; i++)
+		last_trans[i] = 0.0;
+	Normals = Source->Normals;
+}
+
+void
+dxTriMeshData::SetupMesh(const void* Vertices, int VertexStide, int VertexCount,
+			 const void* Indices, int IndexCount, int TriStride,
+			 const void* in_Normals,
+			 bool Single){
+	Mesh.SetNbTriangles(IndexCount / 3);
+	Mesh.SetNbVertices(VertexCount);
+	Mesh.SetPointers((IndexedTriangle*)Indices, (Point*)Vertices);
+	Mesh.SetStrides(TriStride, VertexStide);
+	Mesh.Single = Single;
 
 	// compute model space AABB
 	dVector3 AABBMax, AABBMin;
@@ -198,6 +239,57 @@ void dGeomTriMeshDataBuildSingle1(dTriMeshDataID g,
 }
 
 
+int dGeomTriMeshDataBuildSingle2(dTriMeshDataID g,
+                                 const void* Vertices, int VertexStride, int VertexCount,
+                                 const void* Indices, int IndexCount, int TriStride,
+                                 const void* Normals, int Quantized,
+                                 const void* TreeData, int TreeDataSize)
+{
+    dUASSERT(g, "argument not trimesh data");
+
+    return g->Build2(Vertices, VertexStride, VertexCount,
+                     Indices, IndexCount, TriStride,
+                     Normals,
+                     true, Quantized != 0, TreeData, TreeDataSize) ? 1 : 0;
+}
+
+
+int dGeomTriMeshDataBuildDouble2(dTriMeshDataID g,
+                                 const void* Vertices, int VertexStride, int VertexCount,
+                                 const void* Indices, int IndexCount, int TriStride,
+                                 const void* Normals, int Quantized,
+                                 const void* TreeData, int TreeDataSize)
+{
+    dUASSERT(g, "argument not trimesh data");
+
+    return g->Build2(Vertices, VertexStride, VertexCount,
+                     Indices, IndexCount, TriStride,
+                     Normals,
+                     false, Quantized != 0, TreeData, TreeDataSize) ? 1 : 0;
+}
+
+
+int dGeomTriMeshDataGetTreeData(dTriMeshDataID g, void* Buffer)
+{
+    dUASSERT(g, "argument not trimesh data");
+
+    const AABBOptimizedTree* Tree = g->BVTree.GetTree();
+    if (!Tree || g->BVTree.HasLeafNodes()) {
+        return 0;
+    }
+    return (int)Tree->Serialize((ubyte*)Buffer);
+}
+
+
+void dGeomTriMeshDataBuildShared(dTriMeshDataID g, dTriMeshDataID Source)
+{
+    dUASSERT(g, "argument not trimesh data");
+    dUASSERT(Source, "argument not trimesh data");
+
+    g->BuildShared(Source);
+}
+
+
 void dGeomTriMeshDataBuildSingle(dTriMeshDataID g,
 				 const void* Vertices, int VertexStride, int VertexCount,
                                  const void* Indices, int IndexCount, int TriStride)
@@ -259,43 +351,46 @@ void dGeomTriMeshDataBuildSimple(dTriMeshDataID g,
 // they won't get deleted from under us.
 
 // Trimesh
-PlanesCollider* dxTriMesh::_PlanesCollider = new PlanesCollider();
-SphereCollider* dxTriMesh::_SphereCollider = new SphereCollider();
-//OBBCollider dxTriMesh::_OBBCollider;
-RayCollider* dxTriMesh::_RayCollider = new RayCollider();
-AABBTreeCollider* dxTriMesh::_AABBTreeCollider = new AABBTreeCollider();
-LSSCollider* dxTriMesh::_LSSCollider = new LSSCollider();
-
-SphereCache* dxTriMesh::defaultSphereCache = new SphereCache;
-//OBBCache dxTriMesh::defaultBoxCache;
-LSSCache* dxTriMesh::defaultCCylinderCache = new LSSCache();
-
-CollisionFaces* dxTriMesh::Faces = new CollisionFaces();
-
-dxTriMesh::dxTriMesh(dSpaceID Space, dTriMeshDataID Data) : dxGeom(Space, 1){
-	type = dTriMeshClass;
-
-	this->Data = Data;
+// (ballistica change: colliders are now per-thread; these are still
+// allocated with new() and never freed for the above reason.)
+dxTriMesh::Colliders& dxTriMesh::GetColliders(){
+	static thread_local Colliders* colliders = 0;
+	if (!colliders) colliders = new Colliders();
+	return *colliders;
+}
 
-	_RayCollider->SetDestination(Faces);
+dxTriMesh::Colliders::Colliders(){
+	Ray.SetDestination(&Faces);
 
-	_PlanesCollider->SetTemporalCoherence(true);
+	Planes.SetTemporalCoherence(true);
 
-	_SphereCollider->SetTemporalCoherence(true);
-        _SphereCollider->SetPrimitiveTests(false);
+	Sphere.SetTemporalCoherence(true);
+        Sphere.SetPrimitiveTests(false);
 
 
-	_OBBCollider.SetTemporalCoherence(true);
+	OBB.SetTemporalCoherence(true);
 
     // no first-contact test (i.e. return full contact info)
-	_AABBTreeCollider->SetFirstContact( false );
+	AABBTree.SetFirstContact( false );
     // temporal coherence only works with "first conact" tests
-    _AABBTreeCollider->SetTemporalCoherence(false);
+    AABBTree.SetTemporalCoherence(false);
     // Perform full BV-BV tests (true) or SAT-lite tests (false)
-	_AABBTreeCollider->SetFullBoxBoxTest( true );
+	AABBTree.SetFullBoxBoxTest( true );
     // Perform full Primitive-BV tests (true) or SAT-lite tests (false)
-	_AABBTreeCollider->SetFullPrimBoxTest( true );
-	_LSSCollider->SetTemporalCoherence(false);
+	AABBTree.SetFullPrimBoxTest( true );
+	LSS.SetTemporalCoherence(false);
+
+    const char* msg;
+    if ((msg =AABBTree.ValidateSettings()))
+        dDebug (d_ERR_UASSERT, msg, " (%s:%d)", __FILE__,__LINE__);
+	LSS.SetPrimitiveTests(false);
+	LSS.SetFirstContact(false);
+}
+
+dxTriMesh::dxTriMesh(dSpaceID Space, dTriMeshDataID Data) : dxGeom(Space, 1){
+	type = dTriMeshClass;
+
+	this->Data = Data;
 
 	/* TC has speed/space 'issues' that don't make it a clear
 	   win by default on spheres/boxes. */
@@ -305,12 +400,6 @@ dxTriMesh::dxTriMesh(dSpaceID Space, dTriMeshDataID Data) : dxGeom(Space, 1){
 
 
 	this->forceNormalMode = false;
-
-    const char* msg;
-    if ((msg =_AABBTreeCollider->ValidateSettings()))
-        dDebug (d_ERR_UASSERT, msg, " (%s:%d)", __FILE__,__LINE__);
-	_LSSCollider->SetPrimitiveTests(false);
-	_LSSCollider->SetFirstContact(false);
 }
 
 dxTriMesh::~dxTriMesh(){
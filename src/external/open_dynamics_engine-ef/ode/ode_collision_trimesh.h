@@ -78,6 +78,41 @@ void dGeomTriMeshDataBuildDouble1(dTriMeshDataID g,
                                   const void* Indices, int IndexCount, int TriStride,
                                   const void* Normals);
 
+/*
+ * ballistica additions:
+ * Same as the above, but optionally building a quantized (smaller) tree
+ * and/or loading the tree from data previously returned by
+ * dGeomTriMeshDataGetTreeData() instead of building it. Tree data is only
+ * valid for the exact same mesh data and quantization setting; invalid
+ * data is ignored and the tree is built. Returns 1 if the tree was loaded
+ * from TreeData and 0 if it was built.
+ */
+int dGeomTriMeshDataBuildSingle2(dTriMeshDataID g,
+                                 const void* Vertices, int VertexStride, int VertexCount,
+                                 const void* Indices, int IndexCount, int TriStride,
+                                 const void* Normals, int Quantized,
+                                 const void* TreeData, int TreeDataSize);
+int dGeomTriMeshDataBuildDouble2(dTriMeshDataID g,
+                                 const void* Vertices, int VertexStride, int VertexCount,
+                                 const void* Indices, int IndexCount, int TriStride,
+                                 const void* Normals, int Quantized,
+                                 const void* TreeData, int TreeDataSize);
+
+/*
+ * Serialize the built tree for later use with the above calls. Returns
+ * the size in bytes (0 if unsupported) and writes the data to Buffer if
+ * it is not NULL.
+ */
+int dGeomTriMeshDataGetTreeData(dTriMeshDataID g, void* Buffer);
+
+/*
+ * Set up g to use the same vertex data and tree as Source without
+ * rebuilding anything. Source must be built first and must outlive g.
+ * Each data keeps its own per-mesh scratch state, so the two can be used
+ * from different worlds/threads.
+ */
+void dGeomTriMeshDataBuildShared(dTriMeshDataID g, dTriMeshDataID Source);
+
 /*
  * Simple build. Single/double precision based on dSINGLE/dDOUBLE!
  */
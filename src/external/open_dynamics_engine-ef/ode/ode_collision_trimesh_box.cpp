@@ -1186,7 +1186,8 @@ int dCollideBTL(dxGeom* g1, dxGeom* BoxGeom, int Flags, dContactGeom* Contacts,
   ctx.vBestNormal[1]=0;
   ctx.vBestNormal[2]=0;
 
-  OBBCollider& Collider = TriMesh->_OBBCollider;
+  dxTriMesh::Colliders& Colliders = dxTriMesh::GetColliders();
+  OBBCollider& Collider = Colliders.OBB;
 
 
 
@@ -1243,7 +1244,7 @@ int dCollideBTL(dxGeom* g1, dxGeom* BoxGeom, int Flags, dContactGeom* Contacts,
   }
   else {
 		Collider.SetTemporalCoherence(false);
-		Collider.Collide(TriMesh->boxCache, Box, TriMesh->Data->BVTree, null,
+		Collider.Collide(Colliders.DefaultBoxCache, Box, TriMesh->Data->BVTree, null,
 						 &MakeMatrix(vPosMesh, mRotMesh, amatrix));
 		// Collider.Collide(dxTriMesh::defaultBoxCache, Box, TriMesh->Data->BVTree, null,
 		// 				 &MakeMatrix(vPosMesh, mRotMesh, amatrix));
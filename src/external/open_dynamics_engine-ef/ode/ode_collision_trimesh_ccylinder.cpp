@@ -163,44 +163,45 @@ typedef struct _sLocalContactData
 	int			nFlags; // 0 = filtered out, 1 = OK
 }sLocalContactData;
 
-static sLocalContactData   *gLocalContacts;
-static unsigned int			ctContacts = 0;
+// ballistica change: per-thread so collisions can run in parallel.
+static thread_local sLocalContactData   *gLocalContacts;
+static thread_local unsigned int			ctContacts = 0;
 
 // capsule data
 // real time data
-static dMatrix3  mCapsuleRotation;
-static dVector3   vCapsulePosition;
-static dVector3   vCapsuleAxis;
+static thread_local dMatrix3  mCapsuleRotation;
+static thread_local dVector3   vCapsulePosition;
+static thread_local dVector3   vCapsuleAxis;
 // static data
-static dReal      vCapsuleRadius;
-static dReal      fCapsuleSize;
+static thread_local dReal      vCapsuleRadius;
+static thread_local dReal      fCapsuleSize;
 
 // mesh data
 //static  dMatrix4  mHullDstPl;
-static   dMatrix3  mTriMeshRot;
-static dVector3   mTriMeshPos;
-static dVector3   vE0, vE1, vE2;
+static thread_local   dMatrix3  mTriMeshRot;
+static thread_local dVector3   mTriMeshPos;
+static thread_local dVector3   vE0, vE1, vE2;
 
 // Two geom
-dxGeom*	   gCylinder;
-dxGeom*	   gTriMesh;
+static thread_local dxGeom*	   gCylinder;
+static thread_local dxGeom*	   gTriMesh;
 
 // global collider data
-static dVector3 vNormal;
-static dReal    fBestDepth;
-static dReal    fBestCenter;
-static dReal    fBestrt;
-static int		iBestAxis;
-static dVector3 vN = {0,0,0,0};
+static thread_local dVector3 vNormal;
+static thread_local dReal    fBestDepth;
+static thread_local dReal    fBestCenter;
+static thread_local dReal    fBestrt;
+static thread_local int		iBestAxis;
+static thread_local dVector3 vN = {0,0,0,0};
 
-static dVector3 vV0;
-static dVector3 vV1;
-static dVector3 vV2;
+static thread_local dVector3 vV0;
+static thread_local dVector3 vV1;
+static thread_local dVector3 vV2;
 
 // ODE contact's specific
-static int iFlags;
-static dContactGeom *ContactGeoms;
-static int iStride;
+static thread_local int iFlags;
+static thread_local dContactGeom *ContactGeoms;
+static thread_local int iStride;
 
 // Capsule lie on axis number 3 = (Z axis)
 static const int nCAPSULE_AXIS = 2;
@@ -913,7 +914,8 @@ int dCollideCCTL(dxGeom *o1, dxGeom *o2, int flags, dContactGeom *contact, int s
 	vNormal[2] = REAL(0.0);
 
 	// Will it better to use LSS here? -> confirm Pierre.
-  OBBCollider& Collider{TriMesh->_OBBCollider};
+  dxTriMesh::Colliders& Colliders{dxTriMesh::GetColliders()};
+  OBBCollider& Collider{Colliders.OBB};
 
 	 Point cCenter((float) vCapsulePosition[0],(float) vCapsulePosition[1],(float) vCapsulePosition[2]);
 	 Point cExtents((float) vCapsuleRadius,(float) vCapsuleRadius,(float) fCapsuleSize/2);
@@ -964,7 +966,7 @@ int dCollideCCTL(dxGeom *o1, dxGeom *o2, int flags, dContactGeom *contact, int s
 	 else {
 		 Collider.SetTemporalCoherence(false);
 		 //Collider.Collide(dxTriMesh::defaultBoxCache, obbCCylinder, TriMesh->Data->BVTree, null,&MeshMatrix);
-		 Collider.Collide(TriMesh->boxCache, obbCCylinder, TriMesh->Data->BVTree, null,&MeshMatrix);
+		 Collider.Collide(Colliders.DefaultBoxCache, obbCCylinder, TriMesh->Data->BVTree, null,&MeshMatrix);
 	 }
 
 	 // Retrieve data
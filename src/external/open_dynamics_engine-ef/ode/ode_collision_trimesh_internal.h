@@ -58,6 +58,18 @@ struct dxTriMeshData  : public dBase {
 	       const void* Indices, int IndexCount, int TriStride, 
 	       const void* Normals, 
 	       bool Single);
+
+    // ballistica additions: optional quantized/cached trees and sharing.
+    bool Build2(const void* Vertices, int VertexStide, int VertexCount,
+	       const void* Indices, int IndexCount, int TriStride,
+	       const void* Normals,
+	       bool Single, bool Quantized,
+	       const void* TreeData, int TreeDataSize);
+    void BuildShared(const dxTriMeshData* Source);
+    void SetupMesh(const void* Vertices, int VertexStide, int VertexCount,
+	       const void* Indices, int IndexCount, int TriStride,
+	       const void* Normals,
+	       bool Single);
     
         /* aabb in model space */
         dVector3 AABBCenter;
@@ -81,45 +93,41 @@ struct dxTriMesh : public dxGeom{
 
 
 	// Colliders
-	static PlanesCollider* _PlanesCollider;
-	static SphereCollider* _SphereCollider;
-
-
-    // ericf change.. keep one of these per mesh now for multithreading
-    
-	//static OBBCollider _OBBCollider;
-    OBBCollider _OBBCollider;
-
-
-	static RayCollider* _RayCollider;
-	static AABBTreeCollider* _AABBTreeCollider;
-	static LSSCollider* _LSSCollider;
-
-	// Some constants
-	static CollisionFaces* Faces;
+	// ballistica addition: colliders hold scratch state between calls, so
+	// rather than sharing statics (or one OBB collider per mesh) we keep a
+	// set per thread; this lets narrow-phase tests against the same mesh
+	// run in parallel. Note that the optional per-mesh TC caches below are
+	// not thread safe.
+	struct Colliders {
+		Colliders();
+		PlanesCollider Planes;
+		SphereCollider Sphere;
+		OBBCollider OBB;
+		RayCollider Ray;
+		AABBTreeCollider AABBTree;
+		LSSCollider LSS;
+		CollisionFaces Faces;
+		SphereCache DefaultSphereCache;
+		OBBCache DefaultBoxCache;
+		LSSCache DefaultCCylinderCache;
+	};
+	static Colliders& GetColliders();
 
 	// Temporal coherence
 	struct SphereTC : public SphereCache{
 		dxGeom* Geom;
 	};
 	dArray<SphereTC> SphereTCCache;
-	static SphereCache* defaultSphereCache;
 
 	struct BoxTC : public OBBCache{
 		dxGeom* Geom;
 	};
 	dArray<BoxTC> BoxTCCache;
 
-    // ericf change - we keep one of these per trimesh
-    // so we can multithread..
-	//static OBBCache defaultBoxCache;
-	OBBCache boxCache;
-	
 	struct CCylinderTC : public LSSCache{
 		dxGeom* Geom;
 	};
 	dArray<CCylinderTC> CCylinderTCCache;
-	static LSSCache* defaultCCylinderCache;
 
 	bool doSphereTC;
 	bool doBoxTC;
@@ -45,7 +45,8 @@ int dCollideRTL(dxGeom* g1, dxGeom* RayGeom, int Flags, dContactGeom* Contacts,
 	const dVector3& TLPosition = *(const dVector3*)dGeomGetPosition(TriMesh);
 	const dMatrix3& TLRotation = *(const dMatrix3*)dGeomGetRotation(TriMesh);
 
-  RayCollider& Collider{*TriMesh->_RayCollider};
+  dxTriMesh::Colliders& Colliders{dxTriMesh::GetColliders()};
+  RayCollider& Collider{Colliders.Ray};
 
 	dReal Length = dGeomRayGetLength(RayGeom);
 
@@ -74,14 +75,14 @@ int dCollideRTL(dxGeom* g1, dxGeom* RayGeom, int Flags, dContactGeom* Contacts,
 	Matrix4x4 amatrix;
         int TriCount = 0;
         if (Collider.Collide(WorldRay, TriMesh->Data->BVTree, &MakeMatrix(TLPosition, TLRotation, amatrix))) {
-                TriCount = TriMesh->Faces->GetNbFaces();
+                TriCount = Colliders.Faces.GetNbFaces();
         }
 
         if (TriCount == 0) {
                 return 0;
         }
 
-	const CollisionFace* Faces = TriMesh->Faces->GetFaces();
+	const CollisionFace* Faces = Colliders.Faces.GetFaces();
 
 	int OutTriCount = 0;
 	for (int i = 0; i < TriCount; i++) {
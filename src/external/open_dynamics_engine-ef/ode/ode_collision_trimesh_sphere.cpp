@@ -281,7 +281,8 @@ int dCollideSTL(dxGeom* g1, dxGeom* SphereGeom, int Flags, dContactGeom* Contact
 	const dVector3& TLPosition = *(const dVector3*)dGeomGetPosition(TriMesh);
 	const dMatrix3& TLRotation = *(const dMatrix3*)dGeomGetRotation(TriMesh);
 
-  SphereCollider& Collider{*TriMesh->_SphereCollider};
+  dxTriMesh::Colliders& Colliders{dxTriMesh::GetColliders()};
+  SphereCollider& Collider{Colliders.Sphere};
 
 	const dVector3& Position = *(const dVector3*)dGeomGetPosition(SphereGeom);
 	dReal Radius = dGeomSphereGetRadius(SphereGeom);
@@ -319,7 +320,7 @@ int dCollideSTL(dxGeom* g1, dxGeom* SphereGeom, int Flags, dContactGeom* Contact
 	}
 	else {
 		Collider.SetTemporalCoherence(false);
-		Collider.Collide(*dxTriMesh::defaultSphereCache, Sphere, TriMesh->Data->BVTree, null,
+		Collider.Collide(Colliders.DefaultSphereCache, Sphere, TriMesh->Data->BVTree, null,
 						 &MakeMatrix(TLPosition, TLRotation, amatrix));
  	}
 
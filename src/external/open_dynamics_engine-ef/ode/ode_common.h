@@ -339,6 +339,18 @@ typedef struct dJointFeedback {
 } dJointFeedback;
 
 
+/* ballistica addition: solver stats for a world quick-step */
+
+typedef struct dQuickStepStats {
+  int islands;			/* islands solved */
+  int rows;			/* total constraint rows */
+  int warm_started_rows;	/* rows with impulses carried over */
+  int iterations_total;		/* iterations summed over islands */
+  int iterations_max;		/* most iterations used by an island */
+  dReal residual_max;		/* worst final residual of an island */
+} dQuickStepStats;
+
+
 /* private functions that must be implemented by the collision library:
  * (1) indicate that a geom has moved, (2) get the next geom in a body list.
  * these functions are called whenever the position of geoms connected to a
@@ -56,6 +56,23 @@ int dWorldGetQuickStepNumIterations (dWorldID);
 void dWorldSetQuickStepW (dWorldID, dReal param);
 dReal dWorldGetQuickStepW (dWorldID);
 
+/* ballistica addition: warm-started contacts and early solver exit.
+   When warm starting is enabled, joint impulses carry over between steps;
+   contact joints (which are recreated every step) pick up the impulses of
+   the closest matching contact between the same bodies on the previous
+   step. When a tolerance is set, islands stop iterating once the relative
+   change in impulses over an iteration drops below it. See
+   dQuickStepStats for what gets reported. */
+
+void dWorldSetQuickStepWarmStarting (dWorldID, int enabled);
+int dWorldGetQuickStepWarmStarting (dWorldID);
+void dWorldSetQuickStepTolerance (dWorldID, dReal tolerance,
+				  int min_iterations);
+dReal dWorldGetQuickStepTolerance (dWorldID);
+
+/* Stats for the most recent dWorldQuickStep() call. */
+void dWorldGetQuickStepStats (dWorldID, dQuickStepStats *stats);
+
 	int dWorldGetQuickStepWarmStartingDataSize(dWorldID w);
 	void dWorldGetQuickStepWarmStartingData(dWorldID w, dReal *array);
 	void dWorldSetQuickStepWarmStartingData(dWorldID w, dReal *array);
@@ -77,9 +77,19 @@ struct dxAutoDisable {
 struct dxQuickStepParameters {
   int num_iterations;		// number of SOR iterations to perform
   dReal w;			// the SOR over-relaxation parameter
+
+  // ballistica addition: warm starting and early exit.
+  int warm_starting;		// carry impulses over from the previous step
+  dReal tolerance;		// stop iterating below this residual (0 = never)
+  int min_iterations;		// always do at least this many iterations
 };
 
 
+// ballistica addition: contact impulses from the previous quick-step
+// (see ode_quickstep.cpp).
+struct dxContactCache;
+
+
 // contact generation parameters
 struct dxContactParameters {
   dReal max_vel;		// maximum correcting velocity
@@ -105,6 +115,11 @@ struct dxBody : public dObject {
   dxAutoDisable adis;		// auto-disable parameters
   dReal adis_timeleft;		// time left to be idle
   int adis_stepsleft;		// steps left to be idle
+
+  // ballistica addition: unique within the world and never reused, so
+  // things like the contact cache can refer to bodies without worrying
+  // about them being destroyed and their memory reused.
+  unsigned long serial;
 };
 
 
@@ -119,6 +134,9 @@ struct dxWorld : public dBase {
   int adis_flag;		// auto-disable flag for new bodies
   dxQuickStepParameters qs;
   dxContactParameters contactp;
+  dQuickStepStats qs_stats;	// ballistica addition: stats for last step
+  dxContactCache *contact_cache;	// ballistica addition
+  unsigned long next_body_serial;	// ballistica addition
 };
 
 
@@ -32,6 +32,10 @@
 #include "ode/ode_lcp.h"
 #include "ode/ode_util.h"
 #include "ode/ode_misc.h"
+#include "ode/ode_quickstep.h"
+
+#include <algorithm>
+#include <vector>
 
 #define ALLOCA dALLOCA16
 
@@ -378,13 +382,143 @@ static int compare_index_error (const void *a, const void *b)
 #endif
 
 
-static void SOR_LCP (int m, int nb, dRealMutablePtr J, int *jb, dxBody * const *body,
+//****************************************************************************
+// ballistica addition: contact impulse cache for warm starting.
+//
+// contact joints are recreated every step, so their lambdas can't simply be
+// left in the joint like other joints'. instead, at the end of each island
+// solve we stash each contact's impulses keyed by its body pair, and on the
+// following step each new contact picks up the impulses of the nearest
+// previous contact between the same bodies (with a similar normal). bodies
+// are keyed by serial rather than pointer; serials are never reused, so
+// entries for a destroyed body can't be picked up by a new one that lands
+// at the same address, and ordering doesn't depend on memory layout.
+// entries for destroyed bodies simply go unmatched and age out on the
+// following step.
+
+// contacts further apart than this (or with normals diverging more than
+// this) are considered unrelated.
+#define CONTACT_CACHE_MAX_DIST REAL(0.05)
+#define CONTACT_CACHE_MIN_NORMAL_DOT REAL(0.95)
+
+struct dxContactCacheEntry {
+	unsigned long b1, b2;	// body serials (0 for the static environment)
+	dVector3 pos;
+	dVector3 normal;
+	int m;
+	dReal lambda[3];
+};
+
+static bool contactCacheEntryLess (const dxContactCacheEntry &a,
+	const dxContactCacheEntry &b)
+{
+	if (a.b1 != b.b1) return a.b1 < b.b1;
+	return a.b2 < b.b2;
+}
+
+struct dxContactCache {
+	std::vector<dxContactCacheEntry> prev;	// sorted by body serials
+	std::vector<dxContactCacheEntry> next;	// filled as islands are solved
+};
+
+
+void dxQuickStepBegin (dxWorld *world)
+{
+	memset (&world->qs_stats,0,sizeof(world->qs_stats));
+	dxContactCache *cache = world->contact_cache;
+	if (!world->qs.warm_starting) {
+		if (cache) dxQuickStepDestroyCache (world);
+		return;
+	}
+	if (!cache) {
+		cache = new dxContactCache;
+		world->contact_cache = cache;
+	}
+	cache->prev.swap (cache->next);
+	cache->next.clear();
+	std::stable_sort (cache->prev.begin(),cache->prev.end(),
+		&contactCacheEntryLess);
+}
+
+
+void dxQuickStepDestroyCache (dxWorld *world)
+{
+	delete world->contact_cache;
+	world->contact_cache = 0;
+}
+
+
+// look up impulses for a contact from the previous step. returns the number
+// of rows filled in.
+static unsigned long contactCacheSerial (dxBody *b)
+{
+	return b ? b->serial : 0;
+}
+
+
+static int contactCacheLookup (dxContactCache *cache, dxJointContact *j,
+	int m, dReal *lambda)
+{
+	dxContactCacheEntry key;
+	key.b1 = contactCacheSerial (j->node[0].body);
+	key.b2 = contactCacheSerial (j->node[1].body);
+	std::vector<dxContactCacheEntry>::const_iterator i =
+		std::lower_bound (cache->prev.begin(),cache->prev.end(),key,
+			&contactCacheEntryLess);
+	const dReal *pos = j->contact.geom.pos;
+	const dReal *normal = j->contact.geom.normal;
+	const dxContactCacheEntry *best = 0;
+	dReal best_dist = CONTACT_CACHE_MAX_DIST*CONTACT_CACHE_MAX_DIST;
+	for (; i != cache->prev.end() && i->b1 == key.b1 && i->b2 == key.b2; ++i) {
+		if (dDOT (i->normal,normal) < CONTACT_CACHE_MIN_NORMAL_DOT) continue;
+		dReal dx = i->pos[0] - pos[0];
+		dReal dy = i->pos[1] - pos[1];
+		dReal dz = i->pos[2] - pos[2];
+		dReal dist = dx*dx + dy*dy + dz*dz;
+		if (dist < best_dist) {
+			best_dist = dist;
+			best = &*i;
+		}
+	}
+	if (!best) return 0;
+	int n = (m < best->m) ? m : best->m;
+	for (int k=0; k<n; k++) lambda[k] = best->lambda[k];
+	return n;
+}
+
+
+static void contactCacheStore (dxContactCache *cache, dxJointContact *j,
+	int m, const dReal *lambda)
+{
+	dxContactCacheEntry e;
+	e.b1 = contactCacheSerial (j->node[0].body);
+	e.b2 = contactCacheSerial (j->node[1].body);
+	for (int k=0; k<3; k++) {
+		e.pos[k] = j->contact.geom.pos[k];
+		e.normal[k] = j->contact.geom.normal[k];
+	}
+	e.pos[3] = e.normal[3] = 0;
+	e.m = (m < 3) ? m : 3;
+	for (int k=0; k<e.m; k++) e.lambda[k] = lambda[k];
+	cache->next.push_back (e);
+}
+
+//****************************************************************************
+
+// ballistica addition: returns the number of iterations performed and the
+// relative residual (sum of impulse changes over sum of impulses) of the
+// final one.
+static int SOR_LCP (int m, int nb, dRealMutablePtr J, int *jb, dxBody * const *body,
 	dRealPtr invI, dRealMutablePtr lambda, dRealMutablePtr fc, dRealMutablePtr b,
 	dRealMutablePtr lo, dRealMutablePtr hi, dRealPtr cfm, int *findex,
-	dxQuickStepParameters *qs)
+	dxQuickStepParameters *qs, dReal *residual)
 {
 	const int num_iterations = qs->num_iterations;
 	const dReal sor_w = qs->w;		// SOR over-relaxation parameter
+	const dReal tolerance = qs->tolerance;
+	const int min_iterations = qs->min_iterations;
+	int iteration;
+	*residual = 0;
 
 	int i,j;
 
@@ -457,7 +591,9 @@ static void SOR_LCP (int m, int nb, dRealMutablePtr J, int *jb, dxBody * const *
 	dIASSERT (j==m);
 #endif
 
-	for (int iteration=0; iteration < num_iterations; iteration++) {
+	for (iteration=0; iteration < num_iterations; iteration++) {
+		dReal delta_sum = 0;
+		dReal lambda_sum = 0;
 
 #ifdef REORDER_CONSTRAINTS
 		// constraints with findex < 0 always come first.
@@ -568,6 +704,8 @@ static void SOR_LCP (int m, int nb, dRealMutablePtr J, int *jb, dxBody * const *
 			else {
 				lambda[index] = new_lambda;
 			}
+			delta_sum += dFabs (delta);
+			lambda_sum += dFabs (lambda[index]);
 
 			//@@@ a trick that may or may not help
 			//dReal ramp = (1-((dReal)(iteration+1)/(dReal)num_iterations));
@@ -595,7 +733,15 @@ static void SOR_LCP (int m, int nb, dRealMutablePtr J, int *jb, dxBody * const *
 				fc_ptr[5] += delta * iMJ_ptr[11];
 			}
 		}
+
+		// ballistica addition: bail once impulses have settled.
+		*residual = (lambda_sum > 0) ? delta_sum / lambda_sum : 0;
+		if (tolerance > 0 && iteration+1 >= min_iterations
+				&& *residual < tolerance) {
+			return iteration+1;
+		}
 	}
+	return iteration;
 }
 
 
@@ -846,8 +992,23 @@ void dxQuickStepper (dxWorld *world, dxBody * const *body, int nb,
 		dRealAllocaArray (lambda,m);
 #ifdef WARM_STARTING
 		dSetZero (lambda,m);	//@@@ shouldn't be necessary
-		for (i=0; i<nj; i++) {
-			memcpy (lambda+ofs[i],joint[i]->lambda,info[i].m * sizeof(dReal));
+		// ballistica addition: only when warm starting is enabled; contact
+		// joints get theirs from the contact cache.
+		dxContactCache *contact_cache = world->contact_cache;
+		int warm_started_rows = 0;
+		if (world->qs.warm_starting) {
+			for (i=0; i<nj; i++) {
+				if (joint[i]->vtable->typenum == dJointTypeContact) {
+					if (contact_cache) {
+						warm_started_rows += contactCacheLookup (contact_cache,
+							(dxJointContact*)joint[i],info[i].m,lambda+ofs[i]);
+					}
+				}
+				else {
+					memcpy (lambda+ofs[i],joint[i]->lambda,info[i].m * sizeof(dReal));
+					warm_started_rows += info[i].m;
+				}
+			}
 		}
 #endif
 
@@ -857,7 +1018,33 @@ void dxQuickStepper (dxWorld *world, dxBody * const *body, int nb,
 		// solve the LCP problem and get lambda and invM*constraint_force
 		IFTIMING (dTimerNow ("solving LCP problem");)
 		dRealAllocaArray (cforce,nb*6);
-		SOR_LCP (m,nb,J,jb,body,invI,lambda,cforce,rhs,lo,hi,cfm,findex,&world->qs);
+		dReal residual;
+		int iterations = SOR_LCP (m,nb,J,jb,body,invI,lambda,cforce,rhs,lo,hi,
+			cfm,findex,&world->qs,&residual);
+
+		// ballistica addition: stats and saving lambdas for warm starting.
+		dQuickStepStats *stats = &world->qs_stats;
+		stats->islands++;
+		stats->rows += m;
+		stats->iterations_total += iterations;
+		if (iterations > stats->iterations_max) stats->iterations_max = iterations;
+		if (residual > stats->residual_max) stats->residual_max = residual;
+#ifdef WARM_STARTING
+		stats->warm_started_rows += warm_started_rows;
+		if (world->qs.warm_starting) {
+			for (i=0; i<nj; i++) {
+				if (joint[i]->vtable->typenum == dJointTypeContact) {
+					if (contact_cache) {
+						contactCacheStore (contact_cache,(dxJointContact*)joint[i],
+							info[i].m,lambda+ofs[i]);
+					}
+				}
+				else {
+					memcpy (joint[i]->lambda,lambda+ofs[i],info[i].m * sizeof(dReal));
+				}
+			}
+		}
+#endif
 
         // ERICF TEST
         {
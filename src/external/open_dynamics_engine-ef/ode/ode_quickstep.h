@@ -29,5 +29,10 @@
 void dxQuickStepper (dxWorld *world, dxBody * const *body, int nb,
 		     dxJoint * const *_joint, int nj, dReal stepsize);
 
+// ballistica addition: called at the start/end of each world quick-step
+// and on world destruction to manage stats and the contact impulse cache.
+void dxQuickStepBegin (dxWorld *world);
+void dxQuickStepDestroyCache (dxWorld *world);
+
 
 #endif
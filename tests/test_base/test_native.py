@@ -0,0 +1,88 @@
+# Released under the MIT License. See LICENSE for details.
+#
+"""Testing engine internals via the binary's built-in native tests."""
+
+from __future__ import annotations
+
+import pytest
+
+from batools import apprun
+
+
+def _run_native_test(name: str) -> None:
+    apprun.python_command(
+        f'import _babase; _babase.run_native_test({name!r})',
+        purpose='native testing',
+    )
+
+
+@pytest.mark.skipif(
+    apprun.test_runs_disabled(), reason=apprun.test_runs_disabled_reason()
+)
+def test_timer_list_groups() -> None:
+    """Test that grouped timers run in order and come apart cleanly."""
+    _run_native_test('timer_list_groups')
+
+
+@pytest.mark.skipif(
+    apprun.test_runs_disabled(), reason=apprun.test_runs_disabled_reason()
+)
+def test_ode_default_solver() -> None:
+    """Test that the physics solver's defaults match its old behavior."""
+    _run_native_test('ode_default_solver')
+
+
+@pytest.mark.skipif(
+    apprun.test_runs_disabled(), reason=apprun.test_runs_disabled_reason()
+)
+def test_narrow_phase_parallel() -> None:
+    """Test that threaded collision tests match serial ones exactly."""
+    _run_native_test('narrow_phase_parallel')
+
+
+@pytest.mark.skipif(
+    apprun.test_runs_disabled(), reason=apprun.test_runs_disabled_reason()
+)
+def test_dynamic_resolution() -> None:
+    """Test the dynamic-resolution controller's stepping."""
+    _run_native_test('dynamic_resolution')
+
+
+@pytest.mark.skipif(
+    apprun.test_runs_disabled(), reason=apprun.test_runs_disabled_reason()
+)
+def test_huffman_round_trip() -> None:
+    """Test that data survives compression with each of our tables."""
+    _run_native_test('huffman_round_trip')
+
+
+@pytest.mark.skipif(
+    apprun.test_runs_disabled(), reason=apprun.test_runs_disabled_reason()
+)
+def test_huffman_negotiation() -> None:
+    """Test that peers only agree on identical channel tables."""
+    _run_native_test('huffman_negotiation')
+
+
+@pytest.mark.skipif(
+    apprun.test_runs_disabled(), reason=apprun.test_runs_disabled_reason()
+)
+def test_udp_recording_round_trip() -> None:
+    """Test that recorded udp packets read back exactly."""
+    _run_native_test('udp_recording_round_trip')
+
+
+@pytest.mark.skipif(
+    apprun.test_runs_disabled(), reason=apprun.test_runs_disabled_reason()
+)
+def test_collision_tree_cache() -> None:
+    """Test that loaded and shared collision trees match built ones."""
+    _run_native_test('collision_tree_cache')
+
+
+@pytest.mark.skipif(
+    apprun.test_runs_disabled(), reason=apprun.test_runs_disabled_reason()
+)
+def test_pending_event_slots() -> None:
+    """Test that high-rate input events coalesce without reordering."""
+    _run_native_test('pending_event_slots')
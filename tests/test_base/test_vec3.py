@@ -0,0 +1,86 @@
+# Released under the MIT License. See LICENSE for details.
+#
+"""Testing Vec3 functionality."""
+
+from __future__ import annotations
+
+import textwrap
+
+import pytest
+
+from batools import apprun
+
+
+@pytest.mark.skipif(
+    apprun.test_runs_disabled(), reason=apprun.test_runs_disabled_reason()
+)
+def test_vec3_operators() -> None:
+    """Test Vec3 math, including that augmented ops don't alias."""
+
+    apprun.python_command(
+        textwrap.dedent(
+            """
+            from _babase import Vec3
+
+            a = Vec3(1.0, 2.0, 3.0)
+            b = Vec3(0.5, 0.5, 0.5)
+            assert a + b == Vec3(1.5, 2.5, 3.5)
+            assert a - b == Vec3(0.5, 1.5, 2.5)
+            assert a * 2.0 == Vec3(2.0, 4.0, 6.0)
+            assert 2.0 * a == Vec3(2.0, 4.0, 6.0)
+            assert a * b == Vec3(0.5, 1.0, 1.5)
+            assert -a == Vec3(-1.0, -2.0, -3.0)
+            assert Vec3(3.0, 4.0, 0.0).length_squared() == 25.0
+            assert Vec3(0.0, 0.0, 0.0).distance(Vec3(3.0, 4.0, 0.0)) == 5.0
+            assert a.lerp(Vec3(3.0, 2.0, 1.0), 0.5) == Vec3(2.0, 2.0, 2.0)
+            norm = Vec3(0.0, 2.0, 0.0)
+            norm.normalize()
+            assert norm == Vec3(0.0, 1.0, 0.0)
+
+            # Vec3s get handed out and stored all over the place, so
+            # augmented assignment must give a new object and leave any
+            # other references alone.
+            alias = a
+            a += b
+            a -= Vec3(1.0, 1.0, 1.0)
+            a *= 2.0
+            assert a == Vec3(1.0, 3.0, 5.0)
+            assert a is not alias
+            assert alias == Vec3(1.0, 2.0, 3.0)
+            """
+        ),
+        purpose='vec3 testing',
+    )
+
+
+@pytest.mark.skipif(
+    apprun.test_runs_disabled(), reason=apprun.test_runs_disabled_reason()
+)
+def test_vec3_free_list() -> None:
+    """Make sure recycled Vec3s come back fully initialized."""
+
+    apprun.python_command(
+        textwrap.dedent(
+            """
+            from _babase import Vec3
+
+            # Fill the free-list past its capacity and then draw from it
+            # through each way of creating a vector.
+            for _ in range(3):
+                vecs = [Vec3(float(i), 1.0, 2.0) for i in range(1000)]
+                del vecs
+                made = [Vec3() for _ in range(300)]
+                assert all(v == Vec3(0.0, 0.0, 0.0) for v in made)
+                del made
+                made = [Vec3(7.0) for _ in range(300)]
+                assert all(v == Vec3(7.0, 7.0, 7.0) for v in made)
+                del made
+                made = [Vec3(1.0, 2.0, 3.0) + Vec3(float(i), 0.0, 0.0)
+                        for i in range(300)]
+                assert all(v == Vec3(1.0 + i, 2.0, 3.0)
+                           for i, v in enumerate(made))
+                del made
+            """
+        ),
+        purpose='vec3 testing',
+    )
@@ -0,0 +1,124 @@
+# Released under the MIT License. See LICENSE for details.
+#
+"""Testing the offline huffman table tools."""
+
+from __future__ import annotations
+
+import os
+import random
+import shutil
+import struct
+from typing import TYPE_CHECKING
+
+from batools import huffman
+
+if TYPE_CHECKING:
+    from pathlib import Path
+
+PROJROOT = os.path.abspath(
+    os.path.join(os.path.dirname(__file__), '..', '..')
+)
+
+
+def test_golden() -> None:
+    """Make sure we produce exactly what the engine does.
+
+    The 'huffman_round_trip' native test checks the engine against this
+    same data.
+    """
+    generic = huffman.load_generic_table(PROJROOT)
+    data = bytes([1, 0, 0, 0, 5, 9, 0, 33, 0, 2, 0, 0, 64, 0, 191, 0, 0, 0])
+    packed = bytes([129, 241, 183, 249, 196, 253, 167, 23, 126])
+    assert generic.compress(data) == packed
+    assert generic.decompress(packed) == data
+
+
+def test_round_trip() -> None:
+    """Make sure assorted data survives compression."""
+    rand = random.Random(1234)
+    freqs = [1] * 256
+    freqs[0] = 5000
+    freqs[7] = 2000
+    tables = [
+        huffman.load_generic_table(PROJROOT),
+        huffman.HuffmanTable(freqs, 2),
+    ]
+    for table in tables:
+        for length in range(1, 400, 13):
+            data = bytes(
+                (
+                    rand.choice([0, 0, 0, 7, 64])
+                    if rand.random() < 0.8
+                    else rand.randrange(256)
+                )
+                for _ in range(length)
+            )
+            data = bytes([data[0] & 0x7F]) + data[1:]
+            packed = table.compress(data)
+            assert len(packed) <= len(data)
+            if packed != data:
+                assert (packed[0] >> 4) & 0x07 == table.table_id
+            assert table.decompress(packed) == data
+
+
+def _write_replay(path: Path, messages: list[bytes]) -> None:
+    generic = huffman.load_generic_table(PROJROOT)
+    with open(path, 'wb') as outfile:
+        outfile.write(struct.pack('<IH', huffman.BRP_FILE_ID, 35))
+        for message in messages:
+            packed = generic.compress(message)
+            if len(packed) < 254:
+                outfile.write(struct.pack('<B', len(packed)))
+            elif len(packed) < 65536:
+                outfile.write(struct.pack('<BH', 254, len(packed)))
+            else:
+                outfile.write(struct.pack('<BI', 255, len(packed)))
+            outfile.write(packed)
+
+
+def test_build_tables(tmp_path: Path) -> None:
+    """Build tables from a replay and write them into a source copy."""
+    rand = random.Random(5678)
+    types = huffman.load_channel_message_types(PROJROOT)
+    input_type = next(t for t, c in types.items() if c == 3)
+    commands_type = next(t for t, c in types.items() if c == 1)
+
+    # Lots of input messages (which look nothing like generic traffic)
+    # and a few session commands.
+    messages = [
+        bytes([input_type] + [rand.choice([3, 200, 201]) for _ in range(40)])
+        for _ in range(3000)
+    ] + [bytes([commands_type, 0, 0, 0]) for _ in range(20)]
+    messages.append(bytes([input_type] + [5] * 70000))
+    replay = tmp_path / 'test.brp'
+    _write_replay(replay, messages)
+
+    generic = huffman.load_generic_table(PROJROOT)
+    assert list(huffman.read_replay_messages(str(replay), generic)) == messages
+
+    tables = huffman.build_channel_tables(PROJROOT, [str(replay)])
+    assert list(tables) == [3]
+    assert tables[3][200] > tables[3][0]
+
+    # Write them into a copy of the source and make sure they parse
+    # back out the same.
+    srcdir = tmp_path / os.path.dirname(huffman.SOURCE_PATH)
+    srcdir.mkdir(parents=True)
+    shutil.copy(os.path.join(PROJROOT, huffman.SOURCE_PATH), srcdir)
+    assert huffman.write_channel_tables(str(tmp_path), tables)
+    assert not huffman.write_channel_tables(str(tmp_path), tables)
+    with open(tmp_path / huffman.SOURCE_PATH, encoding='utf-8') as infile:
+        source = infile.read()
+    assert 'HuffmanChannel::kInput' in source
+    body = source.split('HuffmanChannel::kInput,')[1].split('}}')[0]
+    assert [int(v) for v in body.replace('{', '').split(',')] == tables[3]
+    assert all(len(line) <= 80 for line in source.splitlines())
+
+    # And going back to no tables restores the original.
+    assert huffman.write_channel_tables(str(tmp_path), {})
+    with open(tmp_path / huffman.SOURCE_PATH, encoding='utf-8') as infile:
+        restored = infile.read()
+    with open(
+        os.path.join(PROJROOT, huffman.SOURCE_PATH), encoding='utf-8'
+    ) as infile:
+        assert restored == infile.read()
@@ -0,0 +1,94 @@
+# Released under the MIT License. See LICENSE for details.
+#
+"""Testing log functionality."""
+
+from __future__ import annotations
+
+import gc
+import os
+import logging
+import weakref
+import threading
+
+import pytest
+
+from efro.log import LogHandler, LogEntry
+
+
+@pytest.mark.skipif(
+    not hasattr(os, 'register_at_fork'), reason='fork not supported'
+)
+def test_log_handler_fork() -> None:
+    """Make sure a forked child gets a working log thread of its own."""
+    # pylint: disable=protected-access
+
+    handler = LogHandler(
+        path=None,
+        echofile=None,
+        suppress_non_root_debug=False,
+        cache_size_limit=1024 * 1024,
+        cache_time_limit=None,
+    )
+    parent_thread = handler._thread
+
+    pid = os.fork()
+    if pid == 0:
+        # Child; report back via our exit code, and never return into
+        # pytest.
+        ok = False
+        try:
+            got_entry = threading.Event()
+
+            def _on_entry(entry: LogEntry) -> None:
+                if entry.message == 'hello from child':
+                    got_entry.set()
+
+            assert handler._thread is not parent_thread
+            assert handler._thread.is_alive()
+            handler.add_callback(_on_entry)
+            handler.emit(
+                logging.LogRecord(
+                    'root',
+                    logging.WARNING,
+                    __file__,
+                    0,
+                    'hello from child',
+                    None,
+                    None,
+                )
+            )
+            ok = got_entry.wait(timeout=5.0)
+        finally:
+            os._exit(0 if ok else 1)
+
+    _, status = os.waitpid(pid, 0)
+    assert os.WIFEXITED(status)
+    assert os.WEXITSTATUS(status) == 0
+
+    # The parent should be unaffected.
+    assert handler._thread is parent_thread
+    assert parent_thread.is_alive()
+
+
+def test_log_handler_fork_registration_is_weak() -> None:
+    """Make sure our fork support doesn't keep dead handlers alive."""
+    # pylint: disable=protected-access
+
+    handler = LogHandler(
+        path=None,
+        echofile=None,
+        suppress_non_root_debug=False,
+        cache_size_limit=1024 * 1024,
+        cache_time_limit=None,
+    )
+    handler_ref = weakref.ref(handler)
+
+    # A handler's thread keeps it alive, so stop that first.
+    handler._event_loop.call_soon_threadsafe(handler._event_loop.stop)
+    handler._thread.join(timeout=5.0)
+    assert not handler._thread.is_alive()
+    handler._event_loop.close()
+
+    del handler
+    gc.collect()
+    assert handler_ref() is None
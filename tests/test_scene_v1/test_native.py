@@ -0,0 +1,41 @@
+# Released under the MIT License. See LICENSE for details.
+#
+"""Testing scene-v1 internals via the binary's built-in native tests."""
+
+from __future__ import annotations
+
+import pytest
+
+from batools import apprun
+
+
+def _run_native_test(name: str) -> None:
+    # Our tests become available once our binary module is imported.
+    apprun.python_command(
+        f'import _bascenev1, _babase; _babase.run_native_test({name!r})',
+        purpose='native testing',
+    )
+
+
+@pytest.mark.skipif(
+    apprun.test_runs_disabled(), reason=apprun.test_runs_disabled_reason()
+)
+def test_replay_state_delta() -> None:
+    """Test that delta-encoded replay seek states decode exactly."""
+    _run_native_test('replay_state_delta')
+
+
+@pytest.mark.skipif(
+    apprun.test_runs_disabled(), reason=apprun.test_runs_disabled_reason()
+)
+def test_collision_sound_merging() -> None:
+    """Test that nearby collision sounds merge into one each."""
+    _run_native_test('collision_sound_merging')
+
+
+@pytest.mark.skipif(
+    apprun.test_runs_disabled(), reason=apprun.test_runs_disabled_reason()
+)
+def test_node_attr_quantization() -> None:
+    """Test that quantized node attrs keep their declared precision."""
+    _run_native_test('node_attr_quantization')
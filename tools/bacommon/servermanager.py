@@ -175,12 +175,23 @@ class ServerConfig:
     # Protocol version we host with. Currently the default is 33 which
     # still allows older 1.4 game clients to connect. Explicitly setting
     # to 35 no longer allows those clients but adds/fixes a few things
-    # such as making camera shake properly work in net games.
+    # such as making camera shake properly work in net games. Setting 36
+    # additionally sends many float node attributes in compact quantized
+    # form, lowering bandwidth, but requires clients supporting 36.
     protocol_version: int | None = None
 
     # (internal) stress-testing mode.
     stress_test_players: int | None = None
 
+    # (internal) stress-test soak options: how long each round lasts,
+    # a seed for reproducible player churn, how long to run before
+    # shutting down, and a file to append periodic JSON stats to.
+    stress_test_round_duration: int = 30
+    stress_test_seed: int | None = None
+    stress_test_duration: float | None = None
+    stress_test_report_path: str | None = None
+    stress_test_report_interval: float = 60.0
+
     # How many seconds individual players from a given account must wait
     # before rejoining the game. This can help suppress exploits
     # involving leaving and rejoining or switching teams rapidly.
@@ -477,7 +477,14 @@ def _get_server_config_template_toml(projroot: str) -> str:
     # lines_in = [l.replace("'", '"') for l in lines_in]
 
     lines_out: list[str] = []
-    ignore_vars = {'stress_test_players'}
+    ignore_vars = {
+        'stress_test_players',
+        'stress_test_round_duration',
+        'stress_test_seed',
+        'stress_test_duration',
+        'stress_test_report_path',
+        'stress_test_report_interval',
+    }
     for line in lines_in:
 
         # Replace attr declarations with commented out toml values.
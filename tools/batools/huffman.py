@@ -0,0 +1,316 @@
+# Released under the MIT License. See LICENSE for details.
+#
+"""Functionality for building the engine's huffman tables offline.
+
+Game traffic and replays are compressed with huffman tables compiled
+into src/ballistica/base/support/huffman.cc. Alongside the generic
+table there can be a table for each channel of traffic (session
+commands, dynamics corrections, input). Those are generated here from
+a corpus of replays and written back into the source file; peers only
+use a channel table once their handshake shows they both have an
+identical copy, so regenerating them never breaks compatibility.
+
+This mirrors the engine's table building and bit layout exactly; the
+'huffman_round_trip' native test and tests/test_batools check both
+against the same golden data.
+"""
+
+from __future__ import annotations
+
+import os
+import re
+import math
+import struct
+from typing import TYPE_CHECKING
+
+if TYPE_CHECKING:
+    from typing import Iterator
+
+SOURCE_PATH = 'src/ballistica/base/support/huffman.cc'
+MESSAGES_PATH = 'src/ballistica/base/networking/networking.h'
+BRP_FILE_ID = 83749
+
+# Channel ids and their HuffmanChannel names; these match the enum in
+# huffman.h and double as the table ids we embed in compressed data.
+CHANNELS: dict[int, str] = {
+    1: 'kSessionCommands',
+    2: 'kDynamicsCorrection',
+    3: 'kInput',
+}
+_CHANNEL_MESSAGES: dict[str, int] = {
+    'BA_MESSAGE_SESSION_COMMANDS': 1,
+    'BA_MESSAGE_SESSION_DYNAMICS_CORRECTION': 2,
+    'BA_MESSAGE_REMOTE_PLAYER_INPUT_COMMANDS': 3,
+}
+
+# Don't bother building tables from less data than this.
+MIN_CHANNEL_BYTES = 100000
+
+# Node frequencies are summed into C ints; keep totals well clear.
+_MAX_TOTAL_FREQUENCY = 1 << 30
+
+_BEGIN_MARKER = '// __AUTOGENERATED_CHANNEL_TABLES_BEGIN__'
+_END_MARKER = '// __AUTOGENERATED_CHANNEL_TABLES_END__'
+
+
+class HuffmanTable:
+    """A huffman code built from byte frequencies the way the engine does."""
+
+    def __init__(self, frequencies: list[int], table_id: int = 0) -> None:
+        if len(frequencies) != 256:
+            raise ValueError('Expected 256 frequencies.')
+        if not 0 <= table_id <= 7:
+            raise ValueError('Table ids must fit in 3 bits.')
+        self.table_id = table_id
+        self._left = [-1] * 511
+        self._right = [-1] * 511
+        self._parent = [0] * 511
+        self._freq = list(frequencies) + [0] * 255
+        self._bits = [0] * 256
+        self._vals = [0] * 256
+        self._build()
+
+    def _build(self) -> None:
+        parent = self._parent
+        freq = self._freq
+
+        # Repeatedly parent the two smallest unparented nodes; ties and
+        # child order must match the engine exactly or codes will differ.
+        for node_count in range(256, 511):
+            i = 0
+            while parent[i] != 0:
+                i += 1
+            smallest1 = i
+            i += 1
+            while parent[i] != 0:
+                i += 1
+            smallest2 = i
+            i += 1
+            while i < node_count:
+                if parent[i] == 0:
+                    if freq[smallest1] > freq[smallest2]:
+                        if freq[i] < freq[smallest1]:
+                            smallest1 = i
+                    elif freq[i] < freq[smallest2]:
+                        smallest2 = i
+                i += 1
+            freq[node_count] = freq[smallest1] + freq[smallest2]
+            parent[smallest1] = node_count - 255
+            parent[smallest2] = node_count - 255
+            self._right[node_count] = smallest1
+            self._left[node_count] = smallest2
+
+        for i in range(256):
+            val = 0
+            bits = 0
+            index = i
+            while parent[index] != 0:
+                up = parent[index] + 255
+                val = (val << 1) | (1 if self._right[up] == index else 0)
+                bits += 1
+                index = up
+
+            # A leading 1 bit marks a huffman code; long codes instead get
+            # a 0 bit followed by the raw byte.
+            if bits >= 8:
+                self._bits[i] = 9
+                self._vals[i] = i << 1
+            else:
+                self._bits[i] = bits + 1
+                self._vals[i] = (val << 1) | 0x01
+
+    def compressed_size(self, data: bytes) -> int:
+        """Return the size compress() would give for some data."""
+        bit_count = sum(self._bits[b] for b in data)
+        length_out = (bit_count + 7) // 8 + 1
+        return min(length_out, len(data))
+
+    def compress(self, data: bytes) -> bytes:
+        """Compress data; returns it unchanged if that wouldn't help."""
+        if not data or data[0] >> 7:
+            raise ValueError('The top bit of the first byte must be unused.')
+        bit_count = sum(self._bits[b] for b in data)
+        length_out = (bit_count + 7) // 8 + 1
+        if length_out >= len(data):
+            return data
+        out = bytearray(length_out)
+        out[0] = (8 - bit_count % 8) % 8
+        bit = 8
+        for byte in data:
+            val = self._vals[byte]
+            for src_bit in range(self._bits[byte]):
+                out[bit // 8] |= ((val >> src_bit) & 0x01) << (bit % 8)
+                bit += 1
+        out[0] |= 0x80 | (self.table_id << 4)
+        return bytes(out)
+
+    def decompress(self, data: bytes) -> bytes:
+        """Decompress data from compress() (or pass uncompressed through)."""
+        if not data:
+            raise ValueError('Empty data.')
+        if not data[0] >> 7:
+            return data
+        body = data[1:]
+        bit_length = len(body) * 8 - (data[0] & 0x0F)
+        if bit_length < 0:
+            raise ValueError('Invalid huffman data.')
+
+        def _bit(index: int) -> int:
+            if index // 8 >= len(body):
+                raise ValueError('Invalid huffman data.')
+            return (body[index // 8] >> (index % 8)) & 0x01
+
+        out = bytearray()
+        bit = 0
+        while bit < bit_length:
+            flag = _bit(bit)
+            bit += 1
+            if flag:
+                node = 510
+                while True:
+                    child = (self._right if _bit(bit) else self._left)[node]
+                    if child == -1:
+                        break
+                    node = child
+                    bit += 1
+                    if self._left[node] == -1 and self._right[node] == -1:
+                        break
+                    if bit > bit_length:
+                        raise ValueError('Invalid huffman data.')
+                out.append(node)
+            else:
+                out.append(sum(_bit(bit + i) << i for i in range(8)))
+                bit += 8
+        if bit != bit_length:
+            raise ValueError('Invalid huffman data.')
+        return bytes(out)
+
+
+def load_generic_table(projroot: str) -> HuffmanTable:
+    """Build the engine's generic table from its source."""
+    with open(os.path.join(projroot, SOURCE_PATH), encoding='utf-8') as infile:
+        source = infile.read()
+    match = re.search(r'static int g_freqs\[\] = \{(.*?)\};', source, re.DOTALL)
+    if match is None:
+        raise RuntimeError(f'Generic table not found in {SOURCE_PATH}.')
+    return HuffmanTable([int(v) for v in match.group(1).split(',')])
+
+
+def load_channel_message_types(projroot: str) -> dict[int, int]:
+    """Return channel ids keyed by the session-message types they cover."""
+    with open(
+        os.path.join(projroot, MESSAGES_PATH), encoding='utf-8'
+    ) as infile:
+        source = infile.read()
+    out: dict[int, int] = {}
+    for name, channel in _CHANNEL_MESSAGES.items():
+        match = re.search(rf'#define {name} (\d+)\n', source)
+        if match is None:
+            raise RuntimeError(f'{name} not found in {MESSAGES_PATH}.')
+        out[int(match.group(1))] = channel
+    return out
+
+
+def read_replay_messages(path: str, generic: HuffmanTable) -> Iterator[bytes]:
+    """Yield the decompressed session messages in a replay file."""
+    with open(path, 'rb') as infile:
+        data = infile.read()
+    if len(data) < 6 or struct.unpack_from('<I', data)[0] != BRP_FILE_ID:
+        raise ValueError(f'Not a replay file: \'{path}\'.')
+    offset = 6
+    while offset < len(data):
+        length = data[offset]
+        offset += 1
+        if length == 254:
+            (length,) = struct.unpack_from('<H', data, offset)
+            offset += 2
+        elif length == 255:
+            (length,) = struct.unpack_from('<I', data, offset)
+            offset += 4
+        if length == 0 or offset + length > len(data):
+            break
+        yield generic.decompress(data[offset : offset + length])
+        offset += length
+
+
+def build_channel_tables(
+    projroot: str, replay_paths: list[str]
+) -> dict[int, list[int]]:
+    """Return byte frequencies for each channel worth having a table for.
+
+    Channels with too little data or where a dedicated table does no
+    better than the generic one on the corpus are left out.
+    """
+    generic = load_generic_table(projroot)
+    message_channels = load_channel_message_types(projroot)
+    messages: dict[int, list[bytes]] = {channel: [] for channel in CHANNELS}
+    for path in replay_paths:
+        for message in read_replay_messages(path, generic):
+            channel = message_channels.get(message[0]) if message else None
+            if channel is not None:
+                messages[channel].append(message)
+
+    out: dict[int, list[int]] = {}
+    for channel, channel_messages in messages.items():
+        freqs = [0] * 256
+        for message in channel_messages:
+            for byte in message:
+                freqs[byte] += 1
+        total = sum(freqs)
+        if total < MIN_CHANNEL_BYTES:
+            continue
+        if total > _MAX_TOTAL_FREQUENCY:
+            scale = _MAX_TOTAL_FREQUENCY / total
+            freqs = [math.ceil(f * scale) for f in freqs]
+        table = HuffmanTable(freqs, channel)
+        if sum(table.compressed_size(m) for m in channel_messages) < sum(
+            generic.compressed_size(m) for m in channel_messages
+        ):
+            out[channel] = freqs
+    return out
+
+
+def gen_channel_tables_code(tables: dict[int, list[int]]) -> str:
+    """Generate the C++ for the built-in channel tables section."""
+    lines = [
+        _BEGIN_MARKER,
+        'static auto GetBuiltinChannelFreqs()',
+        '    -> std::vector<std::pair<HuffmanChannel, std::vector<int>>> {',
+    ]
+    if not tables:
+        lines.append('  return {};')
+    else:
+        lines.append('  return {')
+        for channel, freqs in sorted(tables.items()):
+            lines.append(f'      {{HuffmanChannel::{CHANNELS[channel]},')
+            line = '       {'
+            for i, freq in enumerate(freqs):
+                val = f'{freq}' + ('}},' if i == 255 else ',')
+                if len(line) + len(val) + 1 > 80:
+                    lines.append(line)
+                    line = '        ' + val
+                else:
+                    line += ('' if line.endswith('{') else ' ') + val
+            lines.append(line)
+        lines.append('  };')
+    lines += ['}', _END_MARKER]
+    return '\n'.join(lines)
+
+
+def write_channel_tables(projroot: str, tables: dict[int, list[int]]) -> bool:
+    """Write channel tables into the engine source; returns True if changed."""
+    path = os.path.join(projroot, SOURCE_PATH)
+    with open(path, encoding='utf-8') as infile:
+        lines = infile.read().splitlines()
+    begin = lines.index(_BEGIN_MARKER)
+    end = lines.index(_END_MARKER)
+    new_lines = (
+        lines[:begin]
+        + gen_channel_tables_code(tables).splitlines()
+        + lines[end + 1 :]
+    )
+    if new_lines == lines:
+        return False
+    with open(path, 'w', encoding='utf-8') as outfile:
+        outfile.write('\n'.join(new_lines) + '\n')
+    return True
@@ -132,6 +132,7 @@ from batools.pcommands2 import (
     spinoff_test,
     spinoff_check_submodule_parent,
     tests_warm_start,
+    gen_huffman_tables,
     wsl_path_to_win,
     wsl_build_check_win_drive,
     get_modern_make,
@@ -400,6 +400,35 @@ def gen_python_init_module() -> None:
         )
 
 
+def gen_huffman_tables() -> None:
+    """Build per-channel huffman tables from replays into the engine."""
+    import os
+
+    from efro.error import CleanError
+    from efro.terminal import Clr
+
+    from batools import huffman
+
+    pcommand.disallow_in_batch()
+
+    replay_paths = sys.argv[2:]
+    if not replay_paths:
+        raise CleanError('Expected one or more replay (.brp) paths.')
+    for path in replay_paths:
+        if not os.path.isfile(path):
+            raise CleanError(f"Replay not found: '{path}'.")
+
+    projroot = str(pcommand.PROJROOT)
+    tables = huffman.build_channel_tables(projroot, replay_paths)
+    for channel, name in huffman.CHANNELS.items():
+        status = 'built' if channel in tables else 'skipped (using generic)'
+        print(f'{name}: {status}')
+    if huffman.write_channel_tables(projroot, tables):
+        print(f'{Clr.GRN}Updated {huffman.SOURCE_PATH}.{Clr.RST}')
+    else:
+        print(f'{huffman.SOURCE_PATH} is already up to date.')
+
+
 def tests_warm_start() -> None:
     """Warm-start some stuff needed by tests.
 
@@ -3,10 +3,12 @@
 """Logging functionality."""
 from __future__ import annotations
 
+import os
 import sys
 import time
 import asyncio
 import logging
+import weakref
 import datetime
 import itertools
 from enum import Enum
@@ -164,6 +166,22 @@ class LogHandler(logging.Handler):
         while not self._thread_bootstrapped:
             time.sleep(0.001)
 
+        # Only the forking thread survives a fork, so if we get forked
+        # (by a prefork server, for instance) the child needs a fresh log
+        # thread of its own.
+        _fork_handlers.add(self)
+
+    def _after_fork_in_child(self) -> None:
+        # Locks held by the parent's log thread would stay held forever.
+        self._cache_lock = Lock()
+        self._file_chunks = {'stdout': [], 'stderr': []}
+        self._file_chunk_ship_task = {'stdout': None, 'stderr': None}
+        self._thread_bootstrapped = False
+        self._thread = Thread(target=self._log_thread_main, daemon=True)
+        self._thread.start()
+        while not self._thread_bootstrapped:
+            time.sleep(0.001)
+
     def add_callback(
         self, call: Callable[[LogEntry], None], feed_existing_logs: bool = False
     ) -> None:
@@ -613,6 +631,21 @@ class LogHandler(logging.Handler):
                 self._printed_callback_error = True
 
 
+# Handlers to restart in forked children. Held weakly so that forking
+# support doesn't keep handlers around longer than they would otherwise.
+_fork_handlers: weakref.WeakSet[LogHandler] = weakref.WeakSet()
+
+
+def _after_fork_in_child() -> None:
+    # pylint: disable=protected-access
+    for handler in list(_fork_handlers):
+        handler._after_fork_in_child()
+
+
+if hasattr(os, 'register_at_fork'):
+    os.register_at_fork(after_in_child=_after_fork_in_child)
+
+
 class FileLogEcho:
     """A file-like object for forwarding stdout/stderr to a LogHandler."""
 